@@ -0,0 +1,375 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+# TUM School of Engineering and Design
+# Technical University of Munich
+#
+# All rights reserved. See LICENSE for the license terms.
+#
+# Generates the host counterpart of the AsDefault.h header that Automation Studio creates for the
+# target. Data types, function blocks, functions, constants and global variables are read from the
+# IEC declaration files of the logical view, the libraries listed in Libraries/Package.pkg and the
+# axis references of the mapp Motion configuration.
+#
+# Usage: GenerateAsDefault.py <PLC directory> <output directory>
+#
+# The output directory receives AsDefault.h with all declarations and AsDefault.cpp, which defines
+# the global variables. All IEC types are mapped to fixed width types, so that the memory layout on
+# a 64 bit host matches the 32 bit target.
+#
+
+import glob
+import os
+import re
+import sys
+
+
+ELEMENTARY_TYPES = {
+	'BOOL': 'plcbit',
+	'SINT': 'int8_t',
+	'USINT': 'uint8_t',
+	'INT': 'int16_t',
+	'UINT': 'uint16_t',
+	'DINT': 'int32_t',
+	'UDINT': 'uint32_t',
+	'LINT': 'int64_t',
+	'ULINT': 'uint64_t',
+	'REAL': 'float',
+	'LREAL': 'double',
+	'BYTE': 'uint8_t',
+	'WORD': 'uint16_t',
+	'DWORD': 'uint32_t',
+	'LWORD': 'uint64_t',
+	'TIME': 'plctime',
+	'DATE_AND_TIME': 'plcdt',
+	'DT': 'plcdt',
+	'DATE': 'plcdate',
+	'TIME_OF_DAY': 'plctod',
+	'TOD': 'plctod',
+	'ANY': 'uint32_t',
+	'ANY_INT': 'int32_t',
+	'ANY_NUM': 'double',
+	'ANY_REAL': 'double',
+	'ANY_ELEMENTARY': 'uint32_t',
+	'STRING': 'plcstring',
+	'WSTRING': 'plcwstring',
+}
+
+# Partial C-only types of mapp Motion, which the libraries only declare as opaque storage.
+OPAQUE_TYPES = {
+	'McInternalFubProcessingType',
+	'McInternalControlIfType',
+}
+
+
+def strip_comments (text):
+	text = re.sub (r'\(\*.*?\*\)', '', text, flags = re.S)
+	return re.sub (r'\{[A-Za-z_]+\}', '', text)
+
+
+def read_file (sFileName):
+	with open (sFileName, encoding = 'utf-8-sig', errors = 'ignore') as f:
+		return strip_comments (f.read ())
+
+
+def parse_type (sType):
+	sType = re.sub (r':=.*$', '', sType.strip ().rstrip (';'), flags = re.S).strip ()
+	
+	match = re.match (r'REFERENCE\s+TO\s+(\w+)$', sType)
+	if match:
+		return ('reference', match.group (1))
+	
+	match = re.match (r'ARRAY\s*\[(.*?)\]\s*OF\s+(.*)$', sType, re.S)
+	if match:
+		dimensions = []
+		for sRange in match.group (1).split (','):
+			sLower, sUpper = sRange.split ('..')
+			dimensions.append ((sLower.strip (), sUpper.strip ()))
+		return ('array', dimensions, parse_type (match.group (2)))
+	
+	match = re.match (r'(W?STRING)\s*\[\s*(\w+)\s*\]$', sType)
+	if match:
+		return ('string', match.group (1), match.group (2))
+	if sType in ('STRING', 'WSTRING'):
+		return ('string', sType, '80')
+	
+	return ('named', sType)
+
+
+def parse_fields (sBlock):
+	fields = []
+	for sLine in sBlock.split (';'):
+		if ':' not in sLine:
+			continue
+		sName, sType = sLine.split (':', 1)
+		sName = sName.strip ()
+		if re.match (r'^\w+$', sName):
+			fields.append ((sName, parse_type (sType), sType))
+	return fields
+
+
+def initial_value (sType):
+	match = re.search (r':=\s*(.*)$', sType.strip ().rstrip (';'), re.S)
+	if not match:
+		return None
+	sValue = match.group (1).strip ()
+	if sValue in ('TRUE', 'FALSE'):
+		return '1' if sValue == 'TRUE' else '0'
+	if re.match (r'^-?[0-9][0-9_.]*$', sValue):
+		return sValue.replace ('_', '')
+	return None
+
+
+def convert_constant (sValue):
+	sValue = sValue.strip ()
+	if sValue in ('TRUE', 'FALSE'):
+		return '1' if sValue == 'TRUE' else '0'
+	match = re.match (r'^(2|8|16)#([0-9A-Fa-f_]+)$', sValue)
+	if match:
+		return str (int (match.group (2).replace ('_', ''), int (match.group (1))))
+	if re.match (r'^-?[0-9][0-9_]*(\.[0-9_]+)?([eE][-+]?[0-9]+)?$', sValue):
+		return sValue.replace ('_', '')
+	# Simple expressions of other constants are passed on to the C preprocessor.
+	if re.match (r'^[\w\s+\-*/().]+$', sValue):
+		return sValue
+	return None
+
+
+def convert_enumerator (sEnumerator):
+	if ':=' not in sEnumerator:
+		return sEnumerator.strip ()
+	sName, sValue = sEnumerator.split (':=', 1)
+	return '%s = %s' % (sName.strip (), convert_constant (sValue))
+
+
+class CDeclarations:
+
+	def __init__ (self):
+		self.types = {}
+		self.function_blocks = set ()
+		self.functions = []
+		self.constants = []
+		self.variables = []
+		self.emitted = set ()
+		self.lines = []
+
+	def read_types (self, sFileName):
+		for sBlock in re.findall (r'\bTYPE\b(.*?)\bEND_TYPE\b', read_file (sFileName), re.S):
+			for match in re.finditer (r'(\w+)\s*:\s*(STRUCT\b(.*?)END_STRUCT|\((.*?)\)\s*(:=\s*\w+)?|[^;]+);', sBlock, re.S):
+				sName = match.group (1)
+				if match.group (3) is not None:
+					self.types[sName] = ('struct', parse_fields (match.group (3)))
+				elif match.group (4) is not None:
+					values = [convert_enumerator (sValue) for sValue in match.group (4).split (',') if sValue.strip ()]
+					self.types[sName] = ('enum', values)
+				else:
+					self.types[sName] = ('alias', parse_type (match.group (2)))
+
+	def read_functions (self, sFileName):
+		sText = read_file (sFileName)
+		for match in re.finditer (r'FUNCTION_BLOCK\s+(\w+)(.*?)END_FUNCTION_BLOCK', sText, re.S):
+			fields = []
+			for sBlock in re.findall (r'\bVAR(?:_INPUT|_OUTPUT|_IN_OUT)?\b(.*?)END_VAR', match.group (2), re.S):
+				fields += parse_fields (sBlock)
+			self.types[match.group (1)] = ('struct', fields)
+			self.function_blocks.add (match.group (1))
+		for match in re.finditer (r'\bFUNCTION\s+(\w+)\s*:\s*([^\n]+?)\s*\n(.*?)END_FUNCTION\b', sText, re.S):
+			parameters = []
+			for sBlock in re.findall (r'\bVAR_INPUT\b(.*?)END_VAR', match.group (3), re.S):
+				parameters += parse_fields (sBlock)
+			self.functions.append ((match.group (1), parse_type (match.group (2)), parameters))
+
+	def read_variables (self, sFileName):
+		for match in re.finditer (r'\bVAR\b(\s+CONSTANT)?(.*?)END_VAR', read_file (sFileName), re.S):
+			for sName, parsedType, sType in parse_fields (match.group (2)):
+				if match.group (1):
+					valueMatch = re.search (r':=\s*(.*)$', sType.strip (), re.S)
+					sValue = convert_constant (valueMatch.group (1)) if valueMatch else None
+					if sValue is not None:
+						self.constants.append ((sName, sValue))
+				else:
+					self.variables.append ((sName, parsedType, initial_value (sType)))
+
+	def add_axis_references (self, sFileName):
+		with open (sFileName, encoding = 'utf-8-sig', errors = 'ignore') as f:
+			for sName in re.findall (r'<Element\s+ID="(\w+)"\s+Type="axis"', f.read ()):
+				self.variables.append ((sName, ('named', 'McAxisType'), None))
+
+	def type_name (self, sType):
+		if sType in ELEMENTARY_TYPES:
+			return ELEMENTARY_TYPES[sType]
+		if sType in OPAQUE_TYPES:
+			return 'plcopaque'
+		if sType in self.function_blocks:
+			return 'struct ' + sType
+		return sType
+
+	def pointer_name (self, sType):
+		if (sType in self.types) and (self.types[sType][0] == 'struct'):
+			return 'struct ' + sType
+		return self.type_name (sType)
+
+	def render (self, sName, parsedType):
+		sKind = parsedType[0]
+		if sKind == 'reference':
+			return '%s* %s' % (self.pointer_name (parsedType[1]), sName)
+		if sKind == 'string':
+			return '%s %s[%s + 1]' % (ELEMENTARY_TYPES[parsedType[1]], sName, parsedType[2])
+		if sKind == 'array':
+			sDimensions = ''.join ('[(%s) - (%s) + 1]' % (sUpper, sLower) for sLower, sUpper in parsedType[1])
+			return self.render (sName + sDimensions, parsedType[2])
+		return '%s %s' % (self.type_name (parsedType[1]), sName)
+
+	def render_parameter (self, sName, parsedType):
+		# Strings and arrays are passed by address, like in the target headers.
+		if parsedType[0] == 'string':
+			return '%s* %s' % (ELEMENTARY_TYPES[parsedType[1]], sName)
+		if parsedType[0] == 'array':
+			return self.render ('* ' + sName, parsedType[2])
+		return self.render (sName, parsedType)
+
+	def dependencies (self, parsedType):
+		if parsedType[0] == 'named':
+			return [parsedType[1]]
+		if parsedType[0] == 'array':
+			return self.dependencies (parsedType[2])
+		return []
+
+	def emit_type (self, sName, stack = ()):
+		if (sName in self.emitted) or (sName not in self.types) or (sName in stack) or (sName in ELEMENTARY_TYPES) or (sName in OPAQUE_TYPES):
+			return
+		
+		declaration = self.types[sName]
+		if declaration[0] == 'struct':
+			for sFieldName, parsedType, sType in declaration[1]:
+				for sDependency in self.dependencies (parsedType):
+					self.emit_type (sDependency, stack + (sName,))
+			self.emitted.add (sName)
+			
+			sBody = ''.join ('\t%s;\n' % self.render (sFieldName, parsedType) for sFieldName, parsedType, sType in declaration[1])
+			if not sBody:
+				sBody = '\tuint8_t _empty;\n'
+			sTypedef = sName + '_typ' if sName in self.function_blocks else sName
+			self.lines.append ('typedef struct %s {\n%s} %s;\n' % (sName, sBody, sTypedef))
+			
+		elif declaration[0] == 'enum':
+			self.emitted.add (sName)
+			self.lines.append ('typedef enum %s {\n\t%s\n} %s;\n' % (sName, ',\n\t'.join (declaration[1]), sName))
+			
+		else:
+			for sDependency in self.dependencies (declaration[1]):
+				self.emit_type (sDependency, stack + (sName,))
+			self.emitted.add (sName)
+			self.lines.append ('typedef %s;\n' % self.render (sName, declaration[1]))
+
+	def write_header (self, sFileName):
+		self.lines = []
+		self.emitted = set ()
+		for sName in self.types:
+			self.emit_type (sName)
+		
+		output = [
+			'/* Generated by GenerateAsDefault.py, do not edit. */',
+			'',
+			'#ifndef _ASDEFAULT_H_',
+			'#define _ASDEFAULT_H_',
+			'',
+			'#include <bur/plctypes.h>',
+			'',
+			'#ifdef __cplusplus',
+			'extern "C" {',
+			'#endif',
+			'',
+		]
+		output += ['#define %s (%s)' % (sName, sValue) for sName, sValue in self.constants]
+		output += ['']
+		output += self.lines
+		output += ['_BUR_PUBLIC void %s(struct %s* inst);' % (sName, sName) for sName in sorted (self.function_blocks)]
+		output += ['']
+		for sName, returnType, parameters in self.functions:
+			sReturn = self.render_parameter ('', returnType).strip ()
+			sParameters = ', '.join (self.render_parameter (sParameterName, parsedType) for sParameterName, parsedType, sType in parameters)
+			output.append ('_BUR_PUBLIC %s %s(%s);' % (sReturn, sName, sParameters or 'void'))
+		output += ['']
+		output += ['extern %s;' % self.render (sName, parsedType) for sName, parsedType, sValue in self.variables]
+		output += [
+			'',
+			'#ifdef __cplusplus',
+			'}',
+			'#endif',
+			'',
+			'#endif /* _ASDEFAULT_H_ */',
+			'',
+		]
+		write_if_changed (sFileName, '\n'.join (output))
+
+	def write_variables (self, sFileName):
+		output = [
+			'/* Generated by GenerateAsDefault.py, do not edit. */',
+			'',
+			'#include <AsDefault.h>',
+			'',
+		]
+		for sName, parsedType, sValue in self.variables:
+			if sValue is not None:
+				output.append ('%s = %s;' % (self.render (sName, parsedType), sValue))
+			else:
+				output.append ('%s;' % self.render (sName, parsedType))
+		output.append ('')
+		write_if_changed (sFileName, '\n'.join (output))
+
+
+def write_if_changed (sFileName, sContent):
+	# Keeps the time stamp, so that an unchanged declaration does not rebuild the whole program.
+	if os.path.exists (sFileName):
+		with open (sFileName, encoding = 'utf-8') as f:
+			if f.read () == sContent:
+				return
+	with open (sFileName, 'w', encoding = 'utf-8') as f:
+		f.write (sContent)
+
+
+def library_names (sLogicalDirectory):
+	with open (os.path.join (sLogicalDirectory, 'Libraries', 'Package.pkg'), encoding = 'utf-8-sig') as f:
+		return re.findall (r'<Object\s+Type="Library"[^>]*>(\w+)</Object>', f.read ())
+
+
+def main ():
+	if len (sys.argv) != 3:
+		print ('usage: GenerateAsDefault.py <PLC directory> <output directory>')
+		return 1
+	
+	sPLCDirectory = sys.argv[1]
+	sOutputDirectory = sys.argv[2]
+	sLogicalDirectory = os.path.join (sPLCDirectory, 'Logical')
+	
+	declarations = CDeclarations ()
+	
+	sourceFiles = []
+	for sLibrary in library_names (sLogicalDirectory):
+		sourceFiles += sorted (glob.glob (os.path.join (sLogicalDirectory, 'Libraries', sLibrary, '*.typ')))
+		sourceFiles += sorted (glob.glob (os.path.join (sLogicalDirectory, 'Libraries', sLibrary, '*.fun')))
+		sourceFiles += sorted (glob.glob (os.path.join (sLogicalDirectory, 'Libraries', sLibrary, '*.var')))
+	sourceFiles += [os.path.join (sLogicalDirectory, 'Global.typ'), os.path.join (sLogicalDirectory, 'Main', 'Types.typ')]
+	sourceFiles += [os.path.join (sLogicalDirectory, 'Global.var'), os.path.join (sLogicalDirectory, 'Main', 'Variables.var')]
+	
+	for sFileName in sourceFiles:
+		if sFileName.endswith ('.typ'):
+			declarations.read_types (sFileName)
+		elif sFileName.endswith ('.fun'):
+			declarations.read_functions (sFileName)
+		else:
+			declarations.read_variables (sFileName)
+	
+	for sFileName in sorted (glob.glob (os.path.join (sPLCDirectory, 'Physical', '*', '*', 'mappMotion', '*.axis'))):
+		declarations.add_axis_references (sFileName)
+	
+	os.makedirs (sOutputDirectory, exist_ok = True)
+	declarations.write_header (os.path.join (sOutputDirectory, 'AsDefault.h'))
+	declarations.write_variables (os.path.join (sOutputDirectory, 'AsDefault.cpp'))
+	
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit (main ())
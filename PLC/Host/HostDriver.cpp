@@ -0,0 +1,126 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// Driver of the host build. It runs the program like the task class of the target: ProgramInit once,
+// then ProgramCyclic with a fixed cycle time, and ProgramExit at the end. Usage:
+//
+//   reAM250Host [--cycletime <microseconds>] [--cycles <count>] [--realtime] [--maxoverbudget <count>]
+//
+// Without --cycles the loop runs until the process is stopped. With --realtime each cycle is paced
+// to the wall clock, otherwise the simulated time runs as fast as the host allows. With --maxoverbudget
+// the driver fails if the profiled sections have exceeded their cycle time budget more often than that.
+// The host is not a real time system, so a few overruns stem from preemption and have to be tolerated.
+
+#include "HostSimulation.hpp"
+
+#include <bur/plctypes.h>
+#include <AsDefault.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+void ProgramInit (void);
+void ProgramCyclic (void);
+void ProgramExit (void);
+
+using namespace BuRCPP;
+
+static void printUsage (const char * pProgramName)
+{
+	printf ("usage: %s [--cycletime <microseconds>] [--cycles <count>] [--realtime] [--maxoverbudget <count>]\n", pProgramName);
+}
+
+int main (int argc, char ** argv)
+{
+	uint32_t nCycleTime = HOSTSIMULATION_DEFAULTCYCLETIME;
+	uint64_t nCycleCount = 0;
+	bool bRealTime = false;
+	bool bBudgetCheck = false;
+	uint32_t nMaxOverBudgetCount = 0;
+	
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		if ((strcmp (argv[nIndex], "--cycletime") == 0) && (nIndex + 1 < argc)) {
+			nCycleTime = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else if ((strcmp (argv[nIndex], "--cycles") == 0) && (nIndex + 1 < argc)) {
+			nCycleCount = strtoull (argv[++nIndex], nullptr, 10);
+		} else if (strcmp (argv[nIndex], "--realtime") == 0) {
+			bRealTime = true;
+		} else if ((strcmp (argv[nIndex], "--maxoverbudget") == 0) && (nIndex + 1 < argc)) {
+			nMaxOverBudgetCount = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+			bBudgetCheck = true;
+		} else {
+			printUsage (argv[0]);
+			return 1;
+		}
+	}
+	
+	if (nCycleTime == 0) {
+		printUsage (argv[0]);
+		return 1;
+	}
+	
+	CHostSimulation::initialize ();
+	ProgramInit ();
+	
+	auto nextCycle = std::chrono::steady_clock::now ();
+	
+	for (uint64_t nCycle = 0; (nCycleCount == 0) || (nCycle < nCycleCount); nCycle++) {
+		if (bRealTime) {
+			nextCycle += std::chrono::microseconds (nCycleTime);
+			std::this_thread::sleep_until (nextCycle);
+		}
+		
+		CHostSimulation::advanceTime (nCycleTime);
+		ProgramCyclic ();
+		
+		// The program stops cycling after an exception, there is nothing left to simulate
+		if (LastException != 0)
+			break;
+	}
+	
+	ProgramExit ();
+	
+	printf ("LastException: %d %s\n", (int) LastException, LastExceptionMessage);
+	printf ("LastFault: %d %s\n", (int) LastFault, LastFaultMessage);
+	printf ("CycleOverBudgetCount: %u\n", (unsigned) CycleOverBudgetCount);
+	
+	if (LastException != 0)
+		return 2;
+	if (bBudgetCheck && (CycleOverBudgetCount > nMaxOverBudgetCount))
+		return 3;
+	
+	return 0;
+}
@@ -0,0 +1,441 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Stand-ins for the library function blocks and functions, which the program calls. They reproduce
+// the interface behaviour that the state machines rely on, not the exact control characteristics.
+
+#include "HostSimulation.hpp"
+
+#include <bur/plctypes.h>
+#include <AsDefault.h>
+
+#include <cmath>
+#include <cstring>
+
+// MpAxisBasic keeps the state of each simulated axis in a fixed table, so that calls never allocate.
+#define HOSTAXIS_MAXCOUNT 16
+
+#define HOSTAXIS_COMMAND_POWER 0x01
+#define HOSTAXIS_COMMAND_HOME 0x02
+#define HOSTAXIS_COMMAND_MOVEABSOLUTE 0x04
+#define HOSTAXIS_COMMAND_MOVEADDITIVE 0x08
+#define HOSTAXIS_COMMAND_MOVEVELOCITY 0x10
+#define HOSTAXIS_COMMAND_STOP 0x20
+#define HOSTAXIS_COMMAND_ERRORRESET 0x40
+
+using namespace BuRCPP;
+
+typedef struct _HostAxisState {
+	struct MpAxisBasic * m_pFunctionBlock;
+	uint32_t m_nCommandsOld;
+	double m_dTargetPosition;
+	bool m_bMoveToTarget;
+} HostAxisState;
+
+static HostAxisState g_HostAxes[HOSTAXIS_MAXCOUNT];
+
+static plctime getHostTimeInMilliseconds ()
+{
+	return (plctime) (CHostSimulation::getTimeInMicroseconds () / 1000);
+}
+
+static float getHostCycleTimeInSeconds ()
+{
+	return (float) CHostSimulation::getCycleTimeInMicroseconds () * 1.0e-6f;
+}
+
+static HostAxisState * findHostAxis (struct MpAxisBasic * inst)
+{
+	for (auto & axis : g_HostAxes) {
+		if (axis.m_pFunctionBlock == inst)
+			return &axis;
+	}
+	
+	for (auto & axis : g_HostAxes) {
+		if (axis.m_pFunctionBlock == nullptr) {
+			memset ((void*) &axis, 0, sizeof (axis));
+			axis.m_pFunctionBlock = inst;
+			return &axis;
+		}
+	}
+	
+	return nullptr;
+}
+
+static uint32_t getAxisCommands (struct MpAxisBasic * inst)
+{
+	uint32_t nCommands = 0;
+	if (inst->Power)
+		nCommands |= HOSTAXIS_COMMAND_POWER;
+	if (inst->Home)
+		nCommands |= HOSTAXIS_COMMAND_HOME;
+	if (inst->MoveAbsolute)
+		nCommands |= HOSTAXIS_COMMAND_MOVEABSOLUTE;
+	if (inst->MoveAdditive)
+		nCommands |= HOSTAXIS_COMMAND_MOVEADDITIVE;
+	if (inst->MoveVelocity)
+		nCommands |= HOSTAXIS_COMMAND_MOVEVELOCITY;
+	if (inst->Stop)
+		nCommands |= HOSTAXIS_COMMAND_STOP;
+	if (inst->ErrorReset)
+		nCommands |= HOSTAXIS_COMMAND_ERRORRESET;
+	return nCommands;
+}
+
+
+plcbit DiagCpuIsSimulated (void)
+{
+	return 1;
+}
+
+
+void TON (struct TON* inst)
+{
+	if (!inst->IN) {
+		inst->Q = 0;
+		inst->ET = 0;
+		inst->M = 0;
+		return;
+	}
+	
+	plctime nTime = getHostTimeInMilliseconds ();
+	if (!inst->M) {
+		inst->StartTime = nTime;
+		inst->M = 1;
+	}
+	
+	inst->ET = nTime - inst->StartTime;
+	if (inst->ET >= inst->PT) {
+		inst->ET = inst->PT;
+		inst->Q = 1;
+	}
+}
+
+void TOF (struct TOF* inst)
+{
+	if (inst->IN) {
+		inst->Q = 1;
+		inst->ET = 0;
+		inst->M = 1;
+		return;
+	}
+	
+	plctime nTime = getHostTimeInMilliseconds ();
+	if (inst->M) {
+		inst->StartTime = nTime;
+		inst->M = 0;
+	}
+	
+	if (inst->Q) {
+		inst->ET = nTime - inst->StartTime;
+		if (inst->ET >= inst->PT) {
+			inst->ET = inst->PT;
+			inst->Q = 0;
+		}
+	}
+}
+
+
+void MTBasicsPID (struct MTBasicsPID* inst)
+{
+	if (!inst->Enable) {
+		inst->Active = 0;
+		inst->Busy = 0;
+		inst->Error = 0;
+		inst->StatusID = 0;
+		inst->UpdateDone = 0;
+		inst->Out = 0.0f;
+		inst->ControlError = 0.0f;
+		inst->ProportionalPart = 0.0f;
+		inst->IntegrationPart = 0.0f;
+		inst->DerivativePart = 0.0f;
+		inst->Internal.ControlErrorOld = 0.0f;
+		return;
+	}
+	
+	// Parameters are taken over in every call, Update is only acknowledged.
+	inst->Active = 1;
+	inst->UpdateDone = inst->Update;
+	
+	float fCycleTime = getHostCycleTimeInSeconds ();
+	auto & parameters = inst->PIDParameters;
+	
+	float fControlError = inst->SetValue - inst->ActValue;
+	if (inst->Invert)
+		fControlError = -fControlError;
+	
+	if (!inst->HoldOut) {
+		inst->ProportionalPart = parameters.Gain * fControlError;
+		
+		if (inst->SetIntegrationPart) {
+			inst->IntegrationPart = inst->IntegrationPartPresetValue;
+		} else if (parameters.IntegrationTime > 0.0f) {
+			inst->IntegrationPart += parameters.Gain * fControlError * fCycleTime / parameters.IntegrationTime;
+		}
+		
+		if (fCycleTime > 0.0f) {
+			float fDerivative = parameters.Gain * parameters.DerivativeTime * (fControlError - inst->Internal.ControlErrorOld) / fCycleTime;
+			inst->DerivativePart = (parameters.FilterTime * inst->DerivativePart + fCycleTime * fDerivative) / (parameters.FilterTime + fCycleTime);
+		}
+		
+		// Anti windup: the integration part is limited to the output range
+		float fOut = inst->ProportionalPart + inst->IntegrationPart + inst->DerivativePart;
+		if (fOut > inst->MaxOut) {
+			inst->IntegrationPart -= fOut - inst->MaxOut;
+			fOut = inst->MaxOut;
+		} else if (fOut < inst->MinOut) {
+			inst->IntegrationPart += inst->MinOut - fOut;
+			fOut = inst->MinOut;
+		}
+		
+		inst->Out = fOut;
+	}
+	
+	inst->ControlError = fControlError;
+	inst->Internal.ControlErrorOld = fControlError;
+}
+
+void MTBasicsPWM (struct MTBasicsPWM* inst)
+{
+	if (!inst->Enable) {
+		inst->Active = 0;
+		inst->Error = 0;
+		inst->StatusID = 0;
+		inst->UpdateDone = 0;
+		inst->Out = 0;
+		inst->Internal.PeriodCounter = 0.0f;
+		return;
+	}
+	
+	inst->Active = 1;
+	inst->UpdateDone = inst->Update;
+	
+	if (inst->Period <= 0.0f) {
+		inst->Out = 0;
+		return;
+	}
+	
+	float fDutyCycle = fminf (fmaxf (inst->DutyCycle, 0.0f), 100.0f) / 100.0f;
+	float fOnTime = fDutyCycle * inst->Period;
+	if (fOnTime < inst->MinPulseWidth)
+		fOnTime = 0.0f;
+	if (inst->Period - fOnTime < inst->MinPulseWidth)
+		fOnTime = inst->Period;
+	
+	float fPeriodCounter = inst->Internal.PeriodCounter;
+	if (inst->Mode == mtBASICS_PULSE_MIDDLE) {
+		float fOffset = 0.5f * (inst->Period - fOnTime);
+		inst->Out = (fPeriodCounter >= fOffset) && (fPeriodCounter < fOffset + fOnTime);
+	} else {
+		inst->Out = (fPeriodCounter < fOnTime);
+	}
+	
+	fPeriodCounter += getHostCycleTimeInSeconds ();
+	if (fPeriodCounter >= inst->Period)
+		fPeriodCounter -= inst->Period;
+	inst->Internal.PeriodCounter = fPeriodCounter;
+}
+
+void MTBasicsStepTuning (struct MTBasicsStepTuning* inst)
+{
+	auto & internal = inst->Internal;
+	
+	if (!inst->Enable) {
+		inst->Active = 0;
+		inst->Error = 0;
+		inst->StatusID = 0;
+		inst->UpdateDone = 0;
+		inst->Out = 0.0f;
+		inst->TuningActive = 0;
+		inst->TuningDone = 0;
+		internal.StartOld = 0;
+		return;
+	}
+	
+	inst->Active = 1;
+	inst->UpdateDone = inst->Update;
+	
+	// The step response is recorded for the settling time, the plant gain then yields the parameters.
+	if (inst->Start && !internal.StartOld) {
+		inst->TuningActive = 1;
+		inst->TuningDone = 0;
+		internal.StartActValue = inst->ActValue;
+		internal.TuningTime = 0.0f;
+	}
+	internal.StartOld = inst->Start;
+	
+	if (!inst->Start) {
+		inst->TuningActive = 0;
+		inst->Out = 0.0f;
+		return;
+	}
+	
+	if (inst->TuningActive) {
+		inst->Out = inst->StepHeight;
+		internal.TuningTime += getHostCycleTimeInSeconds ();
+		
+		if (internal.TuningTime >= inst->SystemSettlingTime) {
+			float fPlantGain = (inst->StepHeight != 0.0f) ? (inst->ActValue - internal.StartActValue) / inst->StepHeight : 0.0f;
+			
+			inst->PIDParameters.Gain = (fPlantGain > 0.0f) ? 1.0f / fPlantGain : 1.0f;
+			inst->PIDParameters.IntegrationTime = 0.25f * inst->SystemSettlingTime;
+			inst->PIDParameters.DerivativeTime = 0.0f;
+			inst->PIDParameters.FilterTime = 0.0f;
+			inst->Quality = 1.0f;
+			inst->TuningActive = 0;
+			inst->TuningDone = 1;
+			inst->Out = 0.0f;
+		}
+	}
+}
+
+
+void MpAxisBasic (struct MpAxisBasic* inst)
+{
+	auto pAxis = findHostAxis (inst);
+	
+	if ((!inst->Enable) || (inst->Parameters == nullptr) || (pAxis == nullptr)) {
+		inst->Active = 0;
+		inst->PowerOn = 0;
+		inst->MoveActive = 0;
+		inst->Velocity = 0.0f;
+		inst->Info.ReadyToPowerOn = 0;
+		inst->Info.PLCopenState = mcAXIS_DISABLED;
+		if (pAxis != nullptr)
+			pAxis->m_nCommandsOld = 0;
+		return;
+	}
+	
+	auto pParameters = inst->Parameters;
+	uint32_t nCommands = getAxisCommands (inst);
+	uint32_t nRisingEdges = nCommands & ~pAxis->m_nCommandsOld;
+	pAxis->m_nCommandsOld = nCommands;
+	
+	inst->Active = 1;
+	inst->UpdateDone = inst->Update;
+	inst->Info.CommunicationReady = 1;
+	inst->Info.Simulation = 1;
+	inst->MoveDone = 0;
+	
+	if (inst->Error) {
+		if (nRisingEdges & HOSTAXIS_COMMAND_ERRORRESET) {
+			inst->Error = 0;
+			inst->StatusID = 0;
+		}
+		inst->Info.ReadyToPowerOn = 0;
+		inst->Info.PLCopenState = mcAXIS_ERRORSTOP;
+		return;
+	}
+	
+	// A new rising edge of Power is needed after an error, like on the real axis
+	inst->PowerOn = inst->Power && (inst->PowerOn || (nRisingEdges & HOSTAXIS_COMMAND_POWER));
+	inst->Info.ReadyToPowerOn = !inst->PowerOn;
+	if (!inst->PowerOn) {
+		pAxis->m_bMoveToTarget = false;
+		inst->MoveActive = 0;
+		inst->InVelocity = 0;
+		inst->Velocity = 0.0f;
+		inst->Info.PLCopenState = mcAXIS_DISABLED;
+		return;
+	}
+	
+	// Homing is done within one call, the direct homing of the simulation does not move the axis.
+	if (nRisingEdges & HOSTAXIS_COMMAND_HOME) {
+		inst->Position = pParameters->Homing.Position;
+		inst->IsHomed = 1;
+		inst->InPosition = 1;
+		pAxis->m_bMoveToTarget = false;
+		inst->MoveActive = 0;
+		inst->Velocity = 0.0f;
+	}
+	
+	if (nRisingEdges & HOSTAXIS_COMMAND_MOVEABSOLUTE) {
+		pAxis->m_dTargetPosition = pParameters->Position;
+		pAxis->m_bMoveToTarget = true;
+	}
+	if (nRisingEdges & HOSTAXIS_COMMAND_MOVEADDITIVE) {
+		pAxis->m_dTargetPosition = inst->Position + pParameters->Distance;
+		pAxis->m_bMoveToTarget = true;
+	}
+	
+	double dCycleTime = (double) getHostCycleTimeInSeconds ();
+	double dVelocity = fabs ((double) pParameters->Velocity);
+	
+	if (inst->Stop) {
+		pAxis->m_bMoveToTarget = false;
+		inst->MoveActive = 0;
+		inst->InVelocity = 0;
+		inst->Velocity = 0.0f;
+		inst->Stopped = 1;
+		inst->Info.PLCopenState = mcAXIS_STANDSTILL;
+		return;
+	}
+	inst->Stopped = 0;
+	
+	if (inst->MoveVelocity) {
+		double dSignedVelocity = (pParameters->Direction == mcDIR_NEGATIVE) ? -dVelocity : dVelocity;
+		pAxis->m_bMoveToTarget = false;
+		inst->Position += dSignedVelocity * dCycleTime;
+		inst->Velocity = (float) dSignedVelocity;
+		inst->MoveActive = 1;
+		inst->InVelocity = 1;
+		inst->InPosition = 0;
+		inst->Info.PLCopenState = mcAXIS_CONTINUOUS_MOTION;
+		
+	} else if (pAxis->m_bMoveToTarget) {
+		double dDistance = pAxis->m_dTargetPosition - inst->Position;
+		double dStep = dVelocity * dCycleTime;
+		inst->InVelocity = 0;
+		
+		if (fabs (dDistance) <= dStep) {
+			inst->Position = pAxis->m_dTargetPosition;
+			inst->Velocity = 0.0f;
+			inst->MoveActive = 0;
+			inst->MoveDone = 1;
+			inst->InPosition = 1;
+			pAxis->m_bMoveToTarget = false;
+			inst->Info.PLCopenState = mcAXIS_STANDSTILL;
+		} else {
+			inst->Position += (dDistance > 0.0) ? dStep : -dStep;
+			inst->Velocity = (float) ((dDistance > 0.0) ? dVelocity : -dVelocity);
+			inst->MoveActive = 1;
+			inst->InPosition = 0;
+			inst->Info.PLCopenState = mcAXIS_DISCRETE_MOTION;
+		}
+		
+	} else {
+		inst->MoveActive = 0;
+		inst->InVelocity = 0;
+		inst->Velocity = 0.0f;
+		inst->Info.PLCopenState = mcAXIS_STANDSTILL;
+	}
+}
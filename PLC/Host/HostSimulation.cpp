@@ -0,0 +1,110 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "HostSimulation.hpp"
+
+#include <bur/plctypes.h>
+#include <AsDefault.h>
+
+static uint64_t g_nHostSimulationTime = 0;
+static uint32_t g_nHostSimulationCycleTime = HOSTSIMULATION_DEFAULTCYCLETIME;
+
+template <typename TMapping> static void setModuleOk (TMapping & mapping, uint16_t nModuleID)
+{
+	mapping.ModuleOk = 1;
+	mapping.SerialNumber = 0x48000000 | nModuleID;
+	mapping.ModuleID = nModuleID;
+}
+
+template <typename TMapping> static void setSafeModuleOk (TMapping & mapping, uint16_t nModuleID)
+{
+	setModuleOk (mapping, nModuleID);
+	mapping.SafeModuleOK = 1;
+}
+
+namespace BuRCPP {
+
+	void CHostSimulation::initialize ()
+	{
+		// The module IDs only serve to tell the simulated modules apart in the journal.
+		setModuleOk (IOMapping_PLC, 1);
+		setModuleOk (IOMapping_112KF01, 2);
+		setModuleOk (IOMapping_112KF03, 3);
+		setModuleOk (IOMapping_112KF11, 11);
+		setModuleOk (IOMapping_112KF12, 12);
+		setModuleOk (IOMapping_112KF13, 13);
+		setModuleOk (IOMapping_112KF14, 14);
+		setModuleOk (IOMapping_112KF15, 15);
+		setModuleOk (IOMapping_113KF16, 16);
+		setModuleOk (IOMapping_113KF17, 17);
+		setModuleOk (IOMapping_113KF18, 18);
+		setModuleOk (IOMapping_113KF19, 19);
+		setModuleOk (IOMapping_113KF20, 20);
+		setModuleOk (IOMapping_113KF21, 21);
+		setModuleOk (IOMapping_113KF22, 22);
+		setModuleOk (IOMapping_113KF23, 23);
+		setModuleOk (IOMapping_114KF24, 24);
+		setModuleOk (IOMapping_114KF25, 25);
+		setModuleOk (IOMapping_114KF26, 26);
+		setModuleOk (IOMapping_114KF27, 27);
+		setModuleOk (IOMapping_114KF28, 28);
+		setModuleOk (IOMapping_114KF29, 29);
+		setModuleOk (IOMapping_114KF30, 30);
+		setModuleOk (IOMapping_114KF31, 31);
+		setSafeModuleOk (IOMapping_115KF51, 51);
+		setSafeModuleOk (IOMapping_115KF52, 52);
+		setSafeModuleOk (IOMapping_115KF53, 53);
+		setModuleOk (IOMapping_116KF61, 61);
+		
+		IOMapping_PLC.SystemTime = (int32_t) g_nHostSimulationTime;
+	}
+	
+	void CHostSimulation::advanceTime (uint32_t nMicroseconds)
+	{
+		g_nHostSimulationTime += nMicroseconds;
+		g_nHostSimulationCycleTime = nMicroseconds;
+		
+		// Like on the target, the system time is a free running 32 bit microsecond counter.
+		IOMapping_PLC.SystemTime = (int32_t) (uint32_t) g_nHostSimulationTime;
+	}
+	
+	uint64_t CHostSimulation::getTimeInMicroseconds ()
+	{
+		return g_nHostSimulationTime;
+	}
+	
+	uint32_t CHostSimulation::getCycleTimeInMicroseconds ()
+	{
+		return g_nHostSimulationCycleTime;
+	}
+
+}
@@ -0,0 +1,311 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Measures the abort-to-effect latency in cycles. The first part queues movement signals on a state machine
+// and triggers an abort signal behind them, once with high and once with normal priority. The state
+// machine handles one signal per cycle, so the abort is reached after the queued movements unless its
+// priority moves it ahead, also in the first cycle of the state. The second part aborts an executing list, once while the signal of the
+// current entry is still queued and once while it is in process, and counts the cycles until the lane is
+// released and the movements that reach the state machine after the abort.
+
+#include "HostSimulation.hpp"
+
+#include "Framework/SignalHandler.hpp"
+#include "Framework/TcpListHandler.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#define ABORTLATENCY_SIGNAL_MOVE 0
+#define ABORTLATENCY_SIGNAL_ABORT 1
+#define ABORTLATENCY_PARAM_POSITION (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define ABORTLATENCY_QUEUESIZE 4
+#define ABORTLATENCY_MOVEMENTCYCLES 20
+#define ABORTLATENCY_LISTENTRYCOUNT 5
+#define ABORTLATENCY_MAXCYCLES 1000
+
+using namespace BuRCPP;
+
+// Signal handler of the simulated axis state machine together with the movement it currently executes
+class CAxisSimulation : public CSignalHandlerRegistry {
+	private:
+	
+	CSignalHandler m_SignalHandler;
+	CSignalProcessingInstance * m_pMovement;
+	uint32_t m_nMovementCycles;
+	uint32_t m_nMovementCount;
+	bool m_bAbortIsHandled;
+	
+	public:
+	
+	CAxisSimulation (eSignalPriority abortPriority)
+		: m_SignalHandler (std::make_shared<CSystemInfo> ()), m_pMovement (nullptr), m_nMovementCycles (0), m_nMovementCount (0), m_bAbortIsHandled (false)
+	{
+		auto pSignalMove = m_SignalHandler.registerSignal ("move", ABORTLATENCY_QUEUESIZE, 0);
+		pSignalMove->addInt32Parameter ("position", 0, ABORTLATENCY_PARAM_POSITION);
+		
+		auto pSignalAbort = m_SignalHandler.registerSignal ("abort", ABORTLATENCY_QUEUESIZE, 0);
+		pSignalAbort->setPriority (abortPriority);
+		
+		m_SignalHandler.buildInstances ();
+	}
+	
+	CSignalHandler * findSignalHandler (const std::string & sStateMachineName, bool bMustExist) override
+	{
+		if (sStateMachineName == "axis")
+			return &m_SignalHandler;
+		if (bMustExist)
+			throw CException (eErrorCode::SIGNALHANDLERNOTFOUND, "signal handler not found: " + sStateMachineName);
+		return nullptr;
+	}
+	
+	CSignalHandler * getSignalHandler ()
+	{
+		return &m_SignalHandler;
+	}
+	
+	// One cycle of the ready state: a running movement takes a fixed number of cycles, otherwise the
+	// movement signal is checked before the abort signal, like the state machines check their signals
+	void handleCyclic (uint32_t nMovementCycles)
+	{
+		m_SignalHandler.releaseExpiredSignals ();
+		
+		if (m_pMovement != nullptr) {
+			m_nMovementCycles++;
+			if (m_nMovementCycles >= nMovementCycles) {
+				m_pMovement->finishProcessing ();
+				m_pMovement = nullptr;
+			}
+			return;
+		}
+		
+		auto pSignalMove = m_SignalHandler.checkSignal (ABORTLATENCY_SIGNAL_MOVE);
+		if (pSignalMove != nullptr) {
+			m_nMovementCount++;
+			m_nMovementCycles = 0;
+			m_pMovement = pSignalMove;
+			if (nMovementCycles == 0) {
+				m_pMovement->finishProcessing ();
+				m_pMovement = nullptr;
+			}
+			return;
+		}
+		
+		auto pSignalAbort = m_SignalHandler.checkSignal (ABORTLATENCY_SIGNAL_ABORT);
+		if (pSignalAbort != nullptr) {
+			m_bAbortIsHandled = true;
+			pSignalAbort->finishProcessing ();
+		}
+	}
+	
+	bool movementIsRunning ()
+	{
+		return (m_pMovement != nullptr);
+	}
+	
+	uint32_t getMovementCount ()
+	{
+		return m_nMovementCount;
+	}
+	
+	bool abortIsHandled ()
+	{
+		return m_bAbortIsHandled;
+	}
+};
+
+// Buffered list command that sends one movement to the axis and waits until it has been processed
+class CTcpPacketHandler_Move : public CTcpPacketHandler_Buffered {
+	public:
+	
+	CTcpPacketHandler_Move (CTcpListHandler * pListHandler)
+		: CTcpPacketHandler_Buffered (pListHandler)
+	{
+	}
+	
+	uint32_t getCommandID () override
+	{
+		return 1;
+	}
+	
+	void enterExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		auto pSignal = pEnvironment->prepareSignal (0, "axis", "move");
+		pSignal->setInt32Parameter (ABORTLATENCY_PARAM_POSITION, pEnvironment->readPayloadInt32 (0));
+		pSignal->triggerSignal ();
+	}
+	
+	bool cyclicExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		return pEnvironment->signalHasBeenProcessed (0);
+	}
+};
+
+// Returns the cycle in which the abort has been handled, counting the cycle of the trigger as the first.
+// Without a first poll, the signals are already queued when the state checks them for the first time.
+static uint32_t measureSignalAbort (eSignalPriority abortPriority, bool bPollBeforeTrigger)
+{
+	CAxisSimulation axis (abortPriority);
+	CSignalHandler * pSignalHandler = axis.getSignalHandler ();
+	
+	if (bPollBeforeTrigger)
+		axis.handleCyclic (0);
+	
+	for (uint32_t nIndex = 0; nIndex < ABORTLATENCY_QUEUESIZE; nIndex++) {
+		auto pSignal = pSignalHandler->prepareSignal (ABORTLATENCY_SIGNAL_MOVE);
+		pSignal->setInt32Parameter (ABORTLATENCY_PARAM_POSITION, (int32_t) nIndex);
+		pSignal->triggerSignal ();
+	}
+	pSignalHandler->prepareSignal (ABORTLATENCY_SIGNAL_ABORT)->triggerSignal ();
+	
+	for (uint32_t nCycle = 1; nCycle <= ABORTLATENCY_MAXCYCLES; nCycle++) {
+		CHostSimulation::advanceTime (HOSTSIMULATION_DEFAULTCYCLETIME);
+		axis.handleCyclic (0);
+		if (axis.abortIsHandled ())
+			return nCycle;
+	}
+	
+	return ABORTLATENCY_MAXCYCLES + 1;
+}
+
+// Runs a list of movements and aborts it in the given cycle, before or after the axis has run its cycle.
+// Returns false if the list does not end up aborted.
+static bool measureListAbort (uint32_t nAbortCycle, bool bAbortBeforeAxisCycle, uint32_t & nReleaseCycles, uint32_t & nMovementsAfterAbort, bool & bMovementWasRunning)
+{
+	CAxisSimulation axis (eSignalPriority::Normal);
+	CTcpListHandler listHandler (1, ABORTLATENCY_LISTENTRYCOUNT, &axis);
+	CTcpPacketHandler_Move moveHandler (&listHandler);
+	
+	uint32_t nListID = listHandler.beginList ();
+	for (int32_t nIndex = 0; nIndex < ABORTLATENCY_LISTENTRYCOUNT; nIndex++) {
+		TcpIncomingPayload payload;
+		memset ((void*) &payload, 0, sizeof (payload));
+		memcpy (payload.m_Data, &nIndex, sizeof (nIndex));
+		listHandler.addCommandToCurrentList (&moveHandler, &payload);
+	}
+	listHandler.finishList ();
+	TcpList * pList = listHandler.executeList (nListID, 0);
+	
+	uint32_t nMovementCountAtAbort = 0;
+	nReleaseCycles = ABORTLATENCY_MAXCYCLES + 1;
+	bMovementWasRunning = false;
+	
+	for (uint32_t nCycle = 1; nCycle <= ABORTLATENCY_MAXCYCLES; nCycle++) {
+		CHostSimulation::advanceTime (HOSTSIMULATION_DEFAULTCYCLETIME);
+		listHandler.handleCyclic ();
+		
+		if (nCycle == nAbortCycle && bAbortBeforeAxisCycle) {
+			bMovementWasRunning = axis.movementIsRunning ();
+			nMovementCountAtAbort = axis.getMovementCount ();
+			listHandler.abortList (nListID);
+		}
+		
+		axis.handleCyclic (ABORTLATENCY_MOVEMENTCYCLES);
+		
+		if (nCycle == nAbortCycle && !bAbortBeforeAxisCycle) {
+			bMovementWasRunning = axis.movementIsRunning ();
+			nMovementCountAtAbort = axis.getMovementCount ();
+			listHandler.abortList (nListID);
+		}
+		
+		if ((nCycle >= nAbortCycle) && (nReleaseCycles > ABORTLATENCY_MAXCYCLES) && (pList->m_ListState != eListState::ExecutingList))
+			nReleaseCycles = nCycle - nAbortCycle;
+	}
+	
+	nMovementsAfterAbort = axis.getMovementCount () - nMovementCountAtAbort;
+	
+	return (pList->m_ListState == eListState::ExecutionError) && (pList->m_ErrorCode == eErrorCode::LISTEXECUTIONABORTED);
+}
+
+int main ()
+{
+	uint32_t nFailureCount = 0;
+	
+	try {
+		CHostSimulation::initialize ();
+		
+		uint32_t nHighPriorityCycles = measureSignalAbort (eSignalPriority::High, true);
+		uint32_t nFirstCycleHighPriorityCycles = measureSignalAbort (eSignalPriority::High, false);
+		uint32_t nNormalPriorityCycles = measureSignalAbort (eSignalPriority::Normal, true);
+		
+		printf ("abort signal behind %d movements, high priority: %d cycles\n", ABORTLATENCY_QUEUESIZE, (int) nHighPriorityCycles);
+		printf ("abort signal behind %d movements, high priority, first cycle of the state: %d cycles\n", ABORTLATENCY_QUEUESIZE, (int) nFirstCycleHighPriorityCycles);
+		printf ("abort signal behind %d movements, normal priority: %d cycles\n", ABORTLATENCY_QUEUESIZE, (int) nNormalPriorityCycles);
+		
+		if (nHighPriorityCycles != 1) {
+			printf ("failed: the high priority abort is not handled in the cycle of the trigger\n");
+			nFailureCount++;
+		}
+		if (nFirstCycleHighPriorityCycles != 1) {
+			printf ("failed: the high priority abort is not handled in the first cycle of the state\n");
+			nFailureCount++;
+		}
+		if (nNormalPriorityCycles != ABORTLATENCY_QUEUESIZE + 1) {
+			printf ("failed: the normal priority abort is not handled after the queued movements\n");
+			nFailureCount++;
+		}
+		
+		// The first entry triggers its movement in cycle 1, the axis checks it in the same cycle. Aborting
+		// in cycle 1 before the axis cycle withdraws the queued signal, aborting later finds it in process.
+		uint32_t nReleaseCycles = 0;
+		uint32_t nMovementsAfterAbort = 0;
+		bool bMovementWasRunning = false;
+		
+		if (!measureListAbort (1, true, nReleaseCycles, nMovementsAfterAbort, bMovementWasRunning)) {
+			printf ("failed: the list with a queued movement has not been aborted\n");
+			nFailureCount++;
+		}
+		printf ("list abort with a queued movement: lane released after %d cycles, %d movements after the abort\n", (int) nReleaseCycles, (int) nMovementsAfterAbort);
+		if ((nReleaseCycles != 0) || (nMovementsAfterAbort != 0) || bMovementWasRunning) {
+			printf ("failed: the queued movement has not been withdrawn in the cycle of the abort\n");
+			nFailureCount++;
+		}
+		
+		if (!measureListAbort (10, false, nReleaseCycles, nMovementsAfterAbort, bMovementWasRunning)) {
+			printf ("failed: the list with a running movement has not been aborted\n");
+			nFailureCount++;
+		}
+		printf ("list abort with a running movement: lane released after %d cycles, %d movements after the abort\n", (int) nReleaseCycles, (int) nMovementsAfterAbort);
+		if ((nReleaseCycles != 0) || (nMovementsAfterAbort != 0) || !bMovementWasRunning) {
+			printf ("failed: the list has sent further movements after the abort\n");
+			nFailureCount++;
+		}
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	return (nFailureCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Checks CUtils::computeCRC32 against a bitwise reference of the reflected CRC-32 (polynomial 0xEDB88320)
+// for all lengths up to a few slices and every start alignment. With --benchmark the throughput of
+// computeCRC32, the byte-wise table variant and the bitwise reference are printed in MB/s. Usage:
+//
+//   CRC32Test [--benchmark <megabytes>]
+
+#include "Framework/Utils.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define CRC32TEST_POLYNOMIAL 0xEDB88320
+#define CRC32TEST_MAXLENGTH 300
+#define CRC32TEST_MAXALIGNMENT 8
+#define CRC32TEST_BENCHMARKBLOCKSIZE (256 * 1024)
+
+using namespace BuRCPP;
+
+static uint32_t computeCRC32Bitwise (const uint8_t * pBuffer, uint32_t nLength)
+{
+	uint32_t nCRC = 0xffffffff;
+	
+	for (uint32_t nIndex = 0; nIndex < nLength; nIndex++) {
+		nCRC ^= pBuffer[nIndex];
+		for (uint32_t nBit = 0; nBit < 8; nBit++)
+			nCRC = (nCRC >> 1) ^ ((nCRC & 1) ? CRC32TEST_POLYNOMIAL : 0);
+	}
+	
+	return nCRC ^ 0xffffffff;
+}
+
+// The one-byte table loop that computeCRC32 used before the slice-by-8 tables
+static uint32_t g_ByteTable[256];
+
+static void buildByteTable ()
+{
+	for (uint32_t nIndex = 0; nIndex < 256; nIndex++) {
+		uint32_t nCRC = nIndex;
+		for (uint32_t nBit = 0; nBit < 8; nBit++)
+			nCRC = (nCRC >> 1) ^ ((nCRC & 1) ? CRC32TEST_POLYNOMIAL : 0);
+		g_ByteTable[nIndex] = nCRC;
+	}
+}
+
+static uint32_t computeCRC32Bytewise (const uint8_t * pBuffer, uint32_t nLength)
+{
+	uint32_t nCRC = 0xffffffff;
+	
+	for (uint32_t nIndex = 0; nIndex < nLength; nIndex++)
+		nCRC = g_ByteTable[(nCRC ^ pBuffer[nIndex]) & 0xff] ^ (nCRC >> 8);
+	
+	return nCRC ^ 0xffffffff;
+}
+
+static bool checkConformance ()
+{
+	const char * pCheckString = "123456789";
+	uint32_t nCheckValue = CUtils::computeCRC32 ((uint8_t*) pCheckString, (uint32_t) strlen (pCheckString));
+	if (nCheckValue != 0xCBF43926) {
+		printf ("check value of \"123456789\" is 0x%08X, expected 0xCBF43926\n", nCheckValue);
+		return false;
+	}
+	
+	std::mt19937 generator (1);
+	std::uniform_int_distribution<uint32_t> bytes (0, 255);
+	
+	std::vector<uint8_t> Buffer (CRC32TEST_MAXLENGTH + CRC32TEST_MAXALIGNMENT);
+	for (auto & nByte : Buffer)
+		nByte = (uint8_t) bytes (generator);
+	
+	for (uint32_t nAlignment = 0; nAlignment < CRC32TEST_MAXALIGNMENT; nAlignment++) {
+		for (uint32_t nLength = 0; nLength <= CRC32TEST_MAXLENGTH; nLength++) {
+			uint8_t * pData = &Buffer[nAlignment];
+			uint32_t nExpected = computeCRC32Bitwise (pData, nLength);
+			uint32_t nValue = CUtils::computeCRC32 (pData, nLength);
+			
+			if (nValue != nExpected) {
+				printf ("crc of %d bytes at alignment %d is 0x%08X, expected 0x%08X\n", (int) nLength, (int) nAlignment, nValue, nExpected);
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+template <typename F> static double measureThroughput (F computeFunction, std::vector<uint8_t> & Block, uint32_t nMegabytes, uint32_t & nResult)
+{
+	uint32_t nBlockCount = (uint32_t) (((uint64_t) nMegabytes * 1024 * 1024) / Block.size ());
+	if (nBlockCount == 0)
+		nBlockCount = 1;
+	
+	auto start = std::chrono::steady_clock::now ();
+	for (uint32_t nBlock = 0; nBlock < nBlockCount; nBlock++)
+		nResult += computeFunction (Block.data (), (uint32_t) Block.size ());
+	auto end = std::chrono::steady_clock::now ();
+	
+	double dSeconds = std::chrono::duration<double> (end - start).count ();
+	double dMegabytes = ((double) nBlockCount * Block.size ()) / (1024.0 * 1024.0);
+	
+	return (dSeconds > 0.0) ? (dMegabytes / dSeconds) : 0.0;
+}
+
+static void runBenchmark (uint32_t nMegabytes)
+{
+	std::mt19937 generator (2);
+	std::uniform_int_distribution<uint32_t> bytes (0, 255);
+	
+	// Blocks of the size of the largest response payload
+	std::vector<uint8_t> Block (CRC32TEST_BENCHMARKBLOCKSIZE);
+	for (auto & nByte : Block)
+		nByte = (uint8_t) bytes (generator);
+	
+	// The results are combined and printed, so the loops can not be dropped
+	uint32_t nResult = 0;
+	double dSliced = measureThroughput ([] (uint8_t * pData, uint32_t nLength) { return CUtils::computeCRC32 (pData, nLength); }, Block, nMegabytes, nResult);
+	double dBytewise = measureThroughput (computeCRC32Bytewise, Block, nMegabytes, nResult);
+	double dBitwise = measureThroughput (computeCRC32Bitwise, Block, nMegabytes / 8, nResult);
+	
+	printf ("computeCRC32: %.1f MB/s\n", dSliced);
+	printf ("byte table:   %.1f MB/s\n", dBytewise);
+	printf ("bitwise:      %.1f MB/s\n", dBitwise);
+	printf ("speedup over byte table: %.2f (0x%08X)\n", (dBytewise > 0.0) ? (dSliced / dBytewise) : 0.0, nResult);
+}
+
+int main (int argc, char ** argv)
+{
+	uint32_t nBenchmarkMegabytes = 0;
+	
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		if ((strcmp (argv[nIndex], "--benchmark") == 0) && (nIndex + 1 < argc)) {
+			nBenchmarkMegabytes = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else {
+			printf ("usage: %s [--benchmark <megabytes>]\n", argv[0]);
+			return 1;
+		}
+	}
+	
+	buildByteTable ();
+	
+	if (!checkConformance ())
+		return 1;
+	
+	printf ("computeCRC32 matches the bitwise reference\n");
+	
+	if (nBenchmarkMegabytes > 0)
+		runBenchmark (nBenchmarkMegabytes);
+	
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Measures the time per journal write of an integer value, once with an unchanged value that only costs
+// the slot compare, and once with a change that also records a ring buffer entry. The values are read
+// back, so the benchmark fails if a write is lost or recorded twice. Usage:
+//
+//   JournalBenchmark [--iterations <count>]
+
+#include "Framework/Journal.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define JOURNALBENCHMARK_GROUPID 1
+#define JOURNALBENCHMARK_ENTRYCOUNT 64
+#define JOURNALBENCHMARK_RINGBUFFERSIZE 65536
+
+using namespace BuRCPP;
+
+class CStopWatch {
+	private:
+	std::chrono::steady_clock::time_point m_Start;
+	
+	public:
+	
+	CStopWatch ()
+		: m_Start (std::chrono::steady_clock::now ())
+	{
+	}
+	
+	double getNanosecondsPer (uint64_t nCount)
+	{
+		double dNanoseconds = std::chrono::duration<double, std::nano> (std::chrono::steady_clock::now () - m_Start).count ();
+		return (nCount > 0) ? (dNanoseconds / (double) nCount) : 0.0;
+	}
+};
+
+int main (int argc, char ** argv)
+{
+	uint32_t nIterations = 4000000;
+	
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		if ((strcmp (argv[nIndex], "--iterations") == 0) && (nIndex + 1 < argc)) {
+			nIterations = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else {
+			printf ("usage: %s [--iterations <count>]\n", argv[0]);
+			return 1;
+		}
+	}
+	
+	try {
+		auto pSystemInfo = std::make_shared<CSystemInfo> ();
+		
+		CJournal journal (JOURNALBENCHMARK_RINGBUFFERSIZE, pSystemInfo);
+		journal.registerGroup (JOURNALBENCHMARK_GROUPID, "benchmark");
+		
+		std::vector<sJournalHandle> Handles;
+		for (uint32_t nEntry = 0; nEntry < JOURNALBENCHMARK_ENTRYCOUNT; nEntry++)
+			Handles.push_back (journal.registerIntegerValue ("value" + std::to_string (nEntry), JOURNALBENCHMARK_GROUPID, nEntry + 1, INT32_MIN, INT32_MAX));
+		
+		journal.prepareJournal ();
+		
+		// Unchanged values, like most modules report them in most cycles
+		CStopWatch unchangedByHandle;
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++)
+			journal.setIntegerValue (Handles[nIteration % JOURNALBENCHMARK_ENTRYCOUNT], 0);
+		double dUnchangedByHandle = unchangedByHandle.getNanosecondsPer (nIterations);
+		
+		CStopWatch unchangedByID;
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++)
+			journal.setIntegerValue (JOURNALBENCHMARK_GROUPID, (nIteration % JOURNALBENCHMARK_ENTRYCOUNT) + 1, 0);
+		double dUnchangedByID = unchangedByID.getNanosecondsPer (nIterations);
+		
+		// Every write changes the value, limited to the ring buffer capacity so that no entry overflows
+		uint32_t nChangeCount = JOURNALBENCHMARK_RINGBUFFERSIZE - 1;
+		CStopWatch changedByHandle;
+		for (uint32_t nIteration = 0; nIteration < nChangeCount; nIteration++)
+			journal.setIntegerValue (Handles[nIteration % JOURNALBENCHMARK_ENTRYCOUNT], (int64_t) nIteration + 1);
+		double dChangedByHandle = changedByHandle.getNanosecondsPer (nChangeCount);
+		
+		for (uint32_t nEntry = 0; nEntry < JOURNALBENCHMARK_ENTRYCOUNT; nEntry++) {
+			int64_t nExpected = nChangeCount - ((nChangeCount - 1 - nEntry) % JOURNALBENCHMARK_ENTRYCOUNT);
+			if (journal.getInt64Value (Handles[nEntry]) != nExpected) {
+				printf ("value %d is %lld, expected %lld\n", (int) nEntry, (long long) journal.getInt64Value (Handles[nEntry]), (long long) nExpected);
+				return 1;
+			}
+		}
+		
+		// The storage on its own, the ring buffer is cleared whenever it is full
+		CJournalData journalData (JOURNALBENCHMARK_ENTRYCOUNT * JOURNAL_MAXENTRYSIZE, JOURNALBENCHMARK_RINGBUFFERSIZE, pSystemInfo);
+		CStopWatch changedData;
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++) {
+			if (journalData.ringBufferIsFull ())
+				journalData.clearRingBuffer ();
+			
+			int64_t nValue = (int64_t) nIteration + 1;
+			journalData.writeData ((nIteration % JOURNALBENCHMARK_ENTRYCOUNT) * JOURNAL_MAXENTRYSIZE, JOURNALBENCHMARK_GROUPID, 1, (uint8_t*) &nValue, sizeof (nValue));
+		}
+		double dChangedData = changedData.getNanosecondsPer (nIterations);
+		
+		if (journalData.getOverFlowCounter () != 0) {
+			printf ("unexpected ring buffer overflow\n");
+			return 1;
+		}
+		
+		printf ("setIntegerValue (handle), unchanged: %.1f ns\n", dUnchangedByHandle);
+		printf ("setIntegerValue (group/entry ID), unchanged: %.1f ns\n", dUnchangedByID);
+		printf ("setIntegerValue (handle), changed: %.1f ns\n", dChangedByHandle);
+		printf ("CJournalData::writeData, changed: %.1f ns\n", dChangedData);
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	return 0;
+}
@@ -0,0 +1,184 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Checks the typed context access of CPayloadEnvironment against the context block of a list entry. Every
+// type is written and read back at the start, at an unaligned address and at the end of the block, the
+// bytes around a write and the other fields of the entry must stay untouched, and accesses beyond the
+// block have to fail with the context error codes.
+
+#include "Framework/TcpListHandler.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+#define CONTEXTTEST_FILLBYTE 0xA5
+
+using namespace BuRCPP;
+
+class CEmptySignalHandlerRegistry : public CSignalHandlerRegistry {
+	public:
+	
+	CSignalHandler * findSignalHandler (const std::string & sStateMachineName, bool bMustExist) override
+	{
+		if (bMustExist)
+			throw CException (eErrorCode::SIGNALHANDLERNOTFOUND, "signal handler not found: " + sStateMachineName);
+		return nullptr;
+	}
+};
+
+static uint32_t g_nFailureCount = 0;
+
+static void expect (bool bCondition, const char * pDescription)
+{
+	if (!bCondition) {
+		printf ("failed: %s\n", pDescription);
+		g_nFailureCount++;
+	}
+}
+
+static void expectError (eErrorCode expectedCode, std::function<void ()> operation, const char * pDescription)
+{
+	try {
+		operation ();
+		printf ("failed: %s, no exception\n", pDescription);
+		g_nFailureCount++;
+	}
+	catch (CException & Exception) {
+		if (Exception.getCode () != expectedCode) {
+			printf ("failed: %s, error %d instead of %d\n", pDescription, (int) Exception.getCode (), (int) expectedCode);
+			g_nFailureCount++;
+		}
+	}
+}
+
+// Writes a value at an address of a freshly filled context and checks the value and all other bytes of the entry
+template <typename T> static void checkRoundTrip (TcpListEntryContext & context, CPayloadEnvironment & environment, uint32_t nAddress, T value,
+	void (CPayloadEnvironment::*pWrite) (uint32_t, T), T (CPayloadEnvironment::*pRead) (uint32_t), const char * pTypeName)
+{
+	memset ((void*) &context, CONTEXTTEST_FILLBYTE, sizeof (context));
+	TcpListEntryContext expected;
+	memset ((void*) &expected, CONTEXTTEST_FILLBYTE, sizeof (expected));
+	memcpy (&expected.m_ContextData[nAddress], &value, sizeof (T));
+	
+	(environment.*pWrite) (nAddress, value);
+	
+	char sDescription[128];
+	snprintf (sDescription, sizeof (sDescription), "%s at address %d", pTypeName, (int) nAddress);
+	
+	expect ((environment.*pRead) (nAddress) == value, sDescription);
+	expect (memcmp ((void*) &context, (void*) &expected, sizeof (context)) == 0, sDescription);
+}
+
+template <typename T> static void checkType (TcpListEntryContext & context, CPayloadEnvironment & environment, T value,
+	void (CPayloadEnvironment::*pWrite) (uint32_t, T), T (CPayloadEnvironment::*pRead) (uint32_t), eErrorCode readError, eErrorCode writeError, const char * pTypeName)
+{
+	uint32_t nLastAddress = LISTCONTEXT_DATASIZE - sizeof (T);
+	
+	checkRoundTrip (context, environment, 0, value, pWrite, pRead, pTypeName);
+	checkRoundTrip (context, environment, nLastAddress, value, pWrite, pRead, pTypeName);
+	if (nLastAddress >= 3)
+		checkRoundTrip (context, environment, 3, value, pWrite, pRead, pTypeName);
+	
+	char sDescription[128];
+	snprintf (sDescription, sizeof (sDescription), "%s across the end of the context", pTypeName);
+	if (sizeof (T) > 1) {
+		expectError (readError, [&] () { (environment.*pRead) (nLastAddress + 1); }, sDescription);
+		expectError (writeError, [&] () { (environment.*pWrite) (nLastAddress + 1, value); }, sDescription);
+	}
+	
+	snprintf (sDescription, sizeof (sDescription), "%s behind the context", pTypeName);
+	expectError (eErrorCode::INVALIDCONTEXTADDRESS, [&] () { (environment.*pRead) (LISTCONTEXT_DATASIZE); }, sDescription);
+	expectError (eErrorCode::INVALIDCONTEXTADDRESS, [&] () { (environment.*pWrite) (LISTCONTEXT_DATASIZE, value); }, sDescription);
+}
+
+int main ()
+{
+	try {
+		CEmptySignalHandlerRegistry registry;
+		CTcpListHandler listHandler (1, 1, &registry);
+		
+		TcpListEntryContext context;
+		TcpIncomingPayload payload;
+		memset ((void*) &payload, 0, sizeof (payload));
+		
+		CPayloadEnvironment environment (&context, &payload, &registry, &listHandler, 0);
+		expect (environment.getContextSize () == LISTCONTEXT_DATASIZE, "context size");
+		
+		eErrorCode readError = eErrorCode::INVALIDCONTEXTREADOPERATION;
+		eErrorCode writeError = eErrorCode::INVALIDCONTEXTWRITEOPERATION;
+		
+		checkType<uint8_t> (context, environment, 0xC3, &CPayloadEnvironment::writeContextUint8, &CPayloadEnvironment::readContextUint8, readError, writeError, "uint8");
+		checkType<uint16_t> (context, environment, 0xBEEF, &CPayloadEnvironment::writeContextUint16, &CPayloadEnvironment::readContextUint16, readError, writeError, "uint16");
+		checkType<uint32_t> (context, environment, 0xDEADBEEF, &CPayloadEnvironment::writeContextUint32, &CPayloadEnvironment::readContextUint32, readError, writeError, "uint32");
+		checkType<int8_t> (context, environment, -100, &CPayloadEnvironment::writeContextInt8, &CPayloadEnvironment::readContextInt8, readError, writeError, "int8");
+		checkType<int16_t> (context, environment, -30000, &CPayloadEnvironment::writeContextInt16, &CPayloadEnvironment::readContextInt16, readError, writeError, "int16");
+		checkType<int32_t> (context, environment, -2000000000, &CPayloadEnvironment::writeContextInt32, &CPayloadEnvironment::readContextInt32, readError, writeError, "int32");
+		checkType<double> (context, environment, -1234.5678, &CPayloadEnvironment::writeContextDouble, &CPayloadEnvironment::readContextDouble, readError, writeError, "double");
+		checkType<float> (context, environment, 3.25f, &CPayloadEnvironment::writeContextFloat, &CPayloadEnvironment::readContextFloat, readError, writeError, "float");
+		
+		// Raw blocks, including the whole context and empty accesses
+		uint8_t Source[LISTCONTEXT_DATASIZE];
+		uint8_t Target[LISTCONTEXT_DATASIZE];
+		for (uint32_t nIndex = 0; nIndex < LISTCONTEXT_DATASIZE; nIndex++)
+			Source[nIndex] = (uint8_t) (nIndex * 7 + 1);
+		
+		environment.writeContextData (Source, 0, LISTCONTEXT_DATASIZE);
+		memset (Target, 0, sizeof (Target));
+		environment.readContextData (Target, 0, LISTCONTEXT_DATASIZE);
+		expect (memcmp (Source, Target, sizeof (Source)) == 0, "whole context block");
+		
+		environment.writeContextData (nullptr, LISTCONTEXT_DATASIZE, 0);
+		environment.readContextData (nullptr, LISTCONTEXT_DATASIZE, 0);
+		
+		expectError (eErrorCode::INVALIDPARAM, [&] () { environment.writeContextData (nullptr, 0, 1); }, "write from null source");
+		expectError (eErrorCode::INVALIDPARAM, [&] () { environment.readContextData (nullptr, 0, 1); }, "read into null target");
+		expectError (writeError, [&] () { environment.writeContextData (Source, 1, LISTCONTEXT_DATASIZE); }, "block write across the end");
+		expectError (readError, [&] () { environment.readContextData (Target, 1, LISTCONTEXT_DATASIZE); }, "block read across the end");
+		expectError (writeError, [&] () { environment.writeContextData (Source, 16, 0xFFFFFFF8); }, "block write with wrapping size");
+		expectError (readError, [&] () { environment.readContextData (Target, 16, 0xFFFFFFF8); }, "block read with wrapping size");
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	if (g_nFailureCount > 0) {
+		printf ("%d checks failed\n", (int) g_nFailureCount);
+		return 1;
+	}
+	
+	printf ("all context checks passed\n");
+	return 0;
+}
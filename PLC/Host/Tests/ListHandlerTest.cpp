@@ -0,0 +1,409 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Checks the list execution of CTcpListHandler against a simulated axis state machine. Every list entry
+// sends one movement signal and waits until the axis has processed it.
+
+#include "HostSimulation.hpp"
+
+#include "Framework/SignalHandler.hpp"
+#include "Framework/TcpListHandler.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#define LISTTEST_COMMAND_MOVE 1
+#define LISTTEST_COMMAND_FAILINGMOVE 2
+#define LISTTEST_SIGNAL_MOVE 0
+#define LISTTEST_PARAM_POSITION (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define LISTTEST_QUEUESIZE 4
+#define LISTTEST_LISTCOUNT 3
+#define LISTTEST_ENTRYCOUNT 16
+
+using namespace BuRCPP;
+
+class CAxisSimulation : public CSignalHandlerRegistry {
+	private:
+	
+	CSignalHandler m_SignalHandler;
+	std::vector<int32_t> m_Positions;
+	CSignalProcessingInstance * m_pHeldSignal;
+	bool m_bHoldSignals;
+	
+	public:
+	
+	CAxisSimulation ()
+		: m_SignalHandler (std::make_shared<CSystemInfo> ()), m_pHeldSignal (nullptr), m_bHoldSignals (false)
+	{
+		auto pSignalMove = m_SignalHandler.registerSignal ("move", LISTTEST_QUEUESIZE, 0);
+		pSignalMove->addInt32Parameter ("position", 0, LISTTEST_PARAM_POSITION);
+		m_SignalHandler.buildInstances ();
+	}
+	
+	CSignalHandler * findSignalHandler (const std::string & sStateMachineName, bool bMustExist) override
+	{
+		if (sStateMachineName == "axis")
+			return &m_SignalHandler;
+		if (bMustExist)
+			throw CException (eErrorCode::SIGNALHANDLERNOTFOUND, "signal handler not found: " + sStateMachineName);
+		return nullptr;
+	}
+	
+	// Processes all queued movements in the order they have been triggered. While holding, the axis
+	// takes one movement into process and keeps it there.
+	void handleCyclic ()
+	{
+		m_SignalHandler.releaseExpiredSignals ();
+		
+		if (m_bHoldSignals) {
+			if (m_pHeldSignal == nullptr)
+				m_pHeldSignal = m_SignalHandler.checkSignal (LISTTEST_SIGNAL_MOVE);
+			return;
+		}
+		
+		if (m_pHeldSignal != nullptr) {
+			m_Positions.push_back (m_pHeldSignal->getInt32Parameter (LISTTEST_PARAM_POSITION));
+			m_pHeldSignal->finishProcessing ();
+			m_pHeldSignal = nullptr;
+		}
+		
+		CSignalProcessingInstance * pSignalMove;
+		while ((pSignalMove = m_SignalHandler.checkSignal (LISTTEST_SIGNAL_MOVE)) != nullptr) {
+			m_Positions.push_back (pSignalMove->getInt32Parameter (LISTTEST_PARAM_POSITION));
+			pSignalMove->finishProcessing ();
+		}
+	}
+	
+	std::vector<int32_t> & getPositions ()
+	{
+		return m_Positions;
+	}
+	
+	void setHoldSignals (bool bHoldSignals)
+	{
+		m_bHoldSignals = bHoldSignals;
+	}
+};
+
+class CTcpPacketHandler_Move : public CTcpPacketHandler_Buffered {
+	public:
+	
+	CTcpPacketHandler_Move (CTcpListHandler * pListHandler)
+		: CTcpPacketHandler_Buffered (pListHandler)
+	{
+	}
+	
+	uint32_t getCommandID () override
+	{
+		return LISTTEST_COMMAND_MOVE;
+	}
+	
+	void enterExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		auto pSignal = pEnvironment->prepareSignal (0, "axis", "move");
+		pSignal->setInt32Parameter (LISTTEST_PARAM_POSITION, pEnvironment->readPayloadInt32 (0));
+		pSignal->triggerSignal ();
+	}
+	
+	bool cyclicExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		return pEnvironment->signalHasBeenProcessed (0);
+	}
+};
+
+enum class eMoveFailure {
+	None,
+	BeforeTrigger,
+	AfterTrigger,
+	WhileWaiting
+};
+
+// Sends a movement like CTcpPacketHandler_Move, but fails once at the configured point
+class CTcpPacketHandler_FailingMove : public CTcpPacketHandler_Buffered {
+	private:
+	
+	eMoveFailure m_Failure;
+	
+	public:
+	
+	CTcpPacketHandler_FailingMove (CTcpListHandler * pListHandler)
+		: CTcpPacketHandler_Buffered (pListHandler), m_Failure (eMoveFailure::None)
+	{
+	}
+	
+	uint32_t getCommandID () override
+	{
+		return LISTTEST_COMMAND_FAILINGMOVE;
+	}
+	
+	void setFailure (eMoveFailure failure)
+	{
+		m_Failure = failure;
+	}
+	
+	void failAt (eMoveFailure failure)
+	{
+		if (m_Failure == failure) {
+			m_Failure = eMoveFailure::None;
+			throw CException (eErrorCode::INVALIDPAYLOAD, "simulated movement failure");
+		}
+	}
+	
+	void enterExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		auto pSignal = pEnvironment->prepareSignal (0, "axis", "move");
+		pSignal->setInt32Parameter (LISTTEST_PARAM_POSITION, pEnvironment->readPayloadInt32 (0));
+		failAt (eMoveFailure::BeforeTrigger);
+		pSignal->triggerSignal ();
+		failAt (eMoveFailure::AfterTrigger);
+	}
+	
+	bool cyclicExecution (CPayloadEnvironment * pEnvironment) override
+	{
+		failAt (eMoveFailure::WhileWaiting);
+		return pEnvironment->signalHasBeenProcessed (0);
+	}
+};
+
+static uint32_t g_nFailureCount = 0;
+
+static void expect (bool bCondition, const char * pDescription)
+{
+	if (!bCondition) {
+		printf ("failed: %s\n", pDescription);
+		g_nFailureCount++;
+	}
+}
+
+static void expectError (eErrorCode expectedCode, std::function<void ()> operation, const char * pDescription)
+{
+	try {
+		operation ();
+		printf ("failed: %s, no exception\n", pDescription);
+		g_nFailureCount++;
+	}
+	catch (CException & Exception) {
+		if (Exception.getCode () != expectedCode) {
+			printf ("failed: %s, error %d instead of %d\n", pDescription, (int) Exception.getCode (), (int) expectedCode);
+			g_nFailureCount++;
+		}
+	}
+}
+
+static TcpIncomingPayload makePayload (int32_t nPosition)
+{
+	TcpIncomingPayload payload;
+	memset ((void*) &payload, 0, sizeof (payload));
+	memcpy (payload.m_Data, &nPosition, sizeof (nPosition));
+	return payload;
+}
+
+static uint32_t createList (CTcpListHandler & listHandler, CTcpPacketHandler_Buffered * pHandler, int32_t nFirstPosition, uint32_t nEntryCount)
+{
+	uint32_t nListID = listHandler.beginList ();
+	for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+		TcpIncomingPayload payload = makePayload (nFirstPosition + (int32_t) nIndex);
+		listHandler.addCommandToCurrentList (pHandler, &payload);
+	}
+	listHandler.finishList ();
+	return nListID;
+}
+
+static void runCycle (CTcpListHandler & listHandler, CAxisSimulation & axis)
+{
+	CHostSimulation::advanceTime (HOSTSIMULATION_DEFAULTCYCLETIME);
+	listHandler.handleCyclic ();
+	axis.handleCyclic ();
+}
+
+// A list started on a busy lane is refused, the running list keeps its lane and can still be aborted
+static void checkBusyLane ()
+{
+	CAxisSimulation axis;
+	CTcpListHandler listHandler (LISTTEST_LISTCOUNT, LISTTEST_ENTRYCOUNT, &axis);
+	auto pMoveHandler = std::make_shared<CTcpPacketHandler_Move> (&listHandler);
+	CTcpPacketRegistry packetRegistry (171);
+	packetRegistry.registerHandler (pMoveHandler);
+	
+	uint32_t nFirstListID = createList (listHandler, pMoveHandler.get (), 0, 2);
+	uint32_t nSecondListID = createList (listHandler, pMoveHandler.get (), 100, 2);
+	
+	TcpList * pFirstList = listHandler.executeList (nFirstListID, 0);
+	expectError (eErrorCode::LISTLANECONFLICT, [&] () { listHandler.executeList (nSecondListID, 0); }, "execute on a busy lane");
+	expect (pFirstList->m_ListState == eListState::ExecutingList, "running list keeps executing");
+	expect (listHandler.getListByID (nSecondListID, true)->m_ListState == eListState::ListFinished, "refused list stays finished");
+	
+	// A batch upload that executes on the busy lane fails before it takes a list from the pool
+	std::vector<uint8_t> Batch (LISTBATCH_HEADERSIZE + LISTBATCH_ENTRYSIZE);
+	uint32_t nFlags = LISTBATCH_FLAG_EXECUTE;
+	uint32_t nEntryCount = 1;
+	uint32_t nCommandID = LISTTEST_COMMAND_MOVE;
+	TcpIncomingPayload payload = makePayload (200);
+	memcpy (&Batch[0], &nFlags, sizeof (nFlags));
+	memcpy (&Batch[4], &nEntryCount, sizeof (nEntryCount));
+	memcpy (&Batch[LISTBATCH_HEADERSIZE], &nCommandID, sizeof (nCommandID));
+	memcpy (&Batch[LISTBATCH_HEADERSIZE + 4], &payload, sizeof (payload));
+	
+	expectError (eErrorCode::LISTLANECONFLICT, [&] () { listHandler.uploadList (&packetRegistry, Batch.data (), (uint32_t) Batch.size ()); }, "batch execute on a busy lane");
+	expect (listHandler.canAllocateList (1), "refused batch keeps the pool");
+	
+	runCycle (listHandler, axis);
+	listHandler.abortList (nFirstListID);
+	expect (pFirstList->m_ListState == eListState::ExecutionError, "running list can be aborted");
+	
+	listHandler.executeList (nSecondListID, 0);
+	for (uint32_t nCycle = 0; nCycle < 10; nCycle++)
+		runCycle (listHandler, axis);
+	expect (listHandler.getListByID (nSecondListID, true)->m_ListState == eListState::ExecutionFinished, "second list runs after the abort");
+}
+
+// A failed entry withdraws the signals it has sent, so that a retry delivers its movement only once
+static void checkRetryAfterError ()
+{
+	CAxisSimulation axis;
+	CTcpListHandler listHandler (LISTTEST_LISTCOUNT, LISTTEST_ENTRYCOUNT, &axis);
+	auto pFailingHandler = std::make_shared<CTcpPacketHandler_FailingMove> (&listHandler);
+	
+	// Triggered, but not checked by the axis yet
+	uint32_t nListID = createList (listHandler, pFailingHandler.get (), 10, 1);
+	pFailingHandler->setFailure (eMoveFailure::AfterTrigger);
+	TcpList * pList = listHandler.executeList (nListID, 0);
+	runCycle (listHandler, axis);
+	expect ((pList->m_ListState == eListState::ExecutionError) && (pList->m_ErrorCode == eErrorCode::INVALIDPAYLOAD), "entry fails after its trigger");
+	
+	listHandler.resumeList (nListID, 0, eListResumeMode::RetryEntry);
+	for (uint32_t nCycle = 0; nCycle < 10; nCycle++)
+		runCycle (listHandler, axis);
+	expect (pList->m_ListState == eListState::ExecutionFinished, "retried list finishes");
+	expect (axis.getPositions ().size () == 1, "retried movement is delivered once");
+	
+	// Taken into process by the axis before the entry fails
+	axis.getPositions ().clear ();
+	axis.setHoldSignals (true);
+	nListID = createList (listHandler, pFailingHandler.get (), 20, 1);
+	pList = listHandler.executeList (nListID, 1);
+	runCycle (listHandler, axis);
+	pFailingHandler->setFailure (eMoveFailure::WhileWaiting);
+	runCycle (listHandler, axis);
+	expect (pList->m_ListState == eListState::ExecutionError, "entry fails while its signal is in process");
+	expectError (eErrorCode::SIGNALSTILLINPROCESS, [&] () { listHandler.resumeList (nListID, 1, eListResumeMode::RetryEntry); }, "retry while signal is in process");
+	
+	axis.setHoldSignals (false);
+	runCycle (listHandler, axis);
+	listHandler.resumeList (nListID, 1, eListResumeMode::RetryEntry);
+	for (uint32_t nCycle = 0; nCycle < 10; nCycle++)
+		runCycle (listHandler, axis);
+	expect (pList->m_ListState == eListState::ExecutionFinished, "retry after processing finishes");
+	
+	// Prepared, but never triggered: every entry fails, its instance has to return to the pool
+	nListID = createList (listHandler, pFailingHandler.get (), 30, LISTTEST_QUEUESIZE + 1);
+	pFailingHandler->setFailure (eMoveFailure::BeforeTrigger);
+	pList = listHandler.executeList (nListID, 2);
+	for (uint32_t nAttempt = 0; nAttempt < LISTTEST_QUEUESIZE + 1; nAttempt++) {
+		runCycle (listHandler, axis);
+		expect ((pList->m_ListState == eListState::ExecutionError) && (pList->m_ErrorCode == eErrorCode::INVALIDPAYLOAD), "prepared signal returns to the pool");
+		pFailingHandler->setFailure (eMoveFailure::BeforeTrigger);
+		listHandler.resumeList (nListID, 2, eListResumeMode::SkipEntry);
+	}
+	runCycle (listHandler, axis);
+	expect (pList->m_ListState == eListState::ExecutionFinished, "skipped list finishes");
+}
+
+static TcpList * instantiateTemplate (CTcpListHandler & listHandler, uint32_t nTemplateID, uint32_t nFlags)
+{
+	uint32_t Header[2] = { nTemplateID, nFlags };
+	return listHandler.instantiateListTemplate ((uint8_t *) Header, sizeof (Header));
+}
+
+// Failed template instances stay available for a resume, a new instance must not recycle them
+static void checkTemplateInstances ()
+{
+	CAxisSimulation axis;
+	CTcpListHandler listHandler (LISTTEST_LISTCOUNT + 1, 3, &axis);
+	auto pFailingHandler = std::make_shared<CTcpPacketHandler_FailingMove> (&listHandler);
+	
+	uint32_t nSourceListID = createList (listHandler, pFailingHandler.get (), 40, 1);
+	uint32_t TemplateHeader[3] = { 5, nSourceListID, 0 };
+	listHandler.defineListTemplate ((uint8_t *) TemplateHeader, sizeof (TemplateHeader));
+	
+	pFailingHandler->setFailure (eMoveFailure::AfterTrigger);
+	uint32_t nFailedListID = instantiateTemplate (listHandler, 5, LISTBATCH_FLAG_EXECUTE)->m_nListId;
+	runCycle (listHandler, axis);
+	
+	TcpList * pFinishedList = instantiateTemplate (listHandler, 5, LISTBATCH_FLAG_EXECUTE | (1 << LISTBATCH_FLAG_LANESHIFT));
+	expect (listHandler.getListByID (nFailedListID, true)->m_ListState == eListState::ExecutionError, "failed instance is kept");
+	for (uint32_t nCycle = 0; nCycle < 10; nCycle++)
+		runCycle (listHandler, axis);
+	expect (pFinishedList->m_ListState == eListState::ExecutionFinished, "second instance finishes");
+	
+	// The finished instance is recycled, after that the entry pool is exhausted by the kept instances
+	uint32_t nIdleListID = instantiateTemplate (listHandler, 5, 0)->m_nListId;
+	expectError (eErrorCode::NOLISTENTRIESLEFT, [&] () { instantiateTemplate (listHandler, 5, 0); }, "instantiation with an exhausted pool");
+	
+	listHandler.resumeList (nFailedListID, 0, eListResumeMode::RetryEntry);
+	for (uint32_t nCycle = 0; nCycle < 10; nCycle++)
+		runCycle (listHandler, axis);
+	uint32_t nResumedListID = instantiateTemplate (listHandler, 5, LISTBATCH_FLAG_EXECUTE)->m_nListId;
+	expect (nResumedListID == nFailedListID, "resumed instance is recycled once finished");
+	
+	expectError (eErrorCode::LISTISEXECUTING, [&] () { listHandler.deleteList (nResumedListID); }, "delete an executing list");
+	listHandler.deleteList (nIdleListID);
+	expect (listHandler.getListByID (nIdleListID, false) == nullptr, "deleted list is released");
+	expect (listHandler.canAllocateList (1), "deleted list returns its entries");
+}
+
+int main ()
+{
+	try {
+		CHostSimulation::initialize ();
+		
+		checkBusyLane ();
+		checkRetryAfterError ();
+		checkTemplateInstances ();
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	if (g_nFailureCount > 0) {
+		printf ("%d checks failed\n", (int) g_nFailureCount);
+		return 1;
+	}
+	
+	printf ("all list handler checks passed\n");
+	return 0;
+}
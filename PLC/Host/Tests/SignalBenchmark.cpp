@@ -0,0 +1,193 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Measures the time of one complete signal exchange: prepare, set five parameters, trigger, check, read the
+// parameters, set the result, finish and check the handle on the sender side. The exchange runs once per
+// simulated cycle, with parameter indices and signal IDs, and once with the names. The benchmark fails if
+// a parameter is lost or if the exchange allocates heap memory. Usage:
+//
+//   SignalBenchmark [--iterations <count>]
+
+#include "HostSimulation.hpp"
+
+#include "Framework/HeapMonitor.hpp"
+#include "Framework/SignalHandler.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define SIGNALBENCHMARK_PARAM_AXISID (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNALBENCHMARK_PARAM_POSITION (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNALBENCHMARK_PARAM_SPEED (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNALBENCHMARK_PARAM_ACCELERATION (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNALBENCHMARK_PARAM_ABSOLUTE (SIGNAL_FIRSTCUSTOMINDEX + 4)
+#define SIGNALBENCHMARK_RESULT_SUCCESS (SIGNAL_FIRSTCUSTOMINDEX + 0)
+
+using namespace BuRCPP;
+
+static bool exchangeByIndex (CSignalHandler & signalHandler, uint32_t nSignalID, int32_t nValue)
+{
+	auto pSendInstance = signalHandler.prepareSignal (nSignalID);
+	pSendInstance->setInt32Parameter (SIGNALBENCHMARK_PARAM_AXISID, 1);
+	pSendInstance->setInt32Parameter (SIGNALBENCHMARK_PARAM_POSITION, nValue);
+	pSendInstance->setInt32Parameter (SIGNALBENCHMARK_PARAM_SPEED, 5000);
+	pSendInstance->setInt32Parameter (SIGNALBENCHMARK_PARAM_ACCELERATION, 10000);
+	pSendInstance->setBoolParameter (SIGNALBENCHMARK_PARAM_ABSOLUTE, true);
+	pSendInstance->triggerSignal ();
+	uint32_t nHandle = pSendInstance->getHandle ();
+	
+	auto pProcessingInstance = signalHandler.checkSignal (nSignalID);
+	if (pProcessingInstance == nullptr)
+		return false;
+	
+	bool bIsValid = (pProcessingInstance->getInt32Parameter (SIGNALBENCHMARK_PARAM_AXISID) == 1)
+		&& (pProcessingInstance->getInt32Parameter (SIGNALBENCHMARK_PARAM_POSITION) == nValue)
+		&& (pProcessingInstance->getInt32Parameter (SIGNALBENCHMARK_PARAM_SPEED) == 5000)
+		&& (pProcessingInstance->getInt32Parameter (SIGNALBENCHMARK_PARAM_ACCELERATION) == 10000)
+		&& pProcessingInstance->getBoolParameter (SIGNALBENCHMARK_PARAM_ABSOLUTE);
+	pProcessingInstance->setBoolResult (SIGNALBENCHMARK_RESULT_SUCCESS, bIsValid);
+	pProcessingInstance->finishProcessing ();
+	
+	return bIsValid && pSendInstance->signalHasBeenProcessed (nHandle) && pSendInstance->getBoolResult (SIGNALBENCHMARK_RESULT_SUCCESS);
+}
+
+static bool exchangeByName (CSignalHandler & signalHandler, int32_t nValue)
+{
+	auto pSendInstance = signalHandler.prepareSignal ("move");
+	pSendInstance->setInt32Parameter ("axisid", 1);
+	pSendInstance->setInt32Parameter ("position", nValue);
+	pSendInstance->setInt32Parameter ("speed", 5000);
+	pSendInstance->setInt32Parameter ("acceleration", 10000);
+	pSendInstance->setBoolParameter ("absolute", true);
+	pSendInstance->triggerSignal ();
+	uint32_t nHandle = pSendInstance->getHandle ();
+	
+	auto pProcessingInstance = signalHandler.checkSignal ("move");
+	if (pProcessingInstance == nullptr)
+		return false;
+	
+	bool bIsValid = (pProcessingInstance->getInt32Parameter ("axisid") == 1)
+		&& (pProcessingInstance->getInt32Parameter ("position") == nValue)
+		&& (pProcessingInstance->getInt32Parameter ("speed") == 5000)
+		&& (pProcessingInstance->getInt32Parameter ("acceleration") == 10000)
+		&& pProcessingInstance->getBoolParameter ("absolute");
+	pProcessingInstance->setBoolResult ("success", bIsValid);
+	pProcessingInstance->finishProcessing ();
+	
+	return bIsValid && pSendInstance->signalHasBeenProcessed (nHandle) && pSendInstance->getBoolResult ("success");
+}
+
+// Runs one exchange per simulated cycle. The instances have a lifetime of zero, so the finished instance
+// of a cycle is released at the beginning of the next one, like the application does it.
+template <typename F> static bool measureExchange (CSignalHandler & signalHandler, uint32_t nIterations, F exchange, double & dNanoseconds)
+{
+	uint64_t nAllocationCount = CHeapMonitor::getAllocationCount ();
+	
+	auto start = std::chrono::steady_clock::now ();
+	for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++) {
+		CHostSimulation::advanceTime (HOSTSIMULATION_DEFAULTCYCLETIME);
+		signalHandler.releaseExpiredSignals ();
+		
+		if (!exchange ((int32_t) nIteration)) {
+			printf ("signal exchange %d failed\n", (int) nIteration);
+			return false;
+		}
+	}
+	auto end = std::chrono::steady_clock::now ();
+	
+	dNanoseconds = std::chrono::duration<double, std::nano> (end - start).count () / (double) nIterations;
+	
+	if (CHeapMonitor::getAllocationCount () != nAllocationCount) {
+		printf ("%d heap allocations during %d signal exchanges\n", (int) (CHeapMonitor::getAllocationCount () - nAllocationCount), (int) nIterations);
+		return false;
+	}
+	
+	return true;
+}
+
+int main (int argc, char ** argv)
+{
+	uint32_t nIterations = 1000000;
+	
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		if ((strcmp (argv[nIndex], "--iterations") == 0) && (nIndex + 1 < argc)) {
+			nIterations = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else {
+			printf ("usage: %s [--iterations <count>]\n", argv[0]);
+			return 1;
+		}
+	}
+	
+	if (nIterations == 0)
+		nIterations = 1;
+	
+	try {
+		CHostSimulation::initialize ();
+		
+		CSignalHandler signalHandler (std::make_shared<CSystemInfo> ());
+		auto pSignal = signalHandler.registerSignal ("move", 4, 0);
+		pSignal->addInt32Parameter ("axisid", 0, SIGNALBENCHMARK_PARAM_AXISID);
+		pSignal->addInt32Parameter ("position", 0, SIGNALBENCHMARK_PARAM_POSITION);
+		pSignal->addInt32Parameter ("speed", 0, SIGNALBENCHMARK_PARAM_SPEED);
+		pSignal->addInt32Parameter ("acceleration", 0, SIGNALBENCHMARK_PARAM_ACCELERATION);
+		pSignal->addBoolParameter ("absolute", false, SIGNALBENCHMARK_PARAM_ABSOLUTE);
+		pSignal->addBoolResult ("success", false, SIGNALBENCHMARK_RESULT_SUCCESS);
+		signalHandler.buildInstances ();
+		
+		uint32_t nSignalID = pSignal->getSignalID ();
+		
+		double dCycleOnly = 0.0;
+		double dByIndex = 0.0;
+		double dByName = 0.0;
+		
+		bool bSuccess = measureExchange (signalHandler, nIterations, [&] (int32_t) { return true; }, dCycleOnly)
+			&& measureExchange (signalHandler, nIterations, [&] (int32_t nValue) { return exchangeByIndex (signalHandler, nSignalID, nValue); }, dByIndex)
+			&& measureExchange (signalHandler, nIterations, [&] (int32_t nValue) { return exchangeByName (signalHandler, nValue); }, dByName);
+		
+		if (!bSuccess)
+			return 1;
+		
+		printf ("cycle without signal: %.1f ns\n", dCycleOnly);
+		printf ("prepare/trigger/check/finish by index: %.1f ns\n", dByIndex - dCycleOnly);
+		printf ("prepare/trigger/check/finish by name: %.1f ns\n", dByName - dCycleOnly);
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	return 0;
+}
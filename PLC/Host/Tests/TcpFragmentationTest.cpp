@@ -0,0 +1,276 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+// Feeds a randomly fragmented stream of packets to CTcpServer over a loopback connection. Every chunk
+// is followed by a few server cycles, so frames arrive split at arbitrary offsets. All packets have to
+// be answered in order with a valid response header. Usage:
+//
+//   TcpFragmentationTest [--port <port>] [--packets <count>] [--seed <seed>]
+
+#include <bur/plctypes.h>
+#include <AsDefault.h>
+
+#include "Framework/TcpServer.hpp"
+#include "Framework/Utils.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define TCPTEST_SIGNATURE 171
+#define TCPTEST_CLIENTID 17
+#define TCPTEST_COMMANDID 4711
+#define TCPTEST_MAXIDLECYCLES 10000
+
+using namespace BuRCPP;
+
+// Answers with the sequence number, which the client writes into the first payload bytes
+class CTcpPacketHandler_Echo : public CTcpPacketHandler_Direct
+{
+	public:
+	
+	uint32_t getCommandID () override
+	{
+		return TCPTEST_COMMANDID;
+	}
+	
+	void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+	{
+		pResponse->addUint32 (readUint32FromPayload (pPayload, 0));
+	}
+};
+
+static void printUsage (const char * pProgramName)
+{
+	printf ("usage: %s [--port <port>] [--packets <count>] [--seed <seed>]\n", pProgramName);
+}
+
+static int connectClient (CTcpServer * pServer, uint32_t nPort)
+{
+	// The server needs a few cycles to open and listen on the socket
+	for (uint32_t nCycle = 0; nCycle < TCPTEST_MAXIDLECYCLES; nCycle++) {
+		pServer->handleServer ();
+		
+		int nSocket = socket (AF_INET, SOCK_STREAM, 0);
+		if (nSocket < 0)
+			return -1;
+		
+		sockaddr_in address;
+		memset ((void*) &address, 0, sizeof (address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+		address.sin_port = htons ((uint16_t) nPort);
+		
+		if (connect (nSocket, (sockaddr*) &address, sizeof (address)) == 0) {
+			int nNoDelay = 1;
+			setsockopt (nSocket, IPPROTO_TCP, TCP_NODELAY, &nNoDelay, sizeof (nNoDelay));
+			fcntl (nSocket, F_SETFL, O_NONBLOCK);
+			return nSocket;
+		}
+		
+		close (nSocket);
+		usleep (1000);
+	}
+	
+	return -1;
+}
+
+static void appendPacket (std::vector<uint8_t> & Stream, uint32_t nSequenceID)
+{
+	TcpIncomingMessage message;
+	memset ((void*) &message, 0, sizeof (message));
+	message.m_nSignature = TCPTEST_SIGNATURE;
+	message.m_nClientId = TCPTEST_CLIENTID;
+	message.m_nSequenceId = nSequenceID;
+	message.m_nCommandId = TCPTEST_COMMANDID;
+	memcpy (message.m_Payload.m_Data, &nSequenceID, sizeof (nSequenceID));
+	message.m_nChecksum = CUtils::computeCRC32 ((uint8_t*) &message, (uint32_t) sizeof (message) - 4);
+	
+	uint8_t * pBytes = (uint8_t*) &message;
+	Stream.insert (Stream.end (), pBytes, pBytes + sizeof (message));
+}
+
+// Reads all pending response bytes and checks every complete response. Returns false on a broken response.
+static bool receiveResponses (int nSocket, std::vector<uint8_t> & Received, uint32_t & nResponseCount)
+{
+	uint8_t Buffer[4096];
+	
+	for (;;) {
+		ssize_t nBytes = recv (nSocket, Buffer, sizeof (Buffer), 0);
+		if (nBytes > 0) {
+			Received.insert (Received.end (), Buffer, Buffer + nBytes);
+			continue;
+		}
+		
+		if ((nBytes < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+			break;
+		
+		printf ("connection closed by the server after %d responses\n", (int) nResponseCount);
+		return false;
+	}
+	
+	uint32_t nOffset = 0;
+	while (Received.size () - nOffset >= sizeof (TcpOutgoingMessageHeader)) {
+		TcpOutgoingMessageHeader header;
+		memcpy (&header, &Received[nOffset], sizeof (header));
+		
+		if (header.m_nHeaderChecksum != CUtils::computeCRC32 ((uint8_t*) &header, sizeof (header) - 4)) {
+			printf ("invalid header checksum of response %d\n", (int) nResponseCount);
+			return false;
+		}
+		
+		if (Received.size () - nOffset < sizeof (header) + header.m_nPayloadLength)
+			break;
+		
+		uint32_t nSequenceID = 0;
+		if (header.m_nPayloadLength == sizeof (nSequenceID))
+			memcpy (&nSequenceID, &Received[nOffset + sizeof (header)], sizeof (nSequenceID));
+		
+		if ((header.m_nSignature != TCPTEST_SIGNATURE) || (header.m_nClientId != TCPTEST_CLIENTID) || (header.m_nStatusCode != 0)
+			|| (header.m_nSequenceId != nResponseCount) || (header.m_nPayloadLength != sizeof (nSequenceID)) || (nSequenceID != nResponseCount)) {
+			printf ("unexpected response %d: sequence %d, status %d, payload length %d\n", (int) nResponseCount,
+				(int) header.m_nSequenceId, (int) header.m_nStatusCode, (int) header.m_nPayloadLength);
+			return false;
+		}
+		
+		nOffset += sizeof (header) + header.m_nPayloadLength;
+		nResponseCount++;
+	}
+	
+	Received.erase (Received.begin (), Received.begin () + nOffset);
+	return true;
+}
+
+int main (int argc, char ** argv)
+{
+	uint32_t nPort = 12210;
+	uint32_t nPacketCount = 2000;
+	uint32_t nSeed = 1;
+	
+	for (int nIndex = 1; nIndex < argc; nIndex++) {
+		if ((strcmp (argv[nIndex], "--port") == 0) && (nIndex + 1 < argc)) {
+			nPort = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else if ((strcmp (argv[nIndex], "--packets") == 0) && (nIndex + 1 < argc)) {
+			nPacketCount = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else if ((strcmp (argv[nIndex], "--seed") == 0) && (nIndex + 1 < argc)) {
+			nSeed = (uint32_t) strtoul (argv[++nIndex], nullptr, 10);
+		} else {
+			printUsage (argv[0]);
+			return 1;
+		}
+	}
+	
+	try {
+		CTcpServer server (nPort, 8, TCPTEST_SIGNATURE);
+		server.registerPacketHandler (std::make_shared<CTcpPacketHandler_Echo> ());
+		server.startServer ();
+		
+		int nSocket = connectClient (&server, nPort);
+		if (nSocket < 0) {
+			printf ("could not connect to port %d\n", (int) nPort);
+			return 1;
+		}
+		
+		std::vector<uint8_t> Stream;
+		for (uint32_t nSequenceID = 0; nSequenceID < nPacketCount; nSequenceID++)
+			appendPacket (Stream, nSequenceID);
+		
+		// Chunks range from a single byte to several frames, the server runs up to three cycles in between
+		std::mt19937 generator (nSeed);
+		std::uniform_int_distribution<uint32_t> chunkSizes (1, 3 * sizeof (TcpIncomingMessage));
+		std::uniform_int_distribution<uint32_t> cycleCounts (1, 3);
+		
+		std::vector<uint8_t> Received;
+		uint32_t nResponseCount = 0;
+		uint32_t nSentSize = 0;
+		uint32_t nChunkCount = 0;
+		uint32_t nIdleCycles = 0;
+		
+		while ((nResponseCount < nPacketCount) && (nIdleCycles < TCPTEST_MAXIDLECYCLES)) {
+			if (nSentSize < Stream.size ()) {
+				uint32_t nChunkSize = chunkSizes (generator);
+				if (nChunkSize > Stream.size () - nSentSize)
+					nChunkSize = (uint32_t) Stream.size () - nSentSize;
+				
+				ssize_t nBytes = send (nSocket, &Stream[nSentSize], nChunkSize, MSG_NOSIGNAL);
+				if (nBytes > 0) {
+					nSentSize += (uint32_t) nBytes;
+					nChunkCount++;
+				}
+			}
+			
+			uint32_t nCycles = cycleCounts (generator);
+			for (uint32_t nCycle = 0; nCycle < nCycles; nCycle++)
+				server.handleServer ();
+			
+			uint32_t nPreviousResponseCount = nResponseCount;
+			if (!receiveResponses (nSocket, Received, nResponseCount)) {
+				close (nSocket);
+				return 1;
+			}
+			
+			if ((nResponseCount == nPreviousResponseCount) && (nSentSize == Stream.size ())) {
+				nIdleCycles++;
+				usleep (100);
+			} else {
+				nIdleCycles = 0;
+			}
+		}
+		
+		close (nSocket);
+		
+		printf ("packets: %d, chunks: %d, responses: %d\n", (int) nPacketCount, (int) nChunkCount, (int) nResponseCount);
+		
+		if (nResponseCount != nPacketCount) {
+			printf ("missing responses\n");
+			return 1;
+		}
+	}
+	catch (CException & Exception) {
+		printf ("exception %d: %s\n", (int) Exception.getCode (), Exception.getMessage ());
+		return 2;
+	}
+	
+	return 0;
+}
@@ -0,0 +1,72 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Host replacement of the B&R basic type header. The IEC types are mapped to fixed width types,
+// so that the generated AsDefault.h has the same memory layout as on the 32 bit target.
+
+#ifndef __BUR_PLCTYPES_H__
+#define __BUR_PLCTYPES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t plcbit;
+typedef char plcstring;
+typedef uint16_t plcwstring;
+typedef int32_t plctime;
+typedef uint32_t plcdt;
+typedef uint32_t plcdate;
+typedef uint32_t plctod;
+
+// Storage for the partial C-only types of the libraries, which are never accessed by the program.
+typedef struct plcopaque {
+	uint8_t m_Data[64];
+} plcopaque;
+
+typedef uint8_t BOOL;
+typedef int8_t SINT;
+typedef uint8_t USINT;
+typedef int16_t INT;
+typedef uint16_t UINT;
+typedef int32_t DINT;
+typedef uint32_t UDINT;
+typedef float REAL;
+typedef double LREAL;
+
+#define _BUR_PUBLIC
+#define _LOCAL
+#define _GLOBAL
+#define _INIT
+#define _CYCLIC
+#define _EXIT
+
+#endif // __BUR_PLCTYPES_H__
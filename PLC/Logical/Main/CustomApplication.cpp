@@ -70,10 +70,10 @@ namespace BuRCPP
 	void CCustomApplication::registerHandlers ()
 	{
 		// Register the main PLC module
-		registerModule (std::make_shared<CIOModule_PLC> ("5APC2100_BY44_000", &IOMapping_PLC), JOURNALGROUP_MODULE_PLC);
+		registerModule (std::make_shared<CIOModule_PLC> ("5APC2100_BY44_000", &IOMapping_PLC), JOURNALGROUP_MODULE_PLC, CYCLEDIVIDER_SLOWMODULES);
 		
 		// Register analoge IO modules
-		registerModule (std::make_shared<CIOModule_X20AT6402> ("112KF11", &IOMapping_112KF11), JOURNALGROUP_MODULE_GPIO1);
+		registerModule (std::make_shared<CIOModule_X20AT6402> ("112KF11", &IOMapping_112KF11), JOURNALGROUP_MODULE_GPIO1, CYCLEDIVIDER_SLOWMODULES);
 		registerModule (std::make_shared<CIOModule_X20AO4622> ("112KF12", &IOMapping_112KF12), JOURNALGROUP_MODULE_GPIO2);
 		registerModule (std::make_shared<CIOModule_X20AO4622> ("112KF13", &IOMapping_112KF13), JOURNALGROUP_MODULE_GPIO3);
 		registerModule (std::make_shared<CIOModule_X20AI4622> ("112KF15", &IOMapping_112KF15), JOURNALGROUP_MODULE_GPIO5);
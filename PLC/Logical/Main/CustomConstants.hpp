@@ -196,5 +196,76 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define O2SENSORCHAMBER_RANGE_FINE_UPPER_INPPM 1000
 #define FACTOR_PERCENT_TO_PPM 10000
 
+// Parameter and result indices of the signals, shared by the TCP handlers and the state machines.
+// The state machines check them when the parameters are registered.
+#define SIGNAL_RESULT_SUCCESS (SIGNAL_FIRSTCUSTOMINDEX + 0)
+
+#define SIGNAL_LOCKDOOR_PARAM_DOORSTATE (SIGNAL_FIRSTCUSTOMINDEX + 0)
+
+#define SIGNAL_AXISMOVEMENT_PARAM_AXISID (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_AXISMOVEMENT_PARAM_POSITION (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_AXISMOVEMENT_PARAM_SPEED (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION (SIGNAL_FIRSTCUSTOMINDEX + 4)
+
+#define SIGNAL_REFERENCEAXIS_PARAM_PLATFORM (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR (SIGNAL_FIRSTCUSTOMINDEX + 3)
+
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSTARTPOSITION (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARTARGETPOSITION (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSPEED (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERSPEED (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARACCELERATION (SIGNAL_FIRSTCUSTOMINDEX + 4)
+#define SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERACCELERATION (SIGNAL_FIRSTCUSTOMINDEX + 5)
+
+#define SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE (SIGNAL_FIRSTCUSTOMINDEX + 4)
+
+#define SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDONINPPM (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDOFFINPPM (SIGNAL_FIRSTCUSTOMINDEX + 1)
+
+#define SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+
+#define SIGNAL_INITVACUUMSYSTEM_PARAM_PRESSURETHRESHOLDINMBAR (SIGNAL_FIRSTCUSTOMINDEX + 0)
+
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME (SIGNAL_FIRSTCUSTOMINDEX + 4)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT (SIGNAL_FIRSTCUSTOMINDEX + 5)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT (SIGNAL_FIRSTCUSTOMINDEX + 6)
+#define SIGNAL_CONTROLLERPARAMETERS_PARAM_SETVALUE (SIGNAL_FIRSTCUSTOMINDEX + 7)
+
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME (SIGNAL_FIRSTCUSTOMINDEX + 4)
+#define SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME (SIGNAL_FIRSTCUSTOMINDEX + 5)
+
+#define SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE (SIGNAL_FIRSTCUSTOMINDEX + 4)
+
+#define SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE (SIGNAL_FIRSTCUSTOMINDEX + 1)
+
+#define SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT (SIGNAL_FIRSTCUSTOMINDEX + 0)
+#define SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE (SIGNAL_FIRSTCUSTOMINDEX + 1)
+#define SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE (SIGNAL_FIRSTCUSTOMINDEX + 2)
+#define SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME (SIGNAL_FIRSTCUSTOMINDEX + 3)
+#define SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME (SIGNAL_FIRSTCUSTOMINDEX + 4)
+
+// Slow changing modules only update their journal every n-th cycle
+#define CYCLEDIVIDER_SLOWMODULES 10
+
 
 #endif //__CUSTOMCONSTANTS
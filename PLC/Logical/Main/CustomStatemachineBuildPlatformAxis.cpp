@@ -40,6 +40,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20SC0842.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the build platform axis state machine, bound once in the state handler constructor
+#define BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS 0
+#define BUILDPLATFORM_MODULE_115KF53 1
+
+// State IDs of the build platform axis state machine, in registration order
+#define BUILDPLATFORM_STATE_WAIT_FOR_INIT 0
+#define BUILDPLATFORM_STATE_INIT 1
+#define BUILDPLATFORM_STATE_IDLE 2
+#define BUILDPLATFORM_STATE_AXIS_MOVEMENT 3
+#define BUILDPLATFORM_STATE_WAIT_FOR_AXIS_MOVEMENT 4
+#define BUILDPLATFORM_STATE_MANUAL_REFERENCING 5
+#define BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING 6
+#define BUILDPLATFORM_STATE_ERROR 7
+#define BUILDPLATFORM_STATE_FAULT 8
+
+// Signal IDs of the build platform axis state machine, in registration order
+#define BUILDPLATFORM_SIGNAL_INITAXIS 0
+#define BUILDPLATFORM_SIGNAL_TRIGGERSINGLEAXISMOVEMENT 1
+#define BUILDPLATFORM_SIGNAL_REFERENCEAXIS 2
+#define BUILDPLATFORM_SIGNAL_ABSOLUTESWITCHREFERENCING 3
+
 
 
 namespace BuRCPP {
@@ -55,24 +76,24 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 			
 			// check for PC signals
-			auto pSignalInitPlatformAxis = pEnvironment->checkSignal ("initaxis");
+			auto pSignalInitPlatformAxis = pEnvironment->checkSignal (BUILDPLATFORM_SIGNAL_INITAXIS);
 			
 			if(pSignalInitPlatformAxis)
 			{ // wait for PC signal to init
-				pSignalInitPlatformAxis->setBoolResult("success", true);
+				pSignalInitPlatformAxis->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 				pSignalInitPlatformAxis->finishProcessing ();
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_INIT);
 			}
 			else if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_init");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_WAIT_FOR_INIT);
 			}
 						
 		}
@@ -89,29 +110,29 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 			
 			if (pBuildPlatformAxisModule->canSetPower ()) 
 			{
 				if(pBuildPlatformAxisModule->isReferenced ())
 				{
 					pBuildPlatformAxisModule->setPower(true);
-					pEnvironment->setNextState ("idle");
+					pEnvironment->setNextState (BUILDPLATFORM_STATE_IDLE);
 				}
 				else
 				{
 					pBuildPlatformAxisModule->setPowerOnAndStartReference ();
-					pEnvironment->setNextState ("wait_for_referencing");	
+					pEnvironment->setNextState (BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING);	
 				}
 				
 			} 
 			else if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_INIT);
 			}
 			
 		}
@@ -128,51 +149,51 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(BUILDPLATFORM_STATE_IDLE);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 			
 			// check for PC signals
-			auto pSignalReferenceAxis = pEnvironment->checkSignal ("referenceaxis");
-			auto pSignalSingleAxisMovement = pEnvironment->checkSignal ("triggersingleaxismovement");
-			auto pSignalAbsoluteSwitchReferencing = pEnvironment->checkSignal ("absoluteswitchreferencing");
+			auto pSignalReferenceAxis = pEnvironment->checkSignal (BUILDPLATFORM_SIGNAL_REFERENCEAXIS);
+			auto pSignalSingleAxisMovement = pEnvironment->checkSignal (BUILDPLATFORM_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
+			auto pSignalAbsoluteSwitchReferencing = pEnvironment->checkSignal (BUILDPLATFORM_SIGNAL_ABSOLUTESWITCHREFERENCING);
 			
 			if (pSignalReferenceAxis) 
 			{
-				bool referencebuildplatformaxis = pSignalReferenceAxis->getBoolParameter("reference_platform");
+				bool referencebuildplatformaxis = pSignalReferenceAxis->getBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_PLATFORM);
 				
 				if (referencebuildplatformaxis)
 				{
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_REFERENCEBUILDPLATFORM, referencebuildplatformaxis);
-					pEnvironment->setNextState("manual_referencing");
+					pEnvironment->setNextState(BUILDPLATFORM_STATE_MANUAL_REFERENCING);
 					pSignalReferenceAxis->finishProcessing ();
 					return;
 				}
 			}
 			if (pSignalAbsoluteSwitchReferencing) 
 			{
-				pEnvironment->setNextState("manual_referencing");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_MANUAL_REFERENCING);
 				pSignalAbsoluteSwitchReferencing->finishProcessing ();
 				return;
 			}
 			if (pSignalSingleAxisMovement) 
 			{
-				int axisid = pSignalSingleAxisMovement->getInt32Parameter("axisid");
+				int axisid = pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID);
 				if (axisid == AXISID_BUILDPLATFORM)
 				{
-					pEnvironment->setNextState("axis_movement");
-					pEnvironment->setIntegerValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter("absoluterelative"));
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter("position") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter("speed") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter("acceleration") * 0.001);
+					pEnvironment->setNextState(BUILDPLATFORM_STATE_AXIS_MOVEMENT);
+					pEnvironment->setIntegerValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE));
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_BUILDPLATFORMMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION) * 0.001);
 					pSignalSingleAxisMovement->finishProcessing ();
 					return;
 				}
 			}
 			if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 		}
 	};
@@ -188,10 +209,10 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("axis_movement");
+			pEnvironment->setNextState(BUILDPLATFORM_STATE_AXIS_MOVEMENT);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 		
 			if (pBuildPlatformAxisModule->canMoveAxis ()) 
 			{	
@@ -206,15 +227,15 @@ namespace BuRCPP {
 				}else if (absoluterelative == AXISMOVEMENT_RELATIVE){
 					pBuildPlatformAxisModule->moveAxisRelative (position, speed, acceleration);
 				}
-				pEnvironment->setNextState ("wait_for_axis_movement");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_WAIT_FOR_AXIS_MOVEMENT);
 			} 
 			else if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("axis_movement");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_AXIS_MOVEMENT);
 			}
 		}
 	
@@ -230,22 +251,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_axis_movement");
+			pEnvironment->setNextState(BUILDPLATFORM_STATE_WAIT_FOR_AXIS_MOVEMENT);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 				
 			if (pBuildPlatformAxisModule->isInPosition())
 			{	
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_IDLE);
 			} 
 			else if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else 
 			{
-			pEnvironment->setNextState ("wait_for_axis_movement");
+			pEnvironment->setNextState (BUILDPLATFORM_STATE_WAIT_FOR_AXIS_MOVEMENT);
 			}
 
 		}
@@ -263,22 +284,22 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 			
 			auto referencePlatformAxis = pEnvironment->getInt32Value(JOURNALVARIABLE_REFERENCEBUILDPLATFORM);
 			
 			if (pBuildPlatformAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else if (referencePlatformAxis)
 			{
 				pBuildPlatformAxisModule->startReference ();
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING);
 			}
 			else
 			{
-				pEnvironment->setNextState("manual_referencing");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_MANUAL_REFERENCING);
 			}
 
 		}
@@ -295,22 +316,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_referencing");
+			pEnvironment->setNextState(BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
 			
 			if (pBuildPlatformAxisModule->isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else if(pBuildPlatformAxisModule->isReferenced ())
 			{
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_IDLE);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING);
 			}
 
 		}
@@ -327,11 +348,11 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(BUILDPLATFORM_STATE_ERROR);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, "BuildPlatformAxis");
-			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, "115KF53"); //acknowledge button
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pBuildPlatformAxisModule (pEnvironment, BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
+			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, BUILDPLATFORM_MODULE_115KF53); //acknowledge button
 					
 			if(pSafeDigitalInputModule115KF53->getInput(2) == 1) //acknowledge button pressed
 			{
@@ -340,11 +361,50 @@ namespace BuRCPP {
 			
 			if (pBuildPlatformAxisModule->isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_INIT);
+			}
+					
+		}
+	
+	};
+	
+		
+	
+	class CStateBuildPlatformAxis_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// bring the axis to standstill, the stop takes effect once the axis module is handled again
+			auto pBuildPlatformAxisModule = pEnvironment->getModuleForFaultState<CMappMotion_SingleLinearAxis> (BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS);
+			pBuildPlatformAxisModule->stopAxis ();
+			
+			if (!pEnvironment->boundModulesAreAvailable ())
+			{
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_FAULT);
+			}
+			else if (pBuildPlatformAxisModule->isError ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_ERROR);
+			}
+			else if (pBuildPlatformAxisModule->isIdle ())
+			{ // the axis has to be initialized again by the PC
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_WAIT_FOR_INIT);
+			}
+			else
+			{
+				pEnvironment->setNextState (BUILDPLATFORM_STATE_FAULT);
 			}
 					
 		}
@@ -361,15 +421,23 @@ namespace BuRCPP {
 			: CStateHandler (pApplication->getJournal (), "build_platform_axis", pApplication->getModuleHandler (), JOURNALGROUP_BUILD_PLATFORM_AXIS)
 			
 		{
-			// register state machines
-			addState (std::make_shared<CStateBuildPlatformAxis_WaitForInit> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_Init> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_Idle> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_AxisMovement> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_WaitForAxisMovement> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_ManualReferencing> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_WaitForReferencing> ());
-			addState (std::make_shared<CStateBuildPlatformAxis_Error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CMappMotion_SingleLinearAxis> (BUILDPLATFORM_MODULE_BUILDPLATFORMAXIS, "BuildPlatformAxis");
+			bindModule<CIOModule_X20SC0842> (BUILDPLATFORM_MODULE_115KF53, "115KF53");
+			
+			// register state machines, a registration out of order against the BUILDPLATFORM_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateBuildPlatformAxis_WaitForInit> (), BUILDPLATFORM_STATE_WAIT_FOR_INIT);
+			addState (std::make_shared<CStateBuildPlatformAxis_Init> (), BUILDPLATFORM_STATE_INIT);
+			addState (std::make_shared<CStateBuildPlatformAxis_Idle> (), BUILDPLATFORM_STATE_IDLE);
+			addState (std::make_shared<CStateBuildPlatformAxis_AxisMovement> (), BUILDPLATFORM_STATE_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateBuildPlatformAxis_WaitForAxisMovement> (), BUILDPLATFORM_STATE_WAIT_FOR_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateBuildPlatformAxis_ManualReferencing> (), BUILDPLATFORM_STATE_MANUAL_REFERENCING);
+			addState (std::make_shared<CStateBuildPlatformAxis_WaitForReferencing> (), BUILDPLATFORM_STATE_WAIT_FOR_REFERENCING);
+			addState (std::make_shared<CStateBuildPlatformAxis_Error> (), BUILDPLATFORM_STATE_ERROR);
+			addState (std::make_shared<CStateBuildPlatformAxis_Fault> (), BUILDPLATFORM_STATE_FAULT);
+			
+			// a throwing state stops the axis in the fault state
+			setFaultState (BUILDPLATFORM_STATE_FAULT);
 			
 			// register journal variables
 			registerIntegerValue("platform_absoluterelative", JOURNALVARIABLE_BUILDPLATFORMMOVEMENTABSOLUTERELATIVE, 0, 1);
@@ -379,28 +447,28 @@ namespace BuRCPP {
 			registerIntegerValue("platform_referencing", JOURNALVARIABLE_REFERENCEBUILDPLATFORM, 0, 1);
 
 			
-			// register signals
+			// register signals, a registration out of order against the BUILDPLATFORM_SIGNAL_* IDs fails the initialization
 			
-			auto pSignalInitPlatformAxis = registerSignal ("initaxis", 4, 1000);
-			pSignalInitPlatformAxis->addBoolResult ("success", false);
+			auto pSignalInitPlatformAxis = registerSignal ("initaxis", 4, 1000, BUILDPLATFORM_SIGNAL_INITAXIS);
+			pSignalInitPlatformAxis->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000);
-			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("position", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0);
-			pSignalSingleAxisMovement->addBoolResult ("success", false);
+			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000, BUILDPLATFORM_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
+			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0, SIGNAL_AXISMOVEMENT_PARAM_AXISID);
+			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0, SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE);
+			pSignalSingleAxisMovement->addInt32Parameter ("position", 0, SIGNAL_AXISMOVEMENT_PARAM_POSITION);
+			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0, SIGNAL_AXISMOVEMENT_PARAM_SPEED);
+			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0, SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION);
+			pSignalSingleAxisMovement->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
-			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000);
-			pSignalReferenceAxis->addBoolParameter ("reference_platform", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false);
-			pSignalReferenceAxis->addBoolResult ("success", false);
+			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000, BUILDPLATFORM_SIGNAL_REFERENCEAXIS);
+			pSignalReferenceAxis->addBoolParameter ("reference_platform", false, SIGNAL_REFERENCEAXIS_PARAM_PLATFORM);
+			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false, SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR);
+			pSignalReferenceAxis->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalAbsoluteSwitchReferencing = registerSignal ("absoluteswitchreferencing", 4, 1000);
-			pSignalAbsoluteSwitchReferencing->addBoolResult ("success", false);
+			auto pSignalAbsoluteSwitchReferencing = registerSignal ("absoluteswitchreferencing", 4, 1000, BUILDPLATFORM_SIGNAL_ABSOLUTESWITCHREFERENCING);
+			pSignalAbsoluteSwitchReferencing->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
 		}
 	
@@ -43,6 +43,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_PLC.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the door state machine, bound once in the state handler constructor
+#define DOOR_MODULE_115KF51 0
+#define DOOR_MODULE_114KF24 1
+#define DOOR_MODULE_113KF20 2
+
+// State IDs of the door state machine, in registration order
+#define DOOR_STATE_INIT 0
+#define DOOR_STATE_LOCKED_WAITFORRELEASE 1
+#define DOOR_STATE_UNLOCKED_OPEN 2
+#define DOOR_STATE_UNLOCKED_CLOSED 3
+#define DOOR_STATE_LOCKED_CLOSED 4
+#define DOOR_STATE_FAULT 5
+
+// Signal IDs of the door state machine, in registration order
+#define DOOR_SIGNAL_RELEASEDOOR 0
+#define DOOR_SIGNAL_LOCKDOOR 1
+
 
 
 namespace BuRCPP {
@@ -58,8 +75,8 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, "115KF51");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, DOOR_MODULE_115KF51);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, DOOR_MODULE_114KF24);
 			
 			// ensure door release is false
 			pDigitalOutputModule->setOutput(1, false);
@@ -67,11 +84,11 @@ namespace BuRCPP {
 			// check if the door is closed
 			if(pSafetyDigitalInputModule->getInput(3)&& pSafetyDigitalInputModule->getInput(4)){
 				// if closed set next state locked_waitforrelease
-				pEnvironment->setNextState ("locked_waitforrelease");
+				pEnvironment->setNextState (DOOR_STATE_LOCKED_WAITFORRELEASE);
 			}
 			else{
 				// if door is open, remain in init
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (DOOR_STATE_INIT);
 			}
 			
 		}
@@ -88,17 +105,17 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF20");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, DOOR_MODULE_113KF20);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, DOOR_MODULE_114KF24);
 			
 			// Door open button
 			
-			auto pReleaseDoorSignal = pEnvironment->checkSignal ("releasedoor");
-			auto pSignalLockDoor = pEnvironment->checkSignal ("lockdoor");
+			auto pReleaseDoorSignal = pEnvironment->checkSignal (DOOR_SIGNAL_RELEASEDOOR);
+			auto pSignalLockDoor = pEnvironment->checkSignal (DOOR_SIGNAL_LOCKDOOR);
 					
 			if(pDigitalInputModule->getInput(1) || (pReleaseDoorSignal != nullptr)){
 				// if door release button is pressed release the door for 10s and set next state unlocked_closed
-				pEnvironment->setNextState ("unlocked_closed");
+				pEnvironment->setNextState (DOOR_STATE_UNLOCKED_CLOSED);
 				pDigitalOutputModule->setOutput(1, true); // unlock the door
 				fbDelayUnlockDoor.IN = true;
 				fbDelayUnlockDoor.PT = 10000;
@@ -108,21 +125,21 @@ namespace BuRCPP {
 					pReleaseDoorSignal->finishProcessing ();
 				
 			}else if (pSignalLockDoor){
-				bool bDoorState = pSignalLockDoor->getBoolParameter ("doorstate");
+				bool bDoorState = pSignalLockDoor->getBoolParameter (SIGNAL_LOCKDOOR_PARAM_DOORSTATE);
 				if (bDoorState)
 				{
-					pEnvironment->setNextState ("locked_closed");
+					pEnvironment->setNextState (DOOR_STATE_LOCKED_CLOSED);
 				}
 				else
 				{
-					pEnvironment->setNextState ("locked_waitforrelease");	
+					pEnvironment->setNextState (DOOR_STATE_LOCKED_WAITFORRELEASE);	
 				}
 				pSignalLockDoor->finishProcessing ();
 
 			}
 			else{
 				// if door is open, remain in init
-				pEnvironment->setNextState ("locked_waitforrelease");
+				pEnvironment->setNextState (DOOR_STATE_LOCKED_WAITFORRELEASE);
 			}
 		}
 	
@@ -138,22 +155,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			auto pSignalLockDoor = pEnvironment->checkSignal ("lockdoor");
+			auto pSignalLockDoor = pEnvironment->checkSignal (DOOR_SIGNAL_LOCKDOOR);
 			
 			if (pSignalLockDoor){
-				bool bDoorState = pSignalLockDoor->getBoolParameter ("doorstate");
+				bool bDoorState = pSignalLockDoor->getBoolParameter (SIGNAL_LOCKDOOR_PARAM_DOORSTATE);
 				if (!bDoorState)
 				{
-					pEnvironment->setNextState ("locked_waitforrelease");
+					pEnvironment->setNextState (DOOR_STATE_LOCKED_WAITFORRELEASE);
 				}
 				else
 				{
-					pEnvironment->setNextState ("locked_closed");	
+					pEnvironment->setNextState (DOOR_STATE_LOCKED_CLOSED);	
 				}
 				pSignalLockDoor->finishProcessing ();
 
 			} else {
-				pEnvironment->setNextState ("locked_closed");
+				pEnvironment->setNextState (DOOR_STATE_LOCKED_CLOSED);
 			}
 			
 		}
@@ -172,9 +189,9 @@ namespace BuRCPP {
 		{
 			
 			// access io modules
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF20");
-			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, "115KF51");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, DOOR_MODULE_113KF20);
+			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, DOOR_MODULE_115KF51);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, DOOR_MODULE_114KF24);
 			
 			// reset timer function block input
 			fbDelayUnlockDoor.IN = false;
@@ -182,19 +199,19 @@ namespace BuRCPP {
 			// check if the door was opened
 			if (pSafetyDigitalInputModule->getInput(3) == false){
 				// if the door was openend set next state unlocked_open
-				pEnvironment->setNextState("unlocked_open");
+				pEnvironment->setNextState(DOOR_STATE_UNLOCKED_OPEN);
 			}
 			else{	
 				// if the door is closed, check if the door release singal is still holded
 				if (fbDelayUnlockDoor.Q){
 					// if it is holded, release the door and remain in the state unlocked_closed
 					pDigitalOutputModule->setOutput(1, true);
-					pEnvironment->setNextState("unlocked_closed");
+					pEnvironment->setNextState(DOOR_STATE_UNLOCKED_CLOSED);
 				}
 				else {
 					// if the dorr release signal has expired, lock the door and set next state to locked_closed
 					pDigitalOutputModule->setOutput(1, false);
-					pEnvironment->setNextState("locked_waitforrelease");
+					pEnvironment->setNextState(DOOR_STATE_LOCKED_WAITFORRELEASE);
 				}
 			}
 				
@@ -216,25 +233,25 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, "115KF51");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule (pEnvironment, DOOR_MODULE_115KF51);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, DOOR_MODULE_114KF24);
 			
 			// if the door is closed, check if the door release singal is still holded
 			if (fbDelayUnlockDoor.Q){
 				// if it is holded, release the door and remain in the state unlocked_closed
 				pDigitalOutputModule->setOutput(1, true);
-				pEnvironment->setNextState("unlocked_open");
+				pEnvironment->setNextState(DOOR_STATE_UNLOCKED_OPEN);
 			} else if (fbDelayUnlockDoor.Q == false){
 				// if it is holded, release the door and remain in the state unlocked_closed
 				pDigitalOutputModule->setOutput(1, false);
-				pEnvironment->setNextState("unlocked_open");
+				pEnvironment->setNextState(DOOR_STATE_UNLOCKED_OPEN);
 			}
 			
 			if (pSafetyDigitalInputModule->getInput(3)&& pSafetyDigitalInputModule->getInput(4)){
-				pEnvironment->setNextState("locked_waitforrelease");
+				pEnvironment->setNextState(DOOR_STATE_LOCKED_WAITFORRELEASE);
 			}
 			else if (pSafetyDigitalInputModule->getInput(3)  == false || pSafetyDigitalInputModule->getInput(4) == false){
-				pEnvironment->setNextState("unlocked_open");
+				pEnvironment->setNextState(DOOR_STATE_UNLOCKED_OPEN);
 			}
 		
 		TOF(&fbDelayUnlockDoor);
@@ -244,27 +261,65 @@ namespace BuRCPP {
 	
 
 
+	class CStateDoor_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// lock the door, the output is written even if the module is faulted
+			auto pDigitalOutputModule = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (DOOR_MODULE_114KF24);
+			pDigitalOutputModule->setOutput(1, false);
+			
+			// start over once all modules are available again
+			if (pEnvironment->boundModulesAreAvailable ()) {
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState(DOOR_STATE_INIT);
+			} else {
+				pEnvironment->setNextState(DOOR_STATE_FAULT);
+			}
+		}
+	
+	};
+	
+
+
 	class CDoorStateHandler : public CStateHandler {
 		public:
 
 		CDoorStateHandler (CApplication* pApplication)
 			: CStateHandler (pApplication->getJournal (), "door", pApplication->getModuleHandler (), JOURNALGROUP_DOOR)
 		{
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20SI8110> (DOOR_MODULE_115KF51, "115KF51");
+			bindModule<CIOModule_X20DO6322> (DOOR_MODULE_114KF24, "114KF24");
+			bindModule<CIOModule_X20DI6371> (DOOR_MODULE_113KF20, "113KF20");
+			
 				
 			//registerModule (std::make_shared<CIOModule_X20DI6371> ("113KF20", &IOMapping_113KF20), JOURNALGROUP_MODULE_GPIO3);
 		
 			
-			addState (std::make_shared<CStateDoor_Init> ());
-			addState (std::make_shared<CStateDoor_Locked_WaitForRelease> ());
-			addState (std::make_shared<CStateDoor_Unlocked_Open> ());
-			addState (std::make_shared<CStateDoor_Unlocked_Closed> ());
-			addState (std::make_shared<CStateDoor_Locked_Closed> ());
+			// register all states here, a registration out of order against the DOOR_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateDoor_Init> (), DOOR_STATE_INIT);
+			addState (std::make_shared<CStateDoor_Locked_WaitForRelease> (), DOOR_STATE_LOCKED_WAITFORRELEASE);
+			addState (std::make_shared<CStateDoor_Unlocked_Open> (), DOOR_STATE_UNLOCKED_OPEN);
+			addState (std::make_shared<CStateDoor_Unlocked_Closed> (), DOOR_STATE_UNLOCKED_CLOSED);
+			addState (std::make_shared<CStateDoor_Locked_Closed> (), DOOR_STATE_LOCKED_CLOSED);
+			addState (std::make_shared<CStateDoor_Fault> (), DOOR_STATE_FAULT);
+			
+			// a throwing state locks the door in the fault state
+			setFaultState (DOOR_STATE_FAULT);
 		
-			registerSignal ("releasedoor", 4, 1000);
+			// register all signals here, a registration out of order against the DOOR_SIGNAL_* IDs fails the initialization
+			registerSignal ("releasedoor", 4, 1000, DOOR_SIGNAL_RELEASEDOOR);
 			
-			auto pSignalLockDoor = registerSignal ("lockdoor", 4, 1000);
-			pSignalLockDoor->addBoolParameter ("doorstate", false);
-			pSignalLockDoor->addBoolResult ("success", false);
+			auto pSignalLockDoor = registerSignal ("lockdoor", 4, 1000, DOOR_SIGNAL_LOCKDOOR);
+			pSignalLockDoor->addBoolParameter ("doorstate", false, SIGNAL_LOCKDOOR_PARAM_DOORSTATE);
+			pSignalLockDoor->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		}
 	
 		virtual ~CDoorStateHandler ()		
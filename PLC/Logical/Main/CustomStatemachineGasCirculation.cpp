@@ -40,6 +40,31 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20AO4622.hpp"
 #include "Modules/IOModule_X20AI4622.hpp"
 
+// Module IDs of the gas circulation state machine, bound once in the state handler constructor
+#define GASCIRCULATION_MODULE_114KF28 0
+#define GASCIRCULATION_MODULE_114KF25 1
+#define GASCIRCULATION_MODULE_112KF12 2
+#define GASCIRCULATION_MODULE_113KF19 3
+#define GASCIRCULATION_MODULE_113KF18 4
+#define GASCIRCULATION_MODULE_113KF17 5
+#define GASCIRCULATION_MODULE_113KF21 6
+#define GASCIRCULATION_MODULE_112KF14 7
+
+// State IDs of the gas circulation state machine, in registration order
+#define GASCIRCULATION_STATE_INIT 0
+#define GASCIRCULATION_STATE_IDLE 1
+#define GASCIRCULATION_STATE_WAIT_FOR_OXYGENLEVEL 2
+#define GASCIRCULATION_STATE_GAS_FLOW_ON 3
+#define GASCIRCULATION_STATE_ERROR 4
+#define GASCIRCULATION_STATE_FAULT 5
+
+// Signal IDs of the gas circulation state machine, in registration order
+#define GASCIRCULATION_SIGNAL_INITATMOSPHERECONTROL 0
+#define GASCIRCULATION_SIGNAL_TOGGLEVALVES 1
+#define GASCIRCULATION_SIGNAL_STARTGASFLOW 2
+#define GASCIRCULATION_SIGNAL_UPDATEGASFLOWSETPOINT 3
+#define GASCIRCULATION_SIGNAL_TURNOFFGASFLOW 4
+
 
 
 
@@ -55,11 +80,11 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, "114KF28"); // enable pump
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, "114KF25"); // set valves
-			ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, "112KF12"); // setpoint pump
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pump ventilation error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, GASCIRCULATION_MODULE_114KF28); // enable pump
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, GASCIRCULATION_MODULE_114KF25); // set valves
+			ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, GASCIRCULATION_MODULE_112KF12); // setpoint pump
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, GASCIRCULATION_MODULE_113KF19);// pump ventilation error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, GASCIRCULATION_MODULE_113KF18);// pump error
 			
 			pDigitalOutputModule_1->setOutput(1, false); // disable pump
 			pAnalogOutputModule->setOutputVoltageInVolt (1, 0.0); // set setpoint to 0.0 V
@@ -68,25 +93,25 @@ namespace BuRCPP {
 			pDigitalOutputModule_2->setOutput(2, false);
 			
 			// Signal from PC
-			auto pSignalInitAtmosphereControl = pEnvironment->checkSignal ("initatmospherecontrol");
+			auto pSignalInitAtmosphereControl = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_INITATMOSPHERECONTROL);
 			
 			if (pSignalInitAtmosphereControl)
 			{
-				int circulation_on_threshold = pSignalInitAtmosphereControl->getInt32Parameter("o2thresholdcirculationoninppm");
-				int circulation_off_threshold = pSignalInitAtmosphereControl->getInt32Parameter("o2thresholdcirculationoffinppm");
+				int circulation_on_threshold = pSignalInitAtmosphereControl->getInt32Parameter(SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDONINPPM);
+				int circulation_off_threshold = pSignalInitAtmosphereControl->getInt32Parameter(SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDOFFINPPM);
 				pEnvironment->setIntegerValue(JOURNALVARIABLE_O2_THRESHOLD_CIRCULATION_ON_IN_PPM, circulation_on_threshold);
 				pEnvironment->setIntegerValue(JOURNALVARIABLE_O2_THRESHOLD_CIRCULATION_OFF_IN_PPM, circulation_off_threshold);
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(GASCIRCULATION_STATE_IDLE);
 				pSignalInitAtmosphereControl->finishProcessing ();
 			}
 			else 
 			{
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(GASCIRCULATION_STATE_INIT);
 			}
 			
 			if (pDigitalInputModule_1->getInput(3)==1 || pDigitalInputModule_2->getInput(3)==0)
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(GASCIRCULATION_STATE_ERROR);
 			}
 		}
 	};
@@ -103,16 +128,16 @@ class CStateGasCirculation_error : public CState {
 	void Execute (CEnvironment * pEnvironment) 
 	{
 		// access io modules
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pump ventilation error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, GASCIRCULATION_MODULE_113KF19);// pump ventilation error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, GASCIRCULATION_MODULE_113KF18);// pump error
 				
 		if (pDigitalInputModule_1->getInput(3)==1 || pDigitalInputModule_2->getInput(3)==0)
 		{
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_ERROR);
 		}
 		else
 		{
-			pEnvironment->setNextState("init");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_INIT);
 		}
 	}
 	
@@ -129,22 +154,22 @@ class CStateGasCirculation_idle : public CState {
 	void Execute (CEnvironment * pEnvironment) 
 	{
 		// access io modules
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pump ventilation error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, "113KF17");// get circulation valves status
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_4(pEnvironment, "113KF21");// get vacuum valves status
-		ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, "112KF12"); // setpoint pump
-		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF25"); // set valves
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, GASCIRCULATION_MODULE_113KF19);// pump ventilation error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, GASCIRCULATION_MODULE_113KF18);// pump error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, GASCIRCULATION_MODULE_113KF17);// get circulation valves status
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_4(pEnvironment, GASCIRCULATION_MODULE_113KF21);// get vacuum valves status
+		ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, GASCIRCULATION_MODULE_112KF12); // setpoint pump
+		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, GASCIRCULATION_MODULE_114KF25); // set valves
 			
 		// Signal from PC
-		auto pSignalStartGasFlow = pEnvironment->checkSignal ("startgasflow");
-		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal ("updategasflowsetpoint");
-		auto pSignalToggleValves = pEnvironment->checkSignal ("togglevalves");
+		auto pSignalStartGasFlow = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_STARTGASFLOW);
+		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_UPDATEGASFLOWSETPOINT);
+		auto pSignalToggleValves = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_TOGGLEVALVES);
 			
 		if (pSignalToggleValves) // toggle gas flow valves
 		{
-			bool toggle_heat_exchanger_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter("toggle_lower_gas_flow_circuit_valve");
-			bool toggle_chamber_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter("toggle_upper_gas_flow_circuit_valve");
+			bool toggle_heat_exchanger_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+			bool toggle_chamber_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
 				
 			pDigitalOutputModule->setOutput(1, toggle_chamber_gas_flow_circuit_valve);
 			pDigitalOutputModule->setOutput(2, toggle_heat_exchanger_gas_flow_circuit_valve);
@@ -154,26 +179,26 @@ class CStateGasCirculation_idle : public CState {
 			
 		if (pSignalUpdateGasFlowSetpoint)
 		{
-			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter("setpointinpercent");
+			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter(SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
 			pEnvironment->setIntegerValue(JOURNALVARIABLE_PUMPSETPOINTINPERCENT, setpointinpercent); //set journalvariable for setpoint
 			pSignalUpdateGasFlowSetpoint->finishProcessing ();
 		}
 				
 		if (pSignalStartGasFlow && pDigitalInputModule_3->getInput(1)==1 && pDigitalInputModule_3->getInput(3)==1 && pDigitalInputModule_4->getInput(2)==1 && pDigitalInputModule_4->getInput(4)==1)
 		{
-			int setpointinpercent = pSignalStartGasFlow->getInt32Parameter("setpointinpercent");
+			int setpointinpercent = pSignalStartGasFlow->getInt32Parameter(SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
 			pEnvironment->setIntegerValue(JOURNALVARIABLE_PUMPSETPOINTINPERCENT, setpointinpercent); //set journalvariable for setpoint
-			pEnvironment->setNextState("wait_for_oxygenlevel");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_WAIT_FOR_OXYGENLEVEL);
 			pSignalStartGasFlow->finishProcessing ();
 		}
 		else
 		{
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_IDLE);
 		}
 			
 		if (pDigitalInputModule_1->getInput(3)==1 || pDigitalInputModule_2->getInput(3)==0)
 		{
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_ERROR);
 		}
 	}
 	
@@ -190,17 +215,17 @@ class CStateGasCirculation_wait_for_oxygenlevel : public CState {
 	void Execute (CEnvironment * pEnvironment) 
 	{
 		// access io modules
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19"); //pump ventilation error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18"); //pump error
-		ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, GASCIRCULATION_MODULE_113KF19); //pump ventilation error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, GASCIRCULATION_MODULE_113KF18); //pump error
+		ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, GASCIRCULATION_MODULE_112KF14); // oxygen content value module
 			
 		// Signal from PC
-		auto pSignalTurnOffGasFlow = pEnvironment->checkSignal ("turnoffgasflow");
-		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal ("updategasflowsetpoint");
+		auto pSignalTurnOffGasFlow = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_TURNOFFGASFLOW);
+		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_UPDATEGASFLOWSETPOINT);
 				
 		if (pSignalUpdateGasFlowSetpoint)
 		{
-			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter("setpointinpercent");
+			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter(SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
 			pEnvironment->setIntegerValue(JOURNALVARIABLE_PUMPSETPOINTINPERCENT, setpointinpercent); //set journalvariable for setpoint
 			pSignalUpdateGasFlowSetpoint->finishProcessing ();
 		}
@@ -210,22 +235,22 @@ class CStateGasCirculation_wait_for_oxygenlevel : public CState {
 			
 		if (o2inpercent_filter*FACTOR_PERCENT_TO_PPM < circulation_on_o2thresholdinppm)
 		{
-			pEnvironment->setNextState("gas_flow_on");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_GAS_FLOW_ON);
 		}
 		else
 		{
-			pEnvironment->setNextState("wait_for_oxygenlevel");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_WAIT_FOR_OXYGENLEVEL);
 		}
 				
 		if (pSignalTurnOffGasFlow)
 		{		
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_IDLE);
 			pSignalTurnOffGasFlow->finishProcessing ();
 		}
 				
 		if (pDigitalInputModule_1->getInput(3)==1 || pDigitalInputModule_2->getInput(3)==0)
 		{	
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_ERROR);
 		}
 	}
 		
@@ -242,21 +267,21 @@ class CStateGasCirculation_gas_flow_on : public CState {
 	void Execute (CEnvironment * pEnvironment) 
 	{
 		// access io modules
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pump ventilation error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
-		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, "113KF17"); //feedback from circulation valves
-		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, "114KF28"); // enable pump
-		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, "114KF25"); //output vacuum valves	
-		ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, "112KF12"); // setpoint pump
-		ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, GASCIRCULATION_MODULE_113KF19);// pump ventilation error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, GASCIRCULATION_MODULE_113KF18);// pump error
+		ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, GASCIRCULATION_MODULE_113KF17); //feedback from circulation valves
+		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, GASCIRCULATION_MODULE_114KF28); // enable pump
+		ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, GASCIRCULATION_MODULE_114KF25); //output vacuum valves	
+		ioModuleAccess<CIOModule_X20AO4622> pAnalogOutputModule(pEnvironment, GASCIRCULATION_MODULE_112KF12); // setpoint pump
+		ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, GASCIRCULATION_MODULE_112KF14); // oxygen content value module
 			
 		// Signal from PC
-		auto pSignalTurnOffGasFlow = pEnvironment->checkSignal ("turnoffgasflow");
-		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal ("updategasflowsetpoint");
+		auto pSignalTurnOffGasFlow = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_TURNOFFGASFLOW);
+		auto pSignalUpdateGasFlowSetpoint = pEnvironment->checkSignal (GASCIRCULATION_SIGNAL_UPDATEGASFLOWSETPOINT);
 			
 		if (pSignalUpdateGasFlowSetpoint)
 		{
-			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter("setpointinpercent");
+			int setpointinpercent = pSignalUpdateGasFlowSetpoint->getInt32Parameter(SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
 			pEnvironment->setIntegerValue(JOURNALVARIABLE_PUMPSETPOINTINPERCENT, setpointinpercent); //set journalvariable for setpoint
 			pSignalUpdateGasFlowSetpoint->finishProcessing ();
 		}
@@ -271,13 +296,13 @@ class CStateGasCirculation_gas_flow_on : public CState {
 		
 		if (o2inpercent_filter*FACTOR_PERCENT_TO_PPM < circulation_off_o2thresholdinppm)
 		{
-			pEnvironment->setNextState("gas_flow_on");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_GAS_FLOW_ON);
 		}
 		else
 		{
 			pDigitalOutputModule_1->setOutput(1, false); // disable pump
 			pAnalogOutputModule->setOutputVoltageInVolt (1, 0.0); // set setpoint to 0.0 V	
-			pEnvironment->setNextState("wait_for_oxygenlevel");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_WAIT_FOR_OXYGENLEVEL);
 		}
 					
 		if (pSignalTurnOffGasFlow)
@@ -285,7 +310,7 @@ class CStateGasCirculation_gas_flow_on : public CState {
 			pDigitalOutputModule_1->setOutput(1, false); // disable pump
 			pAnalogOutputModule->setOutputVoltageInVolt (1, 0.0); // set setpoint to 0.0 V	
 							
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_IDLE);
 			pSignalTurnOffGasFlow->finishProcessing ();
 		}
 					
@@ -294,12 +319,47 @@ class CStateGasCirculation_gas_flow_on : public CState {
 			pDigitalOutputModule_1->setOutput(1, false); // disable pump
 			pAnalogOutputModule->setOutputVoltageInVolt (1, 0.0); // set setpoint to 0.0 V
 					
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(GASCIRCULATION_STATE_ERROR);
 		}
 	}
 		
 };		
 	
+class CStateGasCirculation_fault : public CState {
+	public:
+
+	std::string getName () 
+	{
+		return "fault";
+	}
+
+	void Execute (CEnvironment * pEnvironment) 
+	{
+		// the outputs are written even if the modules are faulted
+		auto pDigitalOutputModule_1 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (GASCIRCULATION_MODULE_114KF28); // enable pump
+		auto pDigitalOutputModule_2 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (GASCIRCULATION_MODULE_114KF25); // set valves
+		auto pAnalogOutputModule = pEnvironment->getModuleForFaultState<CIOModule_X20AO4622> (GASCIRCULATION_MODULE_112KF12); // setpoint pump
+		
+		pDigitalOutputModule_1->setOutput(1, false); // disable pump
+		pAnalogOutputModule->setOutputVoltageInVolt (1, 0.0); // set setpoint to 0.0 V
+		
+		pDigitalOutputModule_2->setOutput(1, false); // close circulation valves
+		pDigitalOutputModule_2->setOutput(2, false);
+		
+		// start over once all modules are available again
+		if (pEnvironment->boundModulesAreAvailable ())
+		{
+			pEnvironment->clearFault ();
+			pEnvironment->setNextState(GASCIRCULATION_STATE_INIT);
+		}
+		else
+		{
+			pEnvironment->setNextState(GASCIRCULATION_STATE_FAULT);
+		}
+	}
+	
+};
+	
 class CStateHandlerGasCirculation : public CStateHandler {
 	public:
 
@@ -307,37 +367,51 @@ class CStateHandlerGasCirculation : public CStateHandler {
 		// retrieve the journal group variable for this template state machine
 		: CStateHandler (pApplication->getJournal (), "gascirculation", pApplication->getModuleHandler (), JOURNALGROUP_GAS_CIRCULATION)
 	{
-		// register all states of this state machine here
-		addState (std::make_shared<CStateGasCirculation_Init> ());
-		addState (std::make_shared<CStateGasCirculation_idle> ());
-		addState (std::make_shared<CStateGasCirculation_wait_for_oxygenlevel> ());
-		addState (std::make_shared<CStateGasCirculation_gas_flow_on> ());
-		addState (std::make_shared<CStateGasCirculation_error> ());
+		// bind the modules used by the states, a missing or mistyped module fails the initialization
+		bindModule<CIOModule_X20DO6322> (GASCIRCULATION_MODULE_114KF28, "114KF28");
+		bindModule<CIOModule_X20DO6322> (GASCIRCULATION_MODULE_114KF25, "114KF25");
+		bindModule<CIOModule_X20AO4622> (GASCIRCULATION_MODULE_112KF12, "112KF12");
+		bindModule<CIOModule_X20DI6371> (GASCIRCULATION_MODULE_113KF19, "113KF19");
+		bindModule<CIOModule_X20DI6371> (GASCIRCULATION_MODULE_113KF18, "113KF18");
+		bindModule<CIOModule_X20DI6371> (GASCIRCULATION_MODULE_113KF17, "113KF17");
+		bindModule<CIOModule_X20DI6371> (GASCIRCULATION_MODULE_113KF21, "113KF21");
+		bindModule<CIOModule_X20AI4622> (GASCIRCULATION_MODULE_112KF14, "112KF14");
+		
+		// register all states of this state machine here, a registration out of order against the GASCIRCULATION_STATE_* IDs fails the initialization
+		addState (std::make_shared<CStateGasCirculation_Init> (), GASCIRCULATION_STATE_INIT);
+		addState (std::make_shared<CStateGasCirculation_idle> (), GASCIRCULATION_STATE_IDLE);
+		addState (std::make_shared<CStateGasCirculation_wait_for_oxygenlevel> (), GASCIRCULATION_STATE_WAIT_FOR_OXYGENLEVEL);
+		addState (std::make_shared<CStateGasCirculation_gas_flow_on> (), GASCIRCULATION_STATE_GAS_FLOW_ON);
+		addState (std::make_shared<CStateGasCirculation_error> (), GASCIRCULATION_STATE_ERROR);
+		addState (std::make_shared<CStateGasCirculation_fault> (), GASCIRCULATION_STATE_FAULT);
+		
+		// a throwing state stops the pump and closes the valves in the fault state
+		setFaultState (GASCIRCULATION_STATE_FAULT);
 		
-		//register signal
-		auto pSignalInitAtmosphereControl = registerSignal ("initatmospherecontrol", 4, 1000);
-		pSignalInitAtmosphereControl->addInt32Parameter ("o2thresholdcirculationoninppm", 0);
-		pSignalInitAtmosphereControl->addInt32Parameter ("o2thresholdcirculationoffinppm", 0);
-		pSignalInitAtmosphereControl->addBoolResult ("success", false);
+		//register signal, a registration out of order against the GASCIRCULATION_SIGNAL_* IDs fails the initialization
+		auto pSignalInitAtmosphereControl = registerSignal ("initatmospherecontrol", 4, 1000, GASCIRCULATION_SIGNAL_INITATMOSPHERECONTROL);
+		pSignalInitAtmosphereControl->addInt32Parameter ("o2thresholdcirculationoninppm", 0, SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDONINPPM);
+		pSignalInitAtmosphereControl->addInt32Parameter ("o2thresholdcirculationoffinppm", 0, SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDOFFINPPM);
+		pSignalInitAtmosphereControl->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-		auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000);
-		pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false);
-		pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false);
-		pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false);
-		pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false);
-		pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false);
-		pSignalToggleValves->addBoolResult ("success", false);
+		auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000, GASCIRCULATION_SIGNAL_TOGGLEVALVES);
+		pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+		pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
+		pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false, SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
+		pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
+		pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+		pSignalToggleValves->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-		auto pSignalStartGasFlow = registerSignal ("startgasflow", 4, 1000);
-		pSignalStartGasFlow->addInt32Parameter ("setpointinpercent", 0);
-		pSignalStartGasFlow->addBoolResult ("success", false);
+		auto pSignalStartGasFlow = registerSignal ("startgasflow", 4, 1000, GASCIRCULATION_SIGNAL_STARTGASFLOW);
+		pSignalStartGasFlow->addInt32Parameter ("setpointinpercent", 0, SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
+		pSignalStartGasFlow->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-		auto pSignalUpdateGasFlowSetpoint = registerSignal ("updategasflowsetpoint", 4, 1000);
-		pSignalUpdateGasFlowSetpoint->addInt32Parameter ("setpointinpercent", 0);
-		pSignalUpdateGasFlowSetpoint->addBoolResult ("success", false);
+		auto pSignalUpdateGasFlowSetpoint = registerSignal ("updategasflowsetpoint", 4, 1000, GASCIRCULATION_SIGNAL_UPDATEGASFLOWSETPOINT);
+		pSignalUpdateGasFlowSetpoint->addInt32Parameter ("setpointinpercent", 0, SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT);
+		pSignalUpdateGasFlowSetpoint->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-		auto pSignalTurnOffGasFlow = registerSignal ("turnoffgasflow", 4, 1000);
-		pSignalTurnOffGasFlow->addBoolResult ("success", false);	
+		auto pSignalTurnOffGasFlow = registerSignal ("turnoffgasflow", 4, 1000, GASCIRCULATION_SIGNAL_TURNOFFGASFLOW);
+		pSignalTurnOffGasFlow->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);	
 				
 		// register journal variables
 		registerIntegerValue("pumpsetpointinpercent", JOURNALVARIABLE_PUMPSETPOINTINPERCENT, 0, 100);
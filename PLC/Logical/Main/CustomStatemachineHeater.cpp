@@ -40,6 +40,33 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20DI6371.hpp"
 #include "Modules/IOModule_X20DO6322.hpp"
 
+// Module IDs of the heater state machine, bound once in the state handler constructor
+#define HEATER_MODULE_112KF15 0
+#define HEATER_MODULE_113KF18 1
+#define HEATER_MODULE_114KF28 2
+
+// State IDs of the heater state machine, in registration order
+#define HEATER_STATE_WAIT_FOR_INIT 0
+#define HEATER_STATE_INIT 1
+#define HEATER_STATE_IDLE_DISABLED 2
+#define HEATER_STATE_UPDATE_PARAMETERS 3
+#define HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE 4
+#define HEATER_STATE_HEATING_CONTROL_ENABLED 5
+#define HEATER_STATE_TUNE_CONTROL_PARAMETERS 6
+#define HEATER_STATE_WAIT_FOR_TUNING 7
+#define HEATER_STATE_ERROR 8
+#define HEATER_STATE_FAULT 9
+
+// Signal IDs of the heater state machine, in registration order
+#define HEATER_SIGNAL_ENABLECONTROLLER 0
+#define HEATER_SIGNAL_UPDATECONTROLLERPARAMETERS 1
+#define HEATER_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS 2
+#define HEATER_SIGNAL_UPDATECONTROLLERPWMPARAMETERS 3
+#define HEATER_SIGNAL_UPDATECONTROLLERSETPOINT 4
+#define HEATER_SIGNAL_AUTOTUNECONTROLLER 5
+#define HEATER_SIGNAL_ABORTAUTOTUNINGCONTROLLER 6
+#define HEATER_SIGNAL_DISABLECONTROLLER 7
+
 
 namespace BuRCPP {
 	
@@ -57,14 +84,14 @@ namespace BuRCPP {
 			// access an IO modules
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			// check for PC signals
-			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal ("updatecontrollerparameters");
-			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal ("updatecontrollertunerparameters");
-			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal ("updatecontrollerpwmparameters");
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint");
+			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERPARAMETERS);
+			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS);
+			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERPWMPARAMETERS);
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERSETPOINT);
 			
 			// check if the control function block, the temperature sensor, and the heater protection switch are OK 
 			if(fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
@@ -72,19 +99,19 @@ namespace BuRCPP {
 					
 				if(pSignalUpdateControllerPidParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_INIT);
 					if(bIsInitPID)
 					{
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_PID_ISINIT, true);
 					
 						//retrieve the PID update parameters 
-						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter("derivativetime")* 0.001;
-						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter("integrationtime")* 0.001;
-						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter("gain")*0.001;
-						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter("filtertime")* 0.001;
-						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter("maxout");
-						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter("minout");
+						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME)* 0.001;
+						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME)* 0.001;
+						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN)*0.001;
+						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME)* 0.001;
+						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
 				
 			
 						// store the PID parameters in journal variables
@@ -100,18 +127,18 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerTunerParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_INIT);
 					if(bIsInitTuner)
 					{	
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_TUNE_ISINIT, true);
 
 						//retrieve the PID tuner update parameters 
-						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter("stepheight");
-						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxactvalue");
-						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("minactvalue");
-						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("systemsettlingtime")/1000.0;
-						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxtuningtime")/1000.0;
+						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME)/1000.0;
+						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME)/1000.0;
 								
 						// store the PID tuner parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_TUNE_STEPHEIGHTINDEGREECELCIUS,  nStepHeight);
@@ -125,17 +152,17 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerPwmParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_INIT);
 					if(bIsInitPWM)
 					{
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_PWM_ISINIT, true);
 			
 						// retrieve the parameters to update the heater PWM function block
-						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter("dutycycle");
-						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter("period")/1000;
-						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter("maxFrequency");
-						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter("mode");
+						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD)/1000;
+						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
 								
 						// store the heater PWM function block parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_PWM_DUTYCYCLE,  nDutyCycle);
@@ -148,14 +175,14 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ // check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_INIT);
 					if(bIsInitSetpoint)
 					{	
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_SETPOINT_ISINIT, true);
 		
 						// retrieve the parameter to update the heater temperature setpoint
-						int nSetvalue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						int nSetvalue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 							
 						// store the heater temperature setpoint in journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_SETPOINTINDEGREECELCIUS,  nSetvalue);
@@ -172,7 +199,7 @@ namespace BuRCPP {
 					bool bIsInitSetpoint = pEnvironment->getBoolValue(JOURNALVARIABLE_HEATER_SETPOINT_ISINIT);
 					
 					if (bIsInitPWM && bIsInitTuner && bIsInitPID && bIsInitSetpoint){
-						pEnvironment->setNextState ("init");
+						pEnvironment->setNextState (HEATER_STATE_INIT);
 						// reset the init flags
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_PID_ISINIT, false);
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_TUNE_ISINIT, false);
@@ -180,7 +207,7 @@ namespace BuRCPP {
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_SETPOINT_ISINIT, false);
 					}else
 					{ // wait for the init parameter signal from the PC
-						pEnvironment->setNextState ("wait_for_init");
+						pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_INIT);
 					}
 					
 				}
@@ -190,7 +217,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -213,8 +240,8 @@ namespace BuRCPP {
 			// access an IO modules
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			// check if the control function block, the temperature sensor, and the heater protection switch are OK 
 			if(fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
@@ -290,7 +317,7 @@ namespace BuRCPP {
 				//currently, default values are used
 				fbBuildPlatformTempPWM.Update = true;		
 				
-				pEnvironment->setNextState ("wait_for_parameter_update");
+				pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE);
 		
 			}
 			else
@@ -298,7 +325,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}	
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -320,16 +347,16 @@ namespace BuRCPP {
 			// access an IO modules
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			// check for signals
-			auto pSignalEnableBuildPlateTempControl = pEnvironment->checkSignal ("enablecontroller"); //signal to enable the controller
-			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal ("updatecontrollerparameters"); //signal to update the PID parameters
-			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal ("updatecontrollertunerparameters"); //signal to update the parameters of the tuner
-			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal ("updatecontrollerpwmparameters"); //signal to update the PWM parameters
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint"); //signal to update the setpoint
-			auto pSignalAutoTuneController = pEnvironment->checkSignal ("autotunecontroller"); //signal to update the setpoint
+			auto pSignalEnableBuildPlateTempControl = pEnvironment->checkSignal (HEATER_SIGNAL_ENABLECONTROLLER); //signal to enable the controller
+			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERPARAMETERS); //signal to update the PID parameters
+			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS); //signal to update the parameters of the tuner
+			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERPWMPARAMETERS); //signal to update the PWM parameters
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERSETPOINT); //signal to update the setpoint
+			auto pSignalAutoTuneController = pEnvironment->checkSignal (HEATER_SIGNAL_AUTOTUNECONTROLLER); //signal to update the setpoint
 			
 			fbBuildPlatformTempController.Enable = 0;
 			fbBuildPlatformTempPWM.Enable = 0;
@@ -341,19 +368,19 @@ namespace BuRCPP {
 				
 				if(pSignalUpdateControllerPidParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter("isinit");
+					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitPID)
 					{
 						//retrieve the PID update parameters 
-						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter("derivativetime")* 0.001;
-						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter("integrationtime")* 0.001;
-						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter("gain")*0.001;
-						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter("filtertime")* 0.001;
-						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter("maxout");
-						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter("minout");
+						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME)* 0.001;
+						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME)* 0.001;
+						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN)*0.001;
+						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME)* 0.001;
+						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
 					
 					
 						// store the PID parameters in journal variables
@@ -365,25 +392,25 @@ namespace BuRCPP {
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_MINOUTINPERCENT,  nMinOut);
 						
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (HEATER_STATE_UPDATE_PARAMETERS);
 					}
 					// finish processing of the signals
 					pSignalUpdateControllerPidParameters->finishProcessing ();
 				}
 				else if(pSignalUpdateControllerTunerParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter("isinit");
+					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitTuner)
 					{				
 						//retrieve the PID tuner update parameters 
-						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter("stepheight");
-						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxactvalue");
-						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("minactvalue");
-						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("systemsettlingtime")/1000;
-						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxtuningtime")/1000;
+						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME)/1000;
+						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME)/1000;
 										
 						// store the PID tuner parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_TUNE_STEPHEIGHTINDEGREECELCIUS,  nStepHeight);
@@ -393,24 +420,24 @@ namespace BuRCPP {
 						pEnvironment->setDoubleValue(JOURNALVARIABLE_HEATER_TUNE_MAXTUNINGTIMEINSECONDS,  dMaxTuningTime);
 						
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (HEATER_STATE_UPDATE_PARAMETERS);
 					}
 					// finish processing of the signals
 					pSignalUpdateControllerTunerParameters->finishProcessing ();
 				}
 				else if(pSignalUpdateControllerPwmParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter("isinit");
+					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitPWM)
 					{
 						// retrieve the parameters to update the heater PWM function block
-						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter("dutycycle");
-						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter("period")/1000;
-						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter("maxFrequency");
-						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter("mode");
+						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD)/1000;
+						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
 										
 						// store the heater PWM function block parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_PWM_DUTYCYCLE,  nDutyCycle);
@@ -419,22 +446,22 @@ namespace BuRCPP {
 						pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_PWM_MODE,  bMode);
 					
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (HEATER_STATE_UPDATE_PARAMETERS);
 					}
 					// finish processing of the signals
 					pSignalUpdateControllerPwmParameters->finishProcessing ();
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ // check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitSetpoint)
 					{
 						//signal from PC to update the setpoint 
 						//retrieve new setpoint from signal
-						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 						//store setpoint in the journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_SETPOINTINDEGREECELCIUS,  nSetValue);
 						//set new setpoint
@@ -447,11 +474,11 @@ namespace BuRCPP {
 				{ // signal from PC to perform a parameter tuning
 					
 					//retrieve the PID tuner update parameters 
-					int nStepHeight = pSignalAutoTuneController->getInt32Parameter("stepheight");
-					int nMaxActValue = pSignalAutoTuneController->getInt32Parameter("maxactvalue");
-					int nMinActValue = pSignalAutoTuneController->getInt32Parameter("minactvalue");
-					double dSystemSettlingTime = pSignalAutoTuneController->getInt32Parameter("systemsettlingtime")/1000;
-					double dMaxTuningTime = pSignalAutoTuneController->getInt32Parameter("maxtuningtime")/1000;
+					int nStepHeight = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT);
+					int nMaxActValue = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE);
+					int nMinActValue = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE);
+					double dSystemSettlingTime = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME)/1000;
+					double dMaxTuningTime = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME)/1000;
 										
 					// store the PID tuner parameters in journal variables
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_TUNE_STEPHEIGHTINDEGREECELCIUS,  nStepHeight);
@@ -464,18 +491,18 @@ namespace BuRCPP {
 					pSignalAutoTuneController->finishProcessing ();
 						
 					// go to init state
-					pEnvironment->setNextState ("tune_control_parameters");
+					pEnvironment->setNextState (HEATER_STATE_TUNE_CONTROL_PARAMETERS);
 				}
 				else if(pSignalEnableBuildPlateTempControl)
 				{ // enable the controller
 					fbBuildPlatformTempController.Enable = 1;
 					fbBuildPlatformTempPWM.Enable = 1;
 					fbBuildPlatfromTempTuner.Enable = 1;
-					pEnvironment->setNextState ("heating_control_enabled");
+					pEnvironment->setNextState (HEATER_STATE_HEATING_CONTROL_ENABLED);
 				}
 				else
 				{
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 				}
 				
 			}
@@ -484,7 +511,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -507,8 +534,8 @@ namespace BuRCPP {
 			// access an IO modules
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			fbBuildPlatfromTempTuner.Enable = 1;
 			fbBuildPlatformTempPWM.Enable = 1;
@@ -579,14 +606,14 @@ namespace BuRCPP {
 					//currently, default values are used
 					fbBuildPlatformTempPWM.Update = true;		
 				
-					pEnvironment->setNextState ("wait_for_parameter_update");
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE);
 			}
 			else
 			{ // if there is an error occured, diable the heater control function bocks and switch to the error state
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -608,8 +635,8 @@ namespace BuRCPP {
 			// access an IO modules
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			// check if there is an error --> error state
 			if(fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
@@ -622,11 +649,11 @@ namespace BuRCPP {
 					fbBuildPlatformTempController.Enable = false;
 					fbBuildPlatfromTempTuner.Enable = false;
 					fbBuildPlatformTempPWM.Enable = false;
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 				}
 				else
 				{	//if the update is not yet done, remain in the wait_for_parameter_update state
-					pEnvironment->setNextState ("wait_for_parameter_update");
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE);
 				}
 			}
 			else
@@ -634,7 +661,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -658,13 +685,13 @@ namespace BuRCPP {
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
 			// Build plate heating relais, Modul: 114KF28; DO Channel: 3
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF28");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, HEATER_MODULE_114KF28);
 			
 			//check for signals
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint"); //signal to update the setpoint
-			auto pSignalDisableBuildPlateTempControl = pEnvironment->checkSignal ("disablecontroller"); //signal to disable the controller
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (HEATER_SIGNAL_UPDATECONTROLLERSETPOINT); //signal to update the setpoint
+			auto pSignalDisableBuildPlateTempControl = pEnvironment->checkSignal (HEATER_SIGNAL_DISABLECONTROLLER); //signal to disable the controller
 			
 				
 			// check if there is an error --> error state
@@ -675,18 +702,18 @@ namespace BuRCPP {
 				{// disable control signal from the PC
 					fbBuildPlatformTempController.Enable = 0;
 					pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_CONTROLLER_ENABLED,  false); // set the heater controller enabled flag
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (HEATER_STATE_IDLE_DISABLED);
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ //signal from PC to update the setpoint
 					
 					// check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
 					
 					if(!bIsInitSetpoint)
 					{
 						//retrieve new setpoint from signal
-						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 						//store setpoint in the journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_HEATER_SETPOINTINDEGREECELCIUS,  nSetValue);
 						//set new setpoint
@@ -695,7 +722,7 @@ namespace BuRCPP {
 					// finish processing of the signal
 					pSignalUpdateControllerSetpoint->finishProcessing ();
 					pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_CONTROLLER_ENABLED,  true); // set the heater controller enabled flag
-					pEnvironment->setNextState ("heating_control_enabled");
+					pEnvironment->setNextState (HEATER_STATE_HEATING_CONTROL_ENABLED);
 				}
 				else
 				{	
@@ -703,7 +730,7 @@ namespace BuRCPP {
 					fbBuildPlatformTempPWM.DutyCycle = fbBuildPlatformTempController.Out; // transform PID control output to a PID signal
 					pDigitalOutputModule->setOutput(3, fbBuildPlatformTempPWM.Out); // set the heater output according to the PID signal
 					pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_CONTROLLER_ENABLED,  true); // set the heater controller enabled flag
-					pEnvironment->setNextState ("heating_control_enabled");
+					pEnvironment->setNextState (HEATER_STATE_HEATING_CONTROL_ENABLED);
 				}
 					
 			}
@@ -713,7 +740,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
 				pEnvironment->setBoolValue(JOURNALVARIABLE_HEATER_CONTROLLER_ENABLED,  false); // set the heater controller enabled flag
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -736,8 +763,8 @@ namespace BuRCPP {
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
 			// Build plate heating relais, Modul: 114KF28; DO Channel: 3
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			// check if there is an error --> error state
 			if(fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
@@ -767,13 +794,13 @@ namespace BuRCPP {
 					
 					fbBuildPlatfromTempTuner.Update = true;
 					fbBuildPlatfromTempTuner.Start = false;
-					pEnvironment->setNextState ("tune_control_parameters");
+					pEnvironment->setNextState (HEATER_STATE_TUNE_CONTROL_PARAMETERS);
 				} 
 				else if(fbBuildPlatfromTempTuner.UpdateDone)
 				{	
 					fbBuildPlatfromTempTuner.Update = false;
 					fbBuildPlatfromTempTuner.Start = true;
-					pEnvironment->setNextState ("wait_for_tuning");
+					pEnvironment->setNextState (HEATER_STATE_WAIT_FOR_TUNING);
 				}	
 			}
 			else
@@ -781,7 +808,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempController.Enable = 0;
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -804,12 +831,12 @@ namespace BuRCPP {
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
 			// Build plate heating relais, Modul: 114KF28; DO Channel: 3
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF28");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, HEATER_MODULE_114KF28);
 			
 			//check for signals
-			auto pSignalAbortAutoTuningController = pEnvironment->checkSignal ("abortautotuningcontroller"); //signal to abort the auto tuning
+			auto pSignalAbortAutoTuningController = pEnvironment->checkSignal (HEATER_SIGNAL_ABORTAUTOTUNINGCONTROLLER); //signal to abort the auto tuning
 			
 			// check if there is an error --> error state
 			if(fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
@@ -824,7 +851,7 @@ namespace BuRCPP {
 					fbBuildPlatformTempController.Update = true;
 					fbBuildPlatformTempPWM.Update = true;
 					fbBuildPlatfromTempTuner.Update = true;
-					pEnvironment->setNextState("wait_for_parameter_update");
+					pEnvironment->setNextState(HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE);
 				}
 				else if (pSignalAbortAutoTuningController)
 				{
@@ -832,11 +859,11 @@ namespace BuRCPP {
 					fbBuildPlatformTempController.Enable = 0;
 					fbBuildPlatformTempPWM.Enable = 0;
 					fbBuildPlatfromTempTuner.Enable = 0;
-					pEnvironment->setNextState("idle_disabled");
+					pEnvironment->setNextState(HEATER_STATE_IDLE_DISABLED);
 				}
 				else
 				{
-					pEnvironment->setNextState("wait_for_tuning");
+					pEnvironment->setNextState(HEATER_STATE_WAIT_FOR_TUNING);
 					fbBuildPlatfromTempTuner.ActValue = (int)round(20*pAnalogInputModule->getInputVoltageInVolt(2)); // (0-200C / 0  10V)
 					fbBuildPlatformTempPWM.DutyCycle = fbBuildPlatfromTempTuner.Out; // transform PID control output to a PID signal
 					pDigitalOutputModule->setOutput(3, fbBuildPlatformTempPWM.Out); // set the heater output according to the PID signal
@@ -849,7 +876,7 @@ namespace BuRCPP {
 				fbBuildPlatformTempPWM.Enable = 0;
 				fbBuildPlatfromTempTuner.Enable = 0;
 				fbBuildPlatfromTempTuner.Start = false;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (HEATER_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -872,16 +899,55 @@ namespace BuRCPP {
 			// Temperature build plate heating, Modul: 112KF15; AI Channel: 2; Value range: (0-200C / 0  10V)
 			// Build plate heating protection switch, Modul: 113KF18; DI Channel: 6; 0 = error, 1 = OK
 			// Build plate heating relais, Modul: 114KF28; DO Channel: 3
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, "112KF15");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, "113KF18");
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule (pEnvironment, HEATER_MODULE_112KF15);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule (pEnvironment, HEATER_MODULE_113KF18);
 			
 			if (fbBuildPlatformTempController.Error == 0 && fbBuildPlatformTempPWM.Error == 0 && fbBuildPlatfromTempTuner.Error == 0 &&  pAnalogInputModule->getIOStatus(2) == 0 && pDigitalInputModule->getInput(6) == 0)
 			{
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(HEATER_STATE_INIT);
+			}
+			else
+			{
+				pEnvironment->setNextState(HEATER_STATE_ERROR);
+			}
+			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
+			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
+			MTBasicsPWM(&fbBuildPlatformTempPWM); // call PWM function block
+		}
+	
+	};
+	
+		
+	
+	class CStateHeater_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{	
+			// Build plate heating relais, Modul: 114KF28; DO Channel: 3, written even if the module is faulted
+			auto pDigitalOutputModule = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (HEATER_MODULE_114KF28);
+			
+			// switch off the heater and disable the controller
+			pDigitalOutputModule->setOutput(3, false);
+			fbBuildPlatformTempController.Enable = 0;
+			fbBuildPlatformTempPWM.Enable = 0;
+			fbBuildPlatfromTempTuner.Enable = 0;
+			fbBuildPlatfromTempTuner.Start = 0;
+			
+			// wait for a new initialization once all modules are available again
+			if (pEnvironment->boundModulesAreAvailable ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState(HEATER_STATE_WAIT_FOR_INIT);
 			}
 			else
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(HEATER_STATE_FAULT);
 			}
 			MTBasicsStepTuning(&fbBuildPlatfromTempTuner); // call tuning function block 
 			MTBasicsPID(&fbBuildPlatformTempController); // call PID function block 
@@ -898,16 +964,25 @@ namespace BuRCPP {
 		CStateHandlerHeater (CApplication* pApplication)
 			: CStateHandler (pApplication->getJournal (), "heater", pApplication->getModuleHandler (), JOURNALGROUP_HEATER)
 		{
-			// register all states of this state machine here
-			addState (std::make_shared<CStateHeater_Wait_For_Init> ());
-			addState (std::make_shared<CStateHeater_Init> ());
-			addState (std::make_shared<CStateHeater_IdleDisabled> ());
-			addState (std::make_shared<CStateHeater_Update_Parameters> ());
-			addState (std::make_shared<CStateHeater_Wait_For_Parameter_Update> ());
-			addState (std::make_shared<CStateHeater_Heating_Control_Enabled> ());
-			addState (std::make_shared<CStateHeater_Tune_Control_Parameters> ());
-			addState (std::make_shared<CStateHeater_Wait_For_Tuning> ());
-			addState (std::make_shared<CStateHeater_Error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20AI4622> (HEATER_MODULE_112KF15, "112KF15");
+			bindModule<CIOModule_X20DI6371> (HEATER_MODULE_113KF18, "113KF18");
+			bindModule<CIOModule_X20DO6322> (HEATER_MODULE_114KF28, "114KF28");
+			
+			// register all states of this state machine here, a registration out of order against the HEATER_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateHeater_Wait_For_Init> (), HEATER_STATE_WAIT_FOR_INIT);
+			addState (std::make_shared<CStateHeater_Init> (), HEATER_STATE_INIT);
+			addState (std::make_shared<CStateHeater_IdleDisabled> (), HEATER_STATE_IDLE_DISABLED);
+			addState (std::make_shared<CStateHeater_Update_Parameters> (), HEATER_STATE_UPDATE_PARAMETERS);
+			addState (std::make_shared<CStateHeater_Wait_For_Parameter_Update> (), HEATER_STATE_WAIT_FOR_PARAMETER_UPDATE);
+			addState (std::make_shared<CStateHeater_Heating_Control_Enabled> (), HEATER_STATE_HEATING_CONTROL_ENABLED);
+			addState (std::make_shared<CStateHeater_Tune_Control_Parameters> (), HEATER_STATE_TUNE_CONTROL_PARAMETERS);
+			addState (std::make_shared<CStateHeater_Wait_For_Tuning> (), HEATER_STATE_WAIT_FOR_TUNING);
+			addState (std::make_shared<CStateHeater_Error> (), HEATER_STATE_ERROR);
+			addState (std::make_shared<CStateHeater_Fault> (), HEATER_STATE_FAULT);
+			
+			// a throwing state switches off the heater in the fault state
+			setFaultState (HEATER_STATE_FAULT);
 			
 			// register journal variables
 			registerDoubleValue("heater_PID_derivativetime", JOURNALVARIABLE_HEATER_DERIVATIVETIMEINSECONDS, 0.0, 1000.0, 40000000);
@@ -932,58 +1007,60 @@ namespace BuRCPP {
 			registerBoolValue("heater_tuner_isinit", JOURNALVARIABLE_HEATER_TUNE_ISINIT);
 			registerBoolValue("heater_setpoint_isinit", JOURNALVARIABLE_HEATER_SETPOINT_ISINIT);
 
-			// register all signals here
-			auto pSignalEnableController = registerSignal ("enablecontroller", 4, 1000);
-			pSignalEnableController->addBoolResult ("success", false);
+			// register all signals here, a registration out of order against the HEATER_SIGNAL_* IDs fails the initialization
+			auto pSignalEnableController = registerSignal ("enablecontroller", 4, 1000, HEATER_SIGNAL_ENABLECONTROLLER);
+			pSignalEnableController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalUpdateControllerPidParameters = registerSignal ("updatecontrollerparameters", 4,3000);
-			pSignalUpdateControllerPidParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("derivativetime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("integrationtime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("gain", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("filtertime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("maxout", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("minout", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("setvalue", 0);
-			pSignalUpdateControllerPidParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerPidParameters = registerSignal ("updatecontrollerparameters", 4,3000, HEATER_SIGNAL_UPDATECONTROLLERPARAMETERS);
+			pSignalUpdateControllerPidParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("derivativetime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("integrationtime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("gain", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("filtertime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("maxout", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("minout", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("setvalue", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_SETVALUE);
+			pSignalUpdateControllerPidParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalUpdateControllerTunerParameters = registerSignal ("updatecontrollertunerparameters", 4, 3000);
-			pSignalUpdateControllerTunerParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("stepheight", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxactvalue", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("minactvalue", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("systemsettlingtime", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxtuningtime", 0);
-			pSignalUpdateControllerTunerParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerTunerParameters = registerSignal ("updatecontrollertunerparameters", 4, 3000, HEATER_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS);
+			pSignalUpdateControllerTunerParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("stepheight", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxactvalue", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("minactvalue", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("systemsettlingtime", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxtuningtime", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME);
+			pSignalUpdateControllerTunerParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 
-			auto pSignalUpdateControllerPwmParameters = registerSignal ("updatecontrollerpwmparameters", 4, 3000);
-			pSignalUpdateControllerPwmParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("dutycycle", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("period", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("maxFrequency", 0);
-			pSignalUpdateControllerPwmParameters->addBoolParameter ("mode", 0);
-			pSignalUpdateControllerPwmParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerPwmParameters = registerSignal ("updatecontrollerpwmparameters", 4, 3000, HEATER_SIGNAL_UPDATECONTROLLERPWMPARAMETERS);
+			pSignalUpdateControllerPwmParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("dutycycle", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("period", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("maxFrequency", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+			pSignalUpdateControllerPwmParameters->addBoolParameter ("mode", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
+			pSignalUpdateControllerPwmParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 				
-			auto pSignalUpdateControllerSetpoint = registerSignal ("updatecontrollersetpoint", 4, 1000);
-			pSignalUpdateControllerSetpoint->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerSetpoint->addInt32Parameter ("setvalue", 0);
-			pSignalUpdateControllerSetpoint->addBoolResult ("success", false);
+			auto pSignalUpdateControllerSetpoint = registerSignal ("updatecontrollersetpoint", 4, 1000, HEATER_SIGNAL_UPDATECONTROLLERSETPOINT);
+			pSignalUpdateControllerSetpoint->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
+			pSignalUpdateControllerSetpoint->addInt32Parameter ("setvalue", 0, SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
+			pSignalUpdateControllerSetpoint->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 				
-			auto pSignalAutoTuneController = registerSignal ("autotunecontroller", 4, 1000);
-			pSignalAutoTuneController->addInt32Parameter ("stepheight", 0);
-			pSignalAutoTuneController->addInt32Parameter ("maxactvalue", 0);
-			pSignalAutoTuneController->addInt32Parameter ("minactvalue", 0);
-			pSignalAutoTuneController->addInt32Parameter ("systemsettlingtime", 0);
-			pSignalAutoTuneController->addInt32Parameter ("maxtuningtime", 0);
-			pSignalAutoTuneController->addBoolResult ("success", false);
+			auto pSignalAutoTuneController = registerSignal ("autotunecontroller", 4, 1000, HEATER_SIGNAL_AUTOTUNECONTROLLER);
+			pSignalAutoTuneController->addInt32Parameter ("stepheight", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT);
+			pSignalAutoTuneController->addInt32Parameter ("maxactvalue", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE);
+			pSignalAutoTuneController->addInt32Parameter ("minactvalue", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE);
+			pSignalAutoTuneController->addInt32Parameter ("systemsettlingtime", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME);
+			pSignalAutoTuneController->addInt32Parameter ("maxtuningtime", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME);
+			pSignalAutoTuneController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalAbortAutoTuningController = registerSignal ("abortautotuningcontroller", 4, 1000);
-			pSignalAbortAutoTuningController->addBoolResult ("success", false);
+			auto pSignalAbortAutoTuningController = registerSignal ("abortautotuningcontroller", 4, 1000, HEATER_SIGNAL_ABORTAUTOTUNINGCONTROLLER);
+			pSignalAbortAutoTuningController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			pSignalAbortAutoTuningController->setPriority (eSignalPriority::High);
 			
-			auto pSignalDisableBuildPlateTempControl = registerSignal ("disablecontroller", 4, 1000);
-			pSignalDisableBuildPlateTempControl->addBoolResult ("success", false);
+			auto pSignalDisableBuildPlateTempControl = registerSignal ("disablecontroller", 4, 1000, HEATER_SIGNAL_DISABLECONTROLLER);
+			pSignalDisableBuildPlateTempControl->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			pSignalDisableBuildPlateTempControl->setPriority (eSignalPriority::High);
 		}
 	
 		virtual ~CStateHandlerHeater ()		
@@ -41,6 +41,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_PLC.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the main state machine, bound once in the state handler constructor
+#define MAIN_MODULE_114KF25 0
+
+// State IDs of the main state machine, in registration order
+#define MAIN_STATE_INIT 0
+#define MAIN_STATE_IDLE 1
+#define MAIN_STATE_FATALERROR 2
+#define MAIN_STATE_FAULT 3
+
+// Signal IDs of the main state machine, in registration order
+#define MAIN_SIGNAL_TOGGLEVALVES 0
+
+
 
 
 namespace BuRCPP {
@@ -57,11 +70,11 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access IO moduls
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25 (pEnvironment, "114KF25"); //valves
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25 (pEnvironment, MAIN_MODULE_114KF25); //valves
 			
 			if (true)
 			{
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (MAIN_STATE_IDLE);
 				// close all valves during init
 				pDigitalOutputModule114KF25->setOutput(1, false);
 				pDigitalOutputModule114KF25->setOutput(2, false);
@@ -71,7 +84,7 @@ namespace BuRCPP {
 			} 
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (MAIN_STATE_INIT);
 			}
 			
 		}
@@ -89,19 +102,19 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState ("idle");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25 (pEnvironment, "114KF25");
+			pEnvironment->setNextState (MAIN_STATE_IDLE);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25 (pEnvironment, MAIN_MODULE_114KF25);
 			
-			auto pSignalToggleValves = pEnvironment->checkSignal ("togglevalves");
+			auto pSignalToggleValves = pEnvironment->checkSignal (MAIN_SIGNAL_TOGGLEVALVES);
 			
 			if (pSignalToggleValves) 
 			{
-				bool toggle_lower_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter("toggle_lower_gas_flow_circuit_valve");
-				bool toggle_upper_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter("toggle_upper_gas_flow_circuit_valve");
-				bool toggle_shielding_gas_valve = pSignalToggleValves->getBoolParameter("toggle_shielding_gas_valve");
-				bool toggle_chamber_vacuum_valve = pSignalToggleValves->getBoolParameter("toggle_chamber_vacuum_valve");
-				bool toggle_zAxis_vacuum_valve = pSignalToggleValves->getBoolParameter("toggle_zAxis_vacuum_valve");
-				pSignalToggleValves->setBoolResult ("success", true);
+				bool toggle_lower_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+				bool toggle_upper_gas_flow_circuit_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
+				bool toggle_shielding_gas_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
+				bool toggle_chamber_vacuum_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
+				bool toggle_zAxis_vacuum_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+				pSignalToggleValves->setBoolResult (SIGNAL_RESULT_SUCCESS, true);
 				pSignalToggleValves->finishProcessing ();
 				
 				pDigitalOutputModule114KF25->setOutput(1, toggle_lower_gas_flow_circuit_valve);
@@ -126,7 +139,38 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState ("fatalerror");
+			pEnvironment->setNextState (MAIN_STATE_FATALERROR);
+		}
+	
+	};
+
+
+
+	class CState_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// close all valves, the outputs are written even if the module is faulted
+			auto pDigitalOutputModule114KF25 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (MAIN_MODULE_114KF25);
+			pDigitalOutputModule114KF25->setOutput(1, false);
+			pDigitalOutputModule114KF25->setOutput(2, false);
+			pDigitalOutputModule114KF25->setOutput(3, false);
+			pDigitalOutputModule114KF25->setOutput(4, false);
+			pDigitalOutputModule114KF25->setOutput(5, false);
+			
+			// start over once the valve module is available again
+			if (pEnvironment->boundModulesAreAvailable ()) {
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (MAIN_STATE_INIT);
+			} else {
+				pEnvironment->setNextState (MAIN_STATE_FAULT);
+			}
 		}
 	
 	};
@@ -141,19 +185,27 @@ namespace BuRCPP {
 		CMainStateHandler (CApplication* pApplication)
 			: CStateHandler (pApplication->getJournal (), "main", pApplication->getModuleHandler (), JOURNALGROUP_MAIN)
 		{
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20DO6322> (MAIN_MODULE_114KF25, "114KF25");
+			
 				
-			addState (std::make_shared<CState_Init> ());
-			addState (std::make_shared<CState_Idle> ());
-			addState (std::make_shared<CState_FatalError> ());
+			// register all states here, a registration out of order against the MAIN_STATE_* IDs fails the initialization
+			addState (std::make_shared<CState_Init> (), MAIN_STATE_INIT);
+			addState (std::make_shared<CState_Idle> (), MAIN_STATE_IDLE);
+			addState (std::make_shared<CState_FatalError> (), MAIN_STATE_FATALERROR);
+			addState (std::make_shared<CState_Fault> (), MAIN_STATE_FAULT);
+			
+			// a throwing state closes all valves in the fault state
+			setFaultState (MAIN_STATE_FAULT);
 			
-			//register the signals
-			auto pSignalSingleAxisMovement = registerSignal ("togglevalves", 4, 1000);
-			pSignalSingleAxisMovement->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false);
-			pSignalSingleAxisMovement->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false);
-			pSignalSingleAxisMovement->addBoolParameter ("toggle_shielding_gas_valve", false);
-			pSignalSingleAxisMovement->addBoolParameter ("toggle_chamber_vacuum_valve", false);
-			pSignalSingleAxisMovement->addBoolParameter ("toggle_zAxis_vacuum_valve", false);
-			pSignalSingleAxisMovement->addBoolResult ("success", false);
+			//register the signals, a registration out of order against the SIGNAL_TOGGLEVALVES_* indices fails the initialization
+			auto pSignalSingleAxisMovement = registerSignal ("togglevalves", 4, 1000, MAIN_SIGNAL_TOGGLEVALVES);
+			pSignalSingleAxisMovement->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+			pSignalSingleAxisMovement->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
+			pSignalSingleAxisMovement->addBoolParameter ("toggle_shielding_gas_valve", false, SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
+			pSignalSingleAxisMovement->addBoolParameter ("toggle_chamber_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
+			pSignalSingleAxisMovement->addBoolParameter ("toggle_zAxis_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+			pSignalSingleAxisMovement->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
 		}
 	
@@ -38,6 +38,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20AI4622.hpp"
 #include "Modules/IOModule_X20DO6322.hpp"
 
+// Module IDs of the O2 sensor state machine, bound once in the state handler constructor
+#define O2SENSOR_MODULE_112KF14 0
+#define O2SENSOR_MODULE_114KF24 1
+
+// State IDs of the O2 sensor state machine, in registration order
+#define O2SENSOR_STATE_INIT 0
+#define O2SENSOR_STATE_MEASURING_RANGE_0_TO_25_PERCENT 1
+#define O2SENSOR_STATE_MEASURING_RANGE_0_TO_1000PPM 2
+#define O2SENSOR_STATE_SENSOR_TEST 3
+#define O2SENSOR_STATE_ERROR 4
+#define O2SENSOR_STATE_FAULT 5
+
+// Signal IDs of the O2 sensor state machine, in registration order
+#define O2SENSOR_SIGNAL_SENSORTEST 0
+
 
 
 namespace BuRCPP {
@@ -54,16 +69,16 @@ namespace BuRCPP {
 		{
 			
 			// access io modules
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, "114KF24"); // measuring range switch
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, O2SENSOR_MODULE_112KF14); // oxygen content value module
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule (pEnvironment, O2SENSOR_MODULE_114KF24); // measuring range switch
 
 			pDigitalOutputModule->setOutput(6, false); // set measuring range 0 to 25 %
 			
 			if (pAnalogInputModule->getIOStatus(1) == 0 && pAnalogInputModule->getIOStatus(2) == 0) { // transitioning to measuring_range_0_to_25_percent
-				pEnvironment->setNextState ("measuring_range_0_to_25_percent");
+				pEnvironment->setNextState (O2SENSOR_STATE_MEASURING_RANGE_0_TO_25_PERCENT);
 			}
 			else {		
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (O2SENSOR_STATE_ERROR);
 			}			
 		}
 	};
@@ -79,11 +94,11 @@ namespace BuRCPP {
 		void Execute(CEnvironment* pEnvironment)
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF24"); // measuring range switch
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, O2SENSOR_MODULE_112KF14); // oxygen content value module
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, O2SENSOR_MODULE_114KF24); // measuring range switch
 			
 			// Signal from PC
-			auto pSignalSensorTest = pEnvironment->checkSignal ("sensortest");
+			auto pSignalSensorTest = pEnvironment->checkSignal (O2SENSOR_SIGNAL_SENSORTEST);
 			
 			double o2inpercent_chamber = (pAnalogInputModule->getInputCurrentInAmpere(2)-0.004)*((O2SENSORCHAMBER_RANGE_COARSE_UPPER_INPERCENT-O2SENSORCHAMBER_RANGE_COARSE_LOWER_INPERCENT)/0.016)+O2SENSORCHAMBER_RANGE_COARSE_LOWER_INPERCENT;
 			double o2inpercent_filter = (pAnalogInputModule->getInputCurrentInAmpere(1)-0.004)*((O2SENSORFILTER_RANGE_UPPER_INPERCENT-O2SENSORFILTER_RANGE_LOWER_INPERCENT)/0.016)+O2SENSORFILTER_RANGE_LOWER_INPERCENT;
@@ -93,18 +108,18 @@ namespace BuRCPP {
 		
 			if (o2inpercent_chamber*10000 >= O2SENSORCHAMBER_RANGE_FINE_LOWER_INPPM) {		// oxygen content value >=  1000 ppm
 				pDigitalOutputModule->setOutput(6, false);
-				pEnvironment->setNextState("measuring_range_0_to_25_percent");
+				pEnvironment->setNextState(O2SENSOR_STATE_MEASURING_RANGE_0_TO_25_PERCENT);
 			}
 			else {      // oxygen content value < 1000 ppm
 				pDigitalOutputModule->setOutput(6, true);
-				pEnvironment->setNextState("measuring_range_0_to_1000ppm");
+				pEnvironment->setNextState(O2SENSOR_STATE_MEASURING_RANGE_0_TO_1000PPM);
 			}
 			if (pSignalSensorTest) { // Signal from PC
-				pEnvironment->setNextState("sensor_test");
+				pEnvironment->setNextState(O2SENSOR_STATE_SENSOR_TEST);
 				pSignalSensorTest->finishProcessing ();
 			}
 			if (pAnalogInputModule->getIOStatus(1) != 0 && pAnalogInputModule->getIOStatus(2) != 0) { // transitioning to error
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (O2SENSOR_STATE_ERROR);
 			}
 
 		}
@@ -122,12 +137,12 @@ namespace BuRCPP {
 		void Execute(CEnvironment* pEnvironment)
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF24"); // measuring range switch
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, O2SENSOR_MODULE_112KF14); // oxygen content value module
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, O2SENSOR_MODULE_114KF24); // measuring range switch
 			
 			// Signal from PC
 			
-			auto pSignalSensorTest = pEnvironment->checkSignal ("sensortest");
+			auto pSignalSensorTest = pEnvironment->checkSignal (O2SENSOR_SIGNAL_SENSORTEST);
 			
 			double o2inppm_chamber = (pAnalogInputModule->getInputCurrentInAmpere(2)-0.004)*((O2SENSORCHAMBER_RANGE_FINE_UPPER_INPPM-O2SENSORCHAMBER_RANGE_FINE_LOWER_INPPM)/0.016)+O2SENSORCHAMBER_RANGE_FINE_LOWER_INPPM;
 			double o2inpercent_filter = (pAnalogInputModule->getInputCurrentInAmpere(1)-0.004)*((O2SENSORFILTER_RANGE_UPPER_INPERCENT-O2SENSORFILTER_RANGE_LOWER_INPERCENT)/0.016)+O2SENSORFILTER_RANGE_LOWER_INPERCENT;
@@ -137,18 +152,18 @@ namespace BuRCPP {
 			
 			if (o2inppm_chamber >= O2SENSORCHAMBER_RANGE_FINE_LOWER_INPPM) {// oxygen content value >= 1000 ppm
 				pDigitalOutputModule->setOutput(6, false);
-				pEnvironment->setNextState("measuring_range_0_to_25_percent");
+				pEnvironment->setNextState(O2SENSOR_STATE_MEASURING_RANGE_0_TO_25_PERCENT);
 			}
 			else {      // oxygen content value < 1000 ppm
 				pDigitalOutputModule->setOutput(6, true);
-				pEnvironment->setNextState("measuring_range_0_to_1000ppm");
+				pEnvironment->setNextState(O2SENSOR_STATE_MEASURING_RANGE_0_TO_1000PPM);
 			}
 			if (pSignalSensorTest) { // Signal from PC
-				pEnvironment->setNextState("sensor_test");
+				pEnvironment->setNextState(O2SENSOR_STATE_SENSOR_TEST);
 				pSignalSensorTest->finishProcessing ();
 			}
 			if (pAnalogInputModule->getIOStatus(1) != 0 && pAnalogInputModule->getIOStatus(2) != 0) { // transitioning to error
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (O2SENSOR_STATE_ERROR);
 			}
 
 		}
@@ -166,18 +181,18 @@ namespace BuRCPP {
 		void Execute(CEnvironment* pEnvironment)
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF24"); // measuring range switch
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, O2SENSOR_MODULE_114KF24); // measuring range switch
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, O2SENSOR_MODULE_112KF14); // oxygen content value module
 			
 			
 			if (false) { 
-				pEnvironment->setNextState("sensor_test");
+				pEnvironment->setNextState(O2SENSOR_STATE_SENSOR_TEST);
 			}
 			else {		// transitioning to init
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(O2SENSOR_STATE_INIT);
 			}
 			if (pAnalogInputModule->getIOStatus(1) != 0 && pAnalogInputModule->getIOStatus(2) != 0) { // transitioning to error
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (O2SENSOR_STATE_ERROR);
 			}
 		}
 
@@ -194,13 +209,39 @@ namespace BuRCPP {
 		void Execute(CEnvironment* pEnvironment)
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, "112KF14"); // oxygen content value module
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule(pEnvironment, O2SENSOR_MODULE_112KF14); // oxygen content value module
 			
 			if (pAnalogInputModule->getIOStatus(1) == 0 && pAnalogInputModule->getIOStatus(2) == 0) { // transitioning to init
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (O2SENSOR_STATE_INIT);
 			}
 			else {		
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (O2SENSOR_STATE_ERROR);
+			}
+		}
+
+	};
+	
+	class CStateO2Sensor_fault : public CState {
+		public:
+
+		std::string getName()
+		{
+			return "fault";
+		}
+
+		void Execute(CEnvironment* pEnvironment)
+		{
+			// fall back to the measuring range 0 to 25 %, the output is written even if the module is faulted
+			auto pDigitalOutputModule = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (O2SENSOR_MODULE_114KF24);
+			pDigitalOutputModule->setOutput(6, false);
+			
+			// start over once all modules are available again
+			if (pEnvironment->boundModulesAreAvailable ()) {
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (O2SENSOR_STATE_INIT);
+			}
+			else {
+				pEnvironment->setNextState (O2SENSOR_STATE_FAULT);
 			}
 		}
 
@@ -213,16 +254,24 @@ namespace BuRCPP {
 			// retrieve the journal group variable for this O2Sensor state machine
 			: CStateHandler (pApplication->getJournal (), "O2Sensor", pApplication->getModuleHandler (), JOURNALGROUP_O2SENSOR)
 		{
-			// register all states of this state machine here
-			addState (std::make_shared<CStateO2Sensor_Init> ());
-			addState (std::make_shared<CStateO2Sensor_measuring_range_0_to_25_percent> ());
-			addState(std::make_shared<CStateO2Sensor_measuring_range_0_to_1000ppm>());
-			addState(std::make_shared<CStateO2Sensor_sensor_test>());
-			addState(std::make_shared<CStateO2Sensor_error>());
-			
-			//register signal
-			auto pSignalSensorTest = registerSignal ("sensortest", 4, 1000);
-			pSignalSensorTest->addBoolResult ("success", false);
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20AI4622> (O2SENSOR_MODULE_112KF14, "112KF14");
+			bindModule<CIOModule_X20DO6322> (O2SENSOR_MODULE_114KF24, "114KF24");
+			
+			// register all states of this state machine here, a registration out of order against the O2SENSOR_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateO2Sensor_Init> (), O2SENSOR_STATE_INIT);
+			addState (std::make_shared<CStateO2Sensor_measuring_range_0_to_25_percent> (), O2SENSOR_STATE_MEASURING_RANGE_0_TO_25_PERCENT);
+			addState (std::make_shared<CStateO2Sensor_measuring_range_0_to_1000ppm>(), O2SENSOR_STATE_MEASURING_RANGE_0_TO_1000PPM);
+			addState (std::make_shared<CStateO2Sensor_sensor_test>(), O2SENSOR_STATE_SENSOR_TEST);
+			addState (std::make_shared<CStateO2Sensor_error>(), O2SENSOR_STATE_ERROR);
+			addState (std::make_shared<CStateO2Sensor_fault>(), O2SENSOR_STATE_FAULT);
+			
+			// a throwing state falls back to the default measuring range in the fault state
+			setFaultState (O2SENSOR_STATE_FAULT);
+			
+			//register signal, a registration out of order against the O2SENSOR_SIGNAL_* IDs fails the initialization
+			auto pSignalSensorTest = registerSignal ("sensortest", 4, 1000, O2SENSOR_SIGNAL_SENSORTEST);
+			pSignalSensorTest->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 			// register journal variables
 			registerIntegerValue("o2chamberinppm", JOURNALVARIABLE_O2INPPM_CHAMBER, 0, 250000);
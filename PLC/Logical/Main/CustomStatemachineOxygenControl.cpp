@@ -41,6 +41,37 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20SI8110.hpp"
 #include "Modules/IOModule_X20DI6371.hpp"
 
+// Module IDs of the oxygen control state machine, bound once in the state handler constructor
+#define OXYGEN_MODULE_112KF14 0
+#define OXYGEN_MODULE_114KF24 1
+#define OXYGEN_MODULE_114KF25 2
+#define OXYGEN_MODULE_115KF51 3
+#define OXYGEN_MODULE_113KF17 4
+#define OXYGEN_MODULE_113KF21 5
+
+// State IDs of the oxygen control state machine, in registration order
+#define OXYGEN_STATE_WAIT_FOR_INIT 0
+#define OXYGEN_STATE_INIT 1
+#define OXYGEN_STATE_IDLE_DISABLED 2
+#define OXYGEN_STATE_UPDATE_PARAMETERS 3
+#define OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE 4
+#define OXYGEN_STATE_OXYGEN_CONTROL_ENABLED 5
+#define OXYGEN_STATE_TUNE_CONTROL_PARAMETERS 6
+#define OXYGEN_STATE_WAIT_FOR_TUNING 7
+#define OXYGEN_STATE_ERROR 8
+#define OXYGEN_STATE_FAULT 9
+
+// Signal IDs of the oxygen control state machine, in registration order
+#define OXYGEN_SIGNAL_ENABLECONTROLLER 0
+#define OXYGEN_SIGNAL_UPDATECONTROLLERPARAMETERS 1
+#define OXYGEN_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS 2
+#define OXYGEN_SIGNAL_UPDATECONTROLLERPWMPARAMETERS 3
+#define OXYGEN_SIGNAL_UPDATECONTROLLERSETPOINT 4
+#define OXYGEN_SIGNAL_AUTOTUNECONTROLLER 5
+#define OXYGEN_SIGNAL_ABORTAUTOTUNINGCONTROLLER 6
+#define OXYGEN_SIGNAL_DISABLECONTROLLER 7
+#define OXYGEN_SIGNAL_TOGGLEVALVES 8
+
 namespace BuRCPP {
 	
 	class CStateOxygenControl_Wait_For_Init : public CState {
@@ -59,15 +90,15 @@ namespace BuRCPP {
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
 						
 			// check for PC signals
-			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal ("updatecontrollerparameters");
-			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal ("updatecontrollertunerparameters");
-			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal ("updatecontrollerpwmparameters");
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint");
+			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERPARAMETERS);
+			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS);
+			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERPWMPARAMETERS);
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERSETPOINT);
 			
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
@@ -77,19 +108,19 @@ namespace BuRCPP {
 					
 				if(pSignalUpdateControllerPidParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_INIT);
 					if(bIsInitPID)
 					{
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_PID_ISINIT, true);
 					
 						//retrieve the PID update parameters 
-						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter("derivativetime")* 0.001;
-						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter("integrationtime")* 0.001;
-						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter("gain")*0.001;
-						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter("filtertime")* 0.001;
-						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter("maxout");
-						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter("minout");
+						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME)* 0.001;
+						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME)* 0.001;
+						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN)*0.001;
+						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME)* 0.001;
+						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
 				
 			
 						// store the PID parameters in journal variables
@@ -105,18 +136,18 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerTunerParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_INIT);
 					if(bIsInitTuner)
 					{	
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_TUNE_ISINIT, true);
 
 						//retrieve the PID tuner update parameters 
-						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter("stepheight");
-						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxactvalue");
-						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("minactvalue");
-						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("systemsettlingtime")/1000.0;
-						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxtuningtime")/1000.0;
+						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME)/1000.0;
+						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME)/1000.0;
 								
 						// store the PID tuner parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_TUNE_STEPHEIGHTINPERCENT,  nStepHeight);
@@ -131,17 +162,17 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerPwmParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_INIT);
 					if(bIsInitPWM)
 					{
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_PWM_ISINIT, true);
 			
 						// retrieve the parameters to update the OxygenControl PWM function block
-						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter("dutycycle");
-						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter("period")/1000;
-						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter("maxFrequency");
-						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter("mode");
+						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD)/1000;
+						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
 								
 						// store the OxygenControl PWM function block parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_PWM_DUTYCYCLE,  nDutyCycle);
@@ -154,14 +185,14 @@ namespace BuRCPP {
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ // check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
-					pEnvironment->setNextState ("wait_for_init");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_INIT);
 					if(bIsInitSetpoint)
 					{	
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINT_ISINIT, true);
 			
 						// retrieve the parameter to update the oxygen content setpoint
-						int nSetvalue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						int nSetvalue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 								
 						// store the oxygen content setpoint in journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINTINPPM, nSetvalue);
@@ -178,7 +209,7 @@ namespace BuRCPP {
 					bool bIsInitSetpoint = pEnvironment->getBoolValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINT_ISINIT);
 					
 					if (bIsInitPWM && bIsInitTuner && bIsInitPID && bIsInitSetpoint){
-						pEnvironment->setNextState ("init");
+						pEnvironment->setNextState (OXYGEN_STATE_INIT);
 						// reset the init flags
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_PID_ISINIT, false);
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_TUNE_ISINIT, false);
@@ -186,7 +217,7 @@ namespace BuRCPP {
 						pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINT_ISINIT, false);
 					}else
 					{ // wait for the init parameter signal from the PC
-						pEnvironment->setNextState ("wait_for_init");
+						pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_INIT);
 					}
 					
 				}
@@ -196,7 +227,7 @@ namespace BuRCPP {
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -221,9 +252,9 @@ namespace BuRCPP {
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
 			
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
@@ -305,7 +336,7 @@ namespace BuRCPP {
 				//currently, default values are used
 				fbOxygenControlPWM.Update = true;		
 				
-				pEnvironment->setNextState ("wait_for_parameter_update");
+				pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE);
 		
 			}
 			else
@@ -313,7 +344,7 @@ namespace BuRCPP {
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}	
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -340,21 +371,21 @@ namespace BuRCPP {
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
 			// circulation valves status, Modul: 113KF17; Channel 1: chamber valve open; Channel 2: chamber valve closed; Channel 3: heat exchanger valve open; Channel 4: heat exchanger valve closed
 			// vacuum valves status, Modul: 113KF21; Channel 1: chamber valve open; Channel 2: chamber valve closed; Channel 3: z-axis valve open; Channel 4: z-axis valve closed
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule115KF51 (pEnvironment, "115KF51");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule113KF17(pEnvironment, "113KF17");
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule113KF21(pEnvironment, "113KF21");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20SI8110> pSafetyDigitalInputModule115KF51 (pEnvironment, OXYGEN_MODULE_115KF51);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule113KF17(pEnvironment, OXYGEN_MODULE_113KF17);
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule113KF21(pEnvironment, OXYGEN_MODULE_113KF21);
 			
 			// check for signals
-			auto pSignalEnableController = pEnvironment->checkSignal ("enablecontroller"); //signal to enable the controller
-			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal ("updatecontrollerparameters"); //signal to update the PID parameters
-			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal ("updatecontrollertunerparameters"); //signal to update the parameters of the tuner
-			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal ("updatecontrollerpwmparameters"); //signal to update the PWM parameters
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint"); //signal to update the setpoint
-			auto pSignalAutoTuneController = pEnvironment->checkSignal ("autotunecontroller"); //signal to update the setpoint
-			auto pSignalToggleValves = pEnvironment->checkSignal ("togglevalves");
+			auto pSignalEnableController = pEnvironment->checkSignal (OXYGEN_SIGNAL_ENABLECONTROLLER); //signal to enable the controller
+			auto pSignalUpdateControllerPidParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERPARAMETERS); //signal to update the PID parameters
+			auto pSignalUpdateControllerTunerParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS); //signal to update the parameters of the tuner
+			auto pSignalUpdateControllerPwmParameters = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERPWMPARAMETERS); //signal to update the PWM parameters
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERSETPOINT); //signal to update the setpoint
+			auto pSignalAutoTuneController = pEnvironment->checkSignal (OXYGEN_SIGNAL_AUTOTUNECONTROLLER); //signal to update the setpoint
+			auto pSignalToggleValves = pEnvironment->checkSignal (OXYGEN_SIGNAL_TOGGLEVALVES);
 			
 			fbOxygenControlPID.Enable = 0;
 			fbOxygenControlPWM.Enable = 0;
@@ -363,7 +394,7 @@ namespace BuRCPP {
 			
 			if (pSignalToggleValves) // toggle gas flow valves
 			{
-				bool toggle_shielding_gas = pSignalToggleValves->getBoolParameter("toggle_shielding_gas_valve");
+				bool toggle_shielding_gas = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
 				
 				pDigitalOutputModule114KF25->setOutput(3, toggle_shielding_gas);
 				pSignalToggleValves->finishProcessing ();
@@ -375,19 +406,19 @@ namespace BuRCPP {
 			{	
 				if(pSignalUpdateControllerPidParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter("isinit");
+					bool bIsInitPID = pSignalUpdateControllerPidParameters->getBoolParameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitPID)
 					{
 						//retrieve the PID update parameters 
-						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter("derivativetime")* 0.001;
-						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter("integrationtime")* 0.001;
-						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter("gain")*0.001;
-						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter("filtertime")* 0.001;
-						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter("maxout");
-						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter("minout");
+						double dDerivativeTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME)* 0.001;
+						double dIntegrationTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME)* 0.001;
+						double dGain = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN)*0.001;
+						double dFilterTime = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME)* 0.001;
+						int nMaxOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+						int nMinOut = pSignalUpdateControllerPidParameters->getInt32Parameter(SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
 					
 					
 						// store the PID parameters in journal variables
@@ -403,23 +434,23 @@ namespace BuRCPP {
 						pSignalUpdateControllerPidParameters->finishProcessing ();
 						
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (OXYGEN_STATE_UPDATE_PARAMETERS);
 					}
 				}
 				else if(pSignalUpdateControllerTunerParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter("isinit");
+					bool bIsInitTuner = pSignalUpdateControllerTunerParameters->getBoolParameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitTuner)
 					{				
 						//retrieve the PID tuner update parameters 
-						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter("stepheight");
-						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxactvalue");
-						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter("minactvalue");
-						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("systemsettlingtime")/1000;
-						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter("maxtuningtime")/1000;
+						int nStepHeight = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+						int nMaxActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+						int nMinActValue = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+						double dSystemSettlingTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME)/1000;
+						double dMaxTuningTime = pSignalUpdateControllerTunerParameters->getInt32Parameter(SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME)/1000;
 										
 						// store the PID tuner parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_TUNE_STEPHEIGHTINPERCENT,  nStepHeight);
@@ -432,23 +463,23 @@ namespace BuRCPP {
 						pSignalUpdateControllerTunerParameters->finishProcessing ();
 						
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (OXYGEN_STATE_UPDATE_PARAMETERS);
 					}
 					
 				}
 				else if(pSignalUpdateControllerPwmParameters)
 				{ // check if the signal is an update signal
-					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter("isinit");
+					bool bIsInitPWM = pSignalUpdateControllerPwmParameters->getBoolParameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitPWM)
 					{
 						// retrieve the parameters to update the OxygenControl PWM function block
-						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter("dutycycle");
-						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter("period")/1000;
-						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter("maxFrequency");
-						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter("mode");
+						int nDutyCycle = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+						double dPeriod = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD)/1000;
+						int nMaxFrequency = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+						bool bMode = pSignalUpdateControllerPwmParameters->getInt32Parameter(SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
 										
 						// store the OxygenControl PWM function block parameters in journal variables
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_PWM_DUTYCYCLE,  nDutyCycle);
@@ -460,21 +491,21 @@ namespace BuRCPP {
 						pSignalUpdateControllerPwmParameters->finishProcessing ();
 					
 						// go to init state
-						pEnvironment->setNextState ("update_parameters");
+						pEnvironment->setNextState (OXYGEN_STATE_UPDATE_PARAMETERS);
 					}
 												
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ // check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
 					
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 					
 					if(!bIsInitSetpoint)
 					{
 						//signal from PC to update the setpoint 
 						//retrieve new setpoint from signal
-						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 						//store setpoint in the journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINTINPPM,  nSetValue);
 						//set new setpoint
@@ -487,11 +518,11 @@ namespace BuRCPP {
 				{ // signal from PC to perform a parameter tuning
 					
 					//retrieve the PID tuner update parameters 
-					int nStepHeight = pSignalAutoTuneController->getInt32Parameter("stepheight");
-					int nMaxActValue = pSignalAutoTuneController->getInt32Parameter("maxactvalue");
-					int nMinActValue = pSignalAutoTuneController->getInt32Parameter("minactvalue");
-					double dSystemSettlingTime = pSignalAutoTuneController->getInt32Parameter("systemsettlingtime")/1000;
-					double dMaxTuningTime = pSignalAutoTuneController->getInt32Parameter("maxtuningtime")/1000;
+					int nStepHeight = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT);
+					int nMaxActValue = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE);
+					int nMinActValue = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE);
+					double dSystemSettlingTime = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME)/1000;
+					double dMaxTuningTime = pSignalAutoTuneController->getInt32Parameter(SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME)/1000;
 										
 					// store the PID tuner parameters in journal variables
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_TUNE_STEPHEIGHTINPERCENT,  nStepHeight);
@@ -504,17 +535,17 @@ namespace BuRCPP {
 					if(pSafetyDigitalInputModule115KF51->getInput(3) && pSafetyDigitalInputModule115KF51->getInput(4) && pDigitalInputModule113KF17->getInput(1)==1 && pDigitalInputModule113KF17->getInput(3)==1 && pDigitalInputModule113KF21->getInput(2)==1 && pDigitalInputModule113KF21->getInput(4)==1)
 					{
 						// go to tune_control_parameters state
-						pEnvironment->setNextState ("tune_control_parameters");
+						pEnvironment->setNextState (OXYGEN_STATE_TUNE_CONTROL_PARAMETERS);
 						// finish processing of the signals
-						pSignalAutoTuneController->setBoolResult("success", true);
+						pSignalAutoTuneController->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 						pSignalAutoTuneController->finishProcessing ();
 					}
 					else
 					{
 						// stay in idle_disabled state
-						pEnvironment->setNextState ("idle_disabled");
+						pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 						// finish processing of the signals
-						pSignalAutoTuneController->setBoolResult("success", false);
+						pSignalAutoTuneController->setBoolResult(SIGNAL_RESULT_SUCCESS, false);
 						pSignalAutoTuneController->finishProcessing ();
 					}
 				}
@@ -528,9 +559,9 @@ namespace BuRCPP {
 						fbOxygenControlPWM.Enable = 1;
 						fbOxygenControlTuner.Enable = 0;
 						// go to oxygen_control_enabled state
-						pEnvironment->setNextState ("oxygen_control_enabled");
+						pEnvironment->setNextState (OXYGEN_STATE_OXYGEN_CONTROL_ENABLED);
 						// finish processing of the signals
-						pSignalEnableController->setBoolResult("success", true);
+						pSignalEnableController->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 						pSignalEnableController->finishProcessing ();
 					}
 					else
@@ -540,16 +571,16 @@ namespace BuRCPP {
 						fbOxygenControlPWM.Enable = 0;
 						fbOxygenControlTuner.Enable = 0;
 						// stay in idle_disabled state
-						pEnvironment->setNextState ("idle_disabled");
+						pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 						// finish processing of the signals
-						pSignalEnableController->setBoolResult("success", false);
+						pSignalEnableController->setBoolResult(SIGNAL_RESULT_SUCCESS, false);
 						pSignalEnableController->finishProcessing ();
 					}
 					
 				}
 				else
 				{
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 				}
 				
 			}
@@ -558,7 +589,7 @@ namespace BuRCPP {
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -582,8 +613,8 @@ namespace BuRCPP {
 			// Oxygen sensor chamber, Modul: 112KF14; AI Channel: 2; Value range: (0-25% or 0-1000ppm / 4  20mA)
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
 			
 			fbOxygenControlTuner.Enable = 1;
 			fbOxygenControlPWM.Enable = 1;
@@ -654,14 +685,14 @@ namespace BuRCPP {
 				//currently, default values are used
 				fbOxygenControlPWM.Update = true;		
 				
-				pEnvironment->setNextState ("wait_for_parameter_update");
+				pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE);
 			}
 			else
 			{ // if there is an error occured, diable the OxygenControl control function bocks and switch to the error state
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -684,8 +715,8 @@ namespace BuRCPP {
 			// Oxygen sensor chamber, Modul: 112KF14; AI Channel: 2; Value range: (0-25% or 0-1000ppm / 4  20mA)
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
 		
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
@@ -699,11 +730,11 @@ namespace BuRCPP {
 					fbOxygenControlPID.Enable = false;
 					fbOxygenControlTuner.Enable = false;
 					fbOxygenControlPWM.Enable = false;
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 				}
 				else
 				{	//if the update is not yet done, remain in the wait_for_parameter_update state
-					pEnvironment->setNextState ("wait_for_parameter_update");
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE);
 				}
 			}
 			else
@@ -711,7 +742,7 @@ namespace BuRCPP {
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -736,13 +767,13 @@ namespace BuRCPP {
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
 			
 			//check for signals
-			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal ("updatecontrollersetpoint"); //signal to update the setpoint
-			auto pSignalDisableBuildPlateTempControl = pEnvironment->checkSignal ("disablecontroller"); //signal to disable the controller
+			auto pSignalUpdateControllerSetpoint = pEnvironment->checkSignal (OXYGEN_SIGNAL_UPDATECONTROLLERSETPOINT); //signal to update the setpoint
+			auto pSignalDisableBuildPlateTempControl = pEnvironment->checkSignal (OXYGEN_SIGNAL_DISABLECONTROLLER); //signal to disable the controller
 			
 				
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
@@ -752,17 +783,17 @@ namespace BuRCPP {
 				{// disable control signal from the PC
 					fbOxygenControlPID.Enable = 0;
 					pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_CONTROLLER_ENABLED,  false); // set the oxygen controller enabled flag
-					pEnvironment->setNextState ("idle_disabled");
+					pEnvironment->setNextState (OXYGEN_STATE_IDLE_DISABLED);
 				}
 				else if(pSignalUpdateControllerSetpoint)
 				{ // check if the signal is an update signal
-					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter("isinit");
+					bool bIsInitSetpoint = pSignalUpdateControllerSetpoint->getBoolParameter(SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
 					
 					if(!bIsInitSetpoint)
 					{
 						//signal from PC to update the setpoint 
 						//retrieve new setpoint from signal
-						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter("setvalue");
+						double nSetValue = pSignalUpdateControllerSetpoint->getInt32Parameter(SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
 						//store setpoint in the journal variable
 						pEnvironment->setIntegerValue(JOURNALVARIABLE_OXYGENCONTROL_SETPOINTINPPM, nSetValue);
 						//set new setpoint
@@ -771,7 +802,7 @@ namespace BuRCPP {
 					// finish processing of the signal
 					pSignalUpdateControllerSetpoint->finishProcessing ();
 					pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_CONTROLLER_ENABLED,  true); // set the oxygen controller enabled flag
-					pEnvironment->setNextState ("oxygen_control_enabled");
+					pEnvironment->setNextState (OXYGEN_STATE_OXYGEN_CONTROL_ENABLED);
 				}
 				else
 				{	
@@ -789,7 +820,7 @@ namespace BuRCPP {
 					fbOxygenControlPWM.DutyCycle = fbOxygenControlPID.Out; // transform PID control output to a PID signal
 					pDigitalOutputModule114KF25->setOutput(3, fbOxygenControlPWM.Out); // set the OxygenControl output according to the PID signal
 					pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_CONTROLLER_ENABLED,  true); // set the oxygen controller enabled flag
-					pEnvironment->setNextState ("oxygen_control_enabled");
+					pEnvironment->setNextState (OXYGEN_STATE_OXYGEN_CONTROL_ENABLED);
 				}
 					
 			}
@@ -799,7 +830,7 @@ namespace BuRCPP {
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
 				pEnvironment->setBoolValue(JOURNALVARIABLE_OXYGENCONTROL_CONTROLLER_ENABLED,  false); // set the oxygen controller enabled flag
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -822,8 +853,8 @@ namespace BuRCPP {
 			// Oxygen sensor chamber, Modul: 112KF14; AI Channel: 2; Value range: (0-25% or 0-1000ppm / 4  20mA)
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
 			
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
@@ -853,13 +884,13 @@ namespace BuRCPP {
 					
 					fbOxygenControlTuner.Update = true;
 					fbOxygenControlTuner.Start = false;
-					pEnvironment->setNextState ("tune_control_parameters");
+					pEnvironment->setNextState (OXYGEN_STATE_TUNE_CONTROL_PARAMETERS);
 				} 
 				else if(fbOxygenControlTuner.UpdateDone)
 				{	
 					fbOxygenControlTuner.Update = false;
 					fbOxygenControlTuner.Start = true;
-					pEnvironment->setNextState ("wait_for_tuning");
+					pEnvironment->setNextState (OXYGEN_STATE_WAIT_FOR_TUNING);
 				}	
 			}
 			else
@@ -867,7 +898,7 @@ namespace BuRCPP {
 				fbOxygenControlPID.Enable = 0;
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -891,12 +922,12 @@ namespace BuRCPP {
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
 			
 			//check for signals
-			auto pSignalAbortAutoTuningController = pEnvironment->checkSignal ("abortautotuningcontroller"); //signal to abort the auto tuning
+			auto pSignalAbortAutoTuningController = pEnvironment->checkSignal (OXYGEN_SIGNAL_ABORTAUTOTUNINGCONTROLLER); //signal to abort the auto tuning
 			
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
@@ -911,7 +942,7 @@ namespace BuRCPP {
 					fbOxygenControlPID.Update = true;
 					fbOxygenControlPWM.Update = true;
 					fbOxygenControlTuner.Update = true;
-					pEnvironment->setNextState("wait_for_parameter_update");
+					pEnvironment->setNextState(OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE);
 				}
 				else if (pSignalAbortAutoTuningController)
 				{
@@ -919,11 +950,11 @@ namespace BuRCPP {
 					fbOxygenControlPID.Enable = 0;
 					fbOxygenControlPWM.Enable = 0;
 					fbOxygenControlTuner.Enable = 0;
-					pEnvironment->setNextState("idle_disabled");
+					pEnvironment->setNextState(OXYGEN_STATE_IDLE_DISABLED);
 				}
 				else
 				{
-					pEnvironment->setNextState("wait_for_tuning");
+					pEnvironment->setNextState(OXYGEN_STATE_WAIT_FOR_TUNING);
 					
 					//get and convert oxygen sensor values
 					double o2inppm_chamber = 0;
@@ -947,7 +978,7 @@ namespace BuRCPP {
 				fbOxygenControlPWM.Enable = 0;
 				fbOxygenControlTuner.Enable = 0;
 				fbOxygenControlTuner.Start = false;
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (OXYGEN_STATE_ERROR);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -971,9 +1002,9 @@ namespace BuRCPP {
 			// Oxygen sensor filter, Modul: 112KF14; AI Channel: 1; Value range: (0-25% / 4  20mA)
 			// measuring range chamber o2 sensor switch, Modul: 114KF24; DO Channel: 6; 0 = 0-25%, 1 = 0-1000ppm
 			// Shielding gas valve, Modul: 114KF25; DO Channel 3: shielding gas valve open/close
-			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, "112KF14");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, "114KF24");
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, "114KF25");
+			ioModuleAccess<CIOModule_X20AI4622>pAnalogInputModule112KF14(pEnvironment, OXYGEN_MODULE_112KF14);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF24(pEnvironment, OXYGEN_MODULE_114KF24);
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule114KF25(pEnvironment, OXYGEN_MODULE_114KF25);
 			
 			// ensure the shielding gas valve is closed
 			pDigitalOutputModule114KF25->setOutput(3, false);
@@ -986,11 +1017,51 @@ namespace BuRCPP {
 			// check if the control function blocks and the analog input modul channels of the oxygen sensors are ok
 			if(fbOxygenControlPID.Error == 0 && fbOxygenControlPWM.Error == 0 && fbOxygenControlTuner.Error == 0 &&  pAnalogInputModule112KF14->getIOStatus(1) == 0  &&  pAnalogInputModule112KF14->getIOStatus(2) == 0)
 			{
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(OXYGEN_STATE_INIT);
 			}
 			else
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(OXYGEN_STATE_ERROR);
+			}
+			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
+			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
+			MTBasicsPWM(&fbOxygenControlPWM); // call PWM function block
+		}
+	
+	};
+	
+		
+	
+	class CStateOxygenControl_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{	
+			// Shielding gas valve, Modul: 114KF25; DO Channel 3, written even if the module is faulted
+			auto pDigitalOutputModule114KF25 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (OXYGEN_MODULE_114KF25);
+			
+			// ensure the shielding gas valve is closed
+			pDigitalOutputModule114KF25->setOutput(3, false);
+			// disable the oxygen control function blocks 
+			fbOxygenControlPID.Enable = 0;
+			fbOxygenControlPWM.Enable = 0;
+			fbOxygenControlTuner.Enable = 0;
+			fbOxygenControlTuner.Start = 0;
+			
+			// wait for a new initialization once all modules are available again
+			if (pEnvironment->boundModulesAreAvailable ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState(OXYGEN_STATE_WAIT_FOR_INIT);
+			}
+			else
+			{
+				pEnvironment->setNextState(OXYGEN_STATE_FAULT);
 			}
 			MTBasicsStepTuning(&fbOxygenControlTuner); // call tuning function block 
 			MTBasicsPID(&fbOxygenControlPID); // call PID function block 
@@ -1007,16 +1078,28 @@ namespace BuRCPP {
 		CStateHandlerOxygenControl (CApplication* pApplication)
 			: CStateHandler (pApplication->getJournal (), "oxygen", pApplication->getModuleHandler (), JOURNALGROUP_OxygenControl)
 		{
-			// register all states of this state machine here
-			addState (std::make_shared<CStateOxygenControl_Wait_For_Init> ());
-			addState (std::make_shared<CStateOxygenControl_Init> ());
-			addState (std::make_shared<CStateOxygenControl_IdleDisabled> ());
-			addState (std::make_shared<CStateOxygenControl_Update_Parameters> ());
-			addState (std::make_shared<CStateOxygenControl_Wait_For_Parameter_Update> ());
-			addState (std::make_shared<CStateOxygenControl_oxygen_control_enabled> ());
-			addState (std::make_shared<CStateOxygenControl_Tune_Control_Parameters> ());
-			addState (std::make_shared<CStateOxygenControl_Wait_For_Tuning> ());
-			addState (std::make_shared<CStateOxygenControl_Error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20AI4622> (OXYGEN_MODULE_112KF14, "112KF14");
+			bindModule<CIOModule_X20DO6322> (OXYGEN_MODULE_114KF24, "114KF24");
+			bindModule<CIOModule_X20DO6322> (OXYGEN_MODULE_114KF25, "114KF25");
+			bindModule<CIOModule_X20SI8110> (OXYGEN_MODULE_115KF51, "115KF51");
+			bindModule<CIOModule_X20DI6371> (OXYGEN_MODULE_113KF17, "113KF17");
+			bindModule<CIOModule_X20DI6371> (OXYGEN_MODULE_113KF21, "113KF21");
+			
+			// register all states of this state machine here, a registration out of order against the OXYGEN_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateOxygenControl_Wait_For_Init> (), OXYGEN_STATE_WAIT_FOR_INIT);
+			addState (std::make_shared<CStateOxygenControl_Init> (), OXYGEN_STATE_INIT);
+			addState (std::make_shared<CStateOxygenControl_IdleDisabled> (), OXYGEN_STATE_IDLE_DISABLED);
+			addState (std::make_shared<CStateOxygenControl_Update_Parameters> (), OXYGEN_STATE_UPDATE_PARAMETERS);
+			addState (std::make_shared<CStateOxygenControl_Wait_For_Parameter_Update> (), OXYGEN_STATE_WAIT_FOR_PARAMETER_UPDATE);
+			addState (std::make_shared<CStateOxygenControl_oxygen_control_enabled> (), OXYGEN_STATE_OXYGEN_CONTROL_ENABLED);
+			addState (std::make_shared<CStateOxygenControl_Tune_Control_Parameters> (), OXYGEN_STATE_TUNE_CONTROL_PARAMETERS);
+			addState (std::make_shared<CStateOxygenControl_Wait_For_Tuning> (), OXYGEN_STATE_WAIT_FOR_TUNING);
+			addState (std::make_shared<CStateOxygenControl_Error> (), OXYGEN_STATE_ERROR);
+			addState (std::make_shared<CStateOxygenControl_Fault> (), OXYGEN_STATE_FAULT);
+			
+			// a throwing state closes the shielding gas valve in the fault state
+			setFaultState (OXYGEN_STATE_FAULT);
 			
 			// register journal variables
 			registerDoubleValue("oxygencontrol_PID_derivativetime", JOURNALVARIABLE_OXYGENCONTROL_DERIVATIVETIMEINSECONDS, 0.0, 1000.0, 40000000);
@@ -1042,65 +1125,67 @@ namespace BuRCPP {
 			registerBoolValue("oxygencontrol_setpoint_isinit", JOURNALVARIABLE_OXYGENCONTROL_SETPOINT_ISINIT);
 
 			// register all signals here
-			auto pSignalEnableController = registerSignal ("enablecontroller", 4, 1000);
-			pSignalEnableController->addBoolResult ("success", false);
+			auto pSignalEnableController = registerSignal ("enablecontroller", 4, 1000, OXYGEN_SIGNAL_ENABLECONTROLLER);
+			pSignalEnableController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalUpdateControllerPidParameters = registerSignal ("updatecontrollerparameters", 4,3000);
-			pSignalUpdateControllerPidParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("derivativetime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("integrationtime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("gain", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("filtertime", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("maxout", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("minout", 0);
-			pSignalUpdateControllerPidParameters->addInt32Parameter ("setvalue", 0);
-			pSignalUpdateControllerPidParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerPidParameters = registerSignal ("updatecontrollerparameters", 4,3000, OXYGEN_SIGNAL_UPDATECONTROLLERPARAMETERS);
+			pSignalUpdateControllerPidParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("derivativetime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("integrationtime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("gain", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("filtertime", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("maxout", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("minout", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT);
+			pSignalUpdateControllerPidParameters->addInt32Parameter ("setvalue", 0, SIGNAL_CONTROLLERPARAMETERS_PARAM_SETVALUE);
+			pSignalUpdateControllerPidParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalUpdateControllerTunerParameters = registerSignal ("updatecontrollertunerparameters", 4, 3000);
-			pSignalUpdateControllerTunerParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("stepheight", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxactvalue", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("minactvalue", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("systemsettlingtime", 0);
-			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxtuningtime", 0);
-			pSignalUpdateControllerTunerParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerTunerParameters = registerSignal ("updatecontrollertunerparameters", 4, 3000, OXYGEN_SIGNAL_UPDATECONTROLLERTUNERPARAMETERS);
+			pSignalUpdateControllerTunerParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("stepheight", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxactvalue", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("minactvalue", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("systemsettlingtime", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME);
+			pSignalUpdateControllerTunerParameters->addInt32Parameter ("maxtuningtime", 0, SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME);
+			pSignalUpdateControllerTunerParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 
-			auto pSignalUpdateControllerPwmParameters = registerSignal ("updatecontrollerpwmparameters", 4, 3000);
-			pSignalUpdateControllerPwmParameters->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("dutycycle", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("period", 0);
-			pSignalUpdateControllerPwmParameters->addInt32Parameter ("maxFrequency", 0);
-			pSignalUpdateControllerPwmParameters->addBoolParameter ("mode", 0);
-			pSignalUpdateControllerPwmParameters->addBoolResult ("success", false);
+			auto pSignalUpdateControllerPwmParameters = registerSignal ("updatecontrollerpwmparameters", 4, 3000, OXYGEN_SIGNAL_UPDATECONTROLLERPWMPARAMETERS);
+			pSignalUpdateControllerPwmParameters->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("dutycycle", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("period", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD);
+			pSignalUpdateControllerPwmParameters->addInt32Parameter ("maxFrequency", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY);
+			pSignalUpdateControllerPwmParameters->addBoolParameter ("mode", 0, SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE);
+			pSignalUpdateControllerPwmParameters->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 				
-			auto pSignalUpdateControllerSetpoint = registerSignal ("updatecontrollersetpoint", 4, 1000);
-			pSignalUpdateControllerSetpoint->addBoolParameter ("isinit", 0);
-			pSignalUpdateControllerSetpoint->addInt32Parameter ("setvalue", 0);
-			pSignalUpdateControllerSetpoint->addBoolResult ("success", false);
+			auto pSignalUpdateControllerSetpoint = registerSignal ("updatecontrollersetpoint", 4, 1000, OXYGEN_SIGNAL_UPDATECONTROLLERSETPOINT);
+			pSignalUpdateControllerSetpoint->addBoolParameter ("isinit", 0, SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT);
+			pSignalUpdateControllerSetpoint->addInt32Parameter ("setvalue", 0, SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE);
+			pSignalUpdateControllerSetpoint->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 				
-			auto pSignalAutoTuneController = registerSignal ("autotunecontroller", 4, 1000);
-			pSignalAutoTuneController->addInt32Parameter ("stepheight", 0);
-			pSignalAutoTuneController->addInt32Parameter ("maxactvalue", 0);
-			pSignalAutoTuneController->addInt32Parameter ("minactvalue", 0);
-			pSignalAutoTuneController->addInt32Parameter ("systemsettlingtime", 0);
-			pSignalAutoTuneController->addInt32Parameter ("maxtuningtime", 0);
-			pSignalAutoTuneController->addBoolResult ("success", false);
+			auto pSignalAutoTuneController = registerSignal ("autotunecontroller", 4, 1000, OXYGEN_SIGNAL_AUTOTUNECONTROLLER);
+			pSignalAutoTuneController->addInt32Parameter ("stepheight", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT);
+			pSignalAutoTuneController->addInt32Parameter ("maxactvalue", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE);
+			pSignalAutoTuneController->addInt32Parameter ("minactvalue", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE);
+			pSignalAutoTuneController->addInt32Parameter ("systemsettlingtime", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME);
+			pSignalAutoTuneController->addInt32Parameter ("maxtuningtime", 0, SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME);
+			pSignalAutoTuneController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalAbortAutoTuningController = registerSignal ("abortautotuningcontroller", 4, 1000);
-			pSignalAbortAutoTuningController->addBoolResult ("success", false);
+			auto pSignalAbortAutoTuningController = registerSignal ("abortautotuningcontroller", 4, 1000, OXYGEN_SIGNAL_ABORTAUTOTUNINGCONTROLLER);
+			pSignalAbortAutoTuningController->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			pSignalAbortAutoTuningController->setPriority (eSignalPriority::High);
 			
-			auto pSignalDisableBuildPlateTempControl = registerSignal ("disablecontroller", 4, 1000);
-			pSignalDisableBuildPlateTempControl->addBoolResult ("success", false);
+			auto pSignalDisableBuildPlateTempControl = registerSignal ("disablecontroller", 4, 1000, OXYGEN_SIGNAL_DISABLECONTROLLER);
+			pSignalDisableBuildPlateTempControl->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			pSignalDisableBuildPlateTempControl->setPriority (eSignalPriority::High);
 			
-			auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000);
-			pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false);
-			pSignalToggleValves->addBoolResult ("success", false);
+			auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000, OXYGEN_SIGNAL_TOGGLEVALVES);
+			pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false, SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+			pSignalToggleValves->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 	
 		}
 		
@@ -39,6 +39,26 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20SC0842.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the powder reservoir axis state machine, bound once in the state handler constructor
+#define POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS 0
+#define POWDERRESERVOIR_MODULE_115KF53 1
+
+// State IDs of the powder reservoir axis state machine, in registration order
+#define POWDERRESERVOIR_STATE_WAIT_FOR_INIT 0
+#define POWDERRESERVOIR_STATE_INIT 1
+#define POWDERRESERVOIR_STATE_IDLE 2
+#define POWDERRESERVOIR_STATE_AXIS_MOVEMENT 3
+#define POWDERRESERVOIR_STATE_WAIT_FOR_AXIS_MOVEMENT 4
+#define POWDERRESERVOIR_STATE_MANUAL_REFERENCING 5
+#define POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING 6
+#define POWDERRESERVOIR_STATE_ERROR 7
+#define POWDERRESERVOIR_STATE_FAULT 8
+
+// Signal IDs of the powder reservoir axis state machine, in registration order
+#define POWDERRESERVOIR_SIGNAL_INITAXIS 0
+#define POWDERRESERVOIR_SIGNAL_TRIGGERSINGLEAXISMOVEMENT 1
+#define POWDERRESERVOIR_SIGNAL_REFERENCEAXIS 2
+
 
 
 namespace BuRCPP {
@@ -54,24 +74,24 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			// check for PC signals
-			auto pSignalInitPowderreservoirAxis = pEnvironment->checkSignal ("initaxis");
+			auto pSignalInitPowderreservoirAxis = pEnvironment->checkSignal (POWDERRESERVOIR_SIGNAL_INITAXIS);
 			
 			if(pSignalInitPowderreservoirAxis)
 			{ // wait for PC signal to init
-				pSignalInitPowderreservoirAxis->setBoolResult("success", true);
+				pSignalInitPowderreservoirAxis->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 				pSignalInitPowderreservoirAxis->finishProcessing ();
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_INIT);
 			}
 			else if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_init");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_WAIT_FOR_INIT);
 			}
 						
 		}
@@ -88,7 +108,7 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			
 			if (pReservoirAxisModule->canSetPower ()) 
@@ -96,21 +116,21 @@ namespace BuRCPP {
 				if(pReservoirAxisModule->isReferenced ())
 				{
 					pReservoirAxisModule->setPower(true);
-					pEnvironment->setNextState ("idle");
+					pEnvironment->setNextState (POWDERRESERVOIR_STATE_IDLE);
 				}
 				else
 				{
 					pReservoirAxisModule->setPowerOnAndStartReference ();
-					pEnvironment->setNextState ("wait_for_referencing");	
+					pEnvironment->setNextState (POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING);	
 				}
 			} 
 			else if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_INIT);
 			}
 			
 		}
@@ -127,44 +147,44 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(POWDERRESERVOIR_STATE_IDLE);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			// check for PC signals
-			auto pSignalReferenceAxis = pEnvironment->checkSignal ("referenceaxis");
-			auto pSignalSingleAxisMovement = pEnvironment->checkSignal ("triggersingleaxismovement");
+			auto pSignalReferenceAxis = pEnvironment->checkSignal (POWDERRESERVOIR_SIGNAL_REFERENCEAXIS);
+			auto pSignalSingleAxisMovement = pEnvironment->checkSignal (POWDERRESERVOIR_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
 			
 			if (pSignalReferenceAxis) 
 			{
-				bool referenceReservoirAxis = pSignalReferenceAxis->getBoolParameter("reference_powderreservoir");
+				bool referenceReservoirAxis = pSignalReferenceAxis->getBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR);
 				
 				if (referenceReservoirAxis)
 				{
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_REFERENCEPOWDERRESERVOIR, referenceReservoirAxis);
 					pSignalReferenceAxis->finishProcessing ();
-					pEnvironment->setNextState("manual_referencing");
+					pEnvironment->setNextState(POWDERRESERVOIR_STATE_MANUAL_REFERENCING);
 					return;
 				}
 			}
 			if (pSignalSingleAxisMovement) 
 			{
-				int axisid = pSignalSingleAxisMovement->getInt32Parameter("axisid");
+				int axisid = pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID);
 				if (axisid == AXISID_POWDERRESERVOIR)
 				{
-					pEnvironment->setNextState("axis_movement");
-					pEnvironment->setIntegerValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter("absoluterelative"));
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter("position") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter("speed") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter("acceleration") * 0.001);
+					pEnvironment->setNextState(POWDERRESERVOIR_STATE_AXIS_MOVEMENT);
+					pEnvironment->setIntegerValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE));
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION) * 0.001);
 					pSignalSingleAxisMovement->finishProcessing ();
 					return;
 				}
 			}
 			if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 		}
 	};
@@ -179,10 +199,10 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("axis_movement");
+			pEnvironment->setNextState(POWDERRESERVOIR_STATE_AXIS_MOVEMENT);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			if (true)//(pReservoirAxisModule->canMoveAxis ()) 
 			{	
@@ -197,15 +217,15 @@ namespace BuRCPP {
 				}else if (absoluterelative == AXISMOVEMENT_RELATIVE){
 					pReservoirAxisModule->moveAxisRelative (position, speed, acceleration);
 				}
-				pEnvironment->setNextState ("wait_for_axis_movement");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_WAIT_FOR_AXIS_MOVEMENT);
 			} 
 			else if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("axis_movement");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_AXIS_MOVEMENT);
 			}
 		}
 	
@@ -221,22 +241,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_axis_movement");
+			pEnvironment->setNextState(POWDERRESERVOIR_STATE_WAIT_FOR_AXIS_MOVEMENT);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 				
 			if (pReservoirAxisModule->isInPosition())
 			{	
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_IDLE);
 			} 
 			else if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("wait_for_axis_movement");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_WAIT_FOR_AXIS_MOVEMENT);
 			}
 
 		}
@@ -254,22 +274,22 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			auto referenceReservoirAxis = pEnvironment->getInt32Value(JOURNALVARIABLE_REFERENCEPOWDERRESERVOIR);
 			
 			if (pReservoirAxisModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else if(referenceReservoirAxis)
 			{
 				pReservoirAxisModule->startReference ();
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING);
 			}
 			else
 			{
-				pEnvironment->setNextState("manual_referencing");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_MANUAL_REFERENCING);
 			}
 
 		}
@@ -286,22 +306,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_referencing");
+			pEnvironment->setNextState(POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
 			
 			if (pReservoirAxisModule->isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else if(pReservoirAxisModule->isReferenced ())
 			{
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_IDLE);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING);
 			}
 
 		}
@@ -318,11 +338,11 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(POWDERRESERVOIR_STATE_ERROR);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, "PowderReservoirAxis");
-			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, "115KF53"); //acknowledge button
+			ioModuleAccess<CMappMotion_SingleRotationalAxis> pReservoirAxisModule (pEnvironment, POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
+			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, POWDERRESERVOIR_MODULE_115KF53); //acknowledge button
 					
 			if(pSafeDigitalInputModule115KF53->getInput(2) == 1) //acknowledge button pressed
 			{
@@ -331,11 +351,50 @@ namespace BuRCPP {
 			
 			if (pReservoirAxisModule->isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_INIT);
+			}
+					
+		}
+	
+	};
+	
+		
+	
+	class CStatePowderReservoirAxis_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// bring the axis to standstill, the stop takes effect once the axis module is handled again
+			auto pPowderReservoirAxisModule = pEnvironment->getModuleForFaultState<CMappMotion_SingleRotationalAxis> (POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS);
+			pPowderReservoirAxisModule->stopAxis ();
+			
+			if (!pEnvironment->boundModulesAreAvailable ())
+			{
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_FAULT);
+			}
+			else if (pPowderReservoirAxisModule->isError ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_ERROR);
+			}
+			else if (pPowderReservoirAxisModule->isIdle ())
+			{ // the axis has to be initialized again by the PC
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_WAIT_FOR_INIT);
+			}
+			else
+			{
+				pEnvironment->setNextState (POWDERRESERVOIR_STATE_FAULT);
 			}
 					
 		}
@@ -351,15 +410,23 @@ namespace BuRCPP {
 			// retrieve the journal group variable
 			: CStateHandler (pApplication->getJournal (), "powder_reservoir_axis", pApplication->getModuleHandler (), JOURNALGROUP_POWDER_RESERVOIR_AXIS)
 		{
-			// register state machines
-			addState (std::make_shared<CStatePowderReservoirAxis_WaitForInit> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_Init> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_Idle> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_AxisMovement> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_WaitForAxisMovement> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_ManualReferencing> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_WaitForReferencing> ());
-			addState (std::make_shared<CStatePowderReservoirAxis_Error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CMappMotion_SingleRotationalAxis> (POWDERRESERVOIR_MODULE_POWDERRESERVOIRAXIS, "PowderReservoirAxis");
+			bindModule<CIOModule_X20SC0842> (POWDERRESERVOIR_MODULE_115KF53, "115KF53");
+			
+			// register state machines, a registration out of order against the POWDERRESERVOIR_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStatePowderReservoirAxis_WaitForInit> (), POWDERRESERVOIR_STATE_WAIT_FOR_INIT);
+			addState (std::make_shared<CStatePowderReservoirAxis_Init> (), POWDERRESERVOIR_STATE_INIT);
+			addState (std::make_shared<CStatePowderReservoirAxis_Idle> (), POWDERRESERVOIR_STATE_IDLE);
+			addState (std::make_shared<CStatePowderReservoirAxis_AxisMovement> (), POWDERRESERVOIR_STATE_AXIS_MOVEMENT);
+			addState (std::make_shared<CStatePowderReservoirAxis_WaitForAxisMovement> (), POWDERRESERVOIR_STATE_WAIT_FOR_AXIS_MOVEMENT);
+			addState (std::make_shared<CStatePowderReservoirAxis_ManualReferencing> (), POWDERRESERVOIR_STATE_MANUAL_REFERENCING);
+			addState (std::make_shared<CStatePowderReservoirAxis_WaitForReferencing> (), POWDERRESERVOIR_STATE_WAIT_FOR_REFERENCING);
+			addState (std::make_shared<CStatePowderReservoirAxis_Error> (), POWDERRESERVOIR_STATE_ERROR);
+			addState (std::make_shared<CStatePowderReservoirAxis_Fault> (), POWDERRESERVOIR_STATE_FAULT);
+			
+			// a throwing state stops the axis in the fault state
+			setFaultState (POWDERRESERVOIR_STATE_FAULT);
 			
 			// register journal variables
 			registerIntegerValue("powderreservoir_absoluterelative", JOURNALVARIABLE_POWDERRESERVOIRMOVEMENTABSOLUTERELATIVE, 0, 1);
@@ -370,24 +437,24 @@ namespace BuRCPP {
 		
 			
 					
-			// register signals
-			auto pSignalInitPowderreservoirAxis = registerSignal ("initaxis", 4, 1000);
-			pSignalInitPowderreservoirAxis->addBoolResult ("success", false);
+			// register signals, a registration out of order against the POWDERRESERVOIR_SIGNAL_* IDs fails the initialization
+			auto pSignalInitPowderreservoirAxis = registerSignal ("initaxis", 4, 1000, POWDERRESERVOIR_SIGNAL_INITAXIS);
+			pSignalInitPowderreservoirAxis->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000);
-			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("position", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0);
-			pSignalSingleAxisMovement->addBoolResult ("success", false);
+			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000, POWDERRESERVOIR_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
+			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0, SIGNAL_AXISMOVEMENT_PARAM_AXISID);
+			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0, SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE);
+			pSignalSingleAxisMovement->addInt32Parameter ("position", 0, SIGNAL_AXISMOVEMENT_PARAM_POSITION);
+			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0, SIGNAL_AXISMOVEMENT_PARAM_SPEED);
+			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0, SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION);
+			pSignalSingleAxisMovement->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
-			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000);
-			pSignalReferenceAxis->addBoolParameter ("reference_platform", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false);
-			pSignalReferenceAxis->addBoolResult ("success", false);
+			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000, POWDERRESERVOIR_SIGNAL_REFERENCEAXIS);
+			pSignalReferenceAxis->addBoolParameter ("reference_platform", false, SIGNAL_REFERENCEAXIS_PARAM_PLATFORM);
+			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false, SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR);
+			pSignalReferenceAxis->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
 		}
 	
@@ -40,6 +40,33 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/MappMotion_SingleAxis.hpp"
 #include "Modules/IOModule_X20SC0842.hpp"
 
+// Module IDs of the recoater axes state machine, bound once in the state handler constructor
+#define RECOATER_MODULE_RECOATERLINEAR 0
+#define RECOATER_MODULE_RECOATERAXISPOWDERBELT 1
+#define RECOATER_MODULE_115KF53 2
+
+// State IDs of the recoater axes state machine, in registration order
+#define RECOATER_STATE_WAIT_FOR_INIT 0
+#define RECOATER_STATE_INIT 1
+#define RECOATER_STATE_IDLE 2
+#define RECOATER_STATE_LINEAR_AXIS_MOVEMENT 3
+#define RECOATER_STATE_WAIT_FOR_LINEAR_AXIS_MOVEMENT 4
+#define RECOATER_STATE_POWDER_BELT_AXIS_MOVEMENT 5
+#define RECOATER_STATE_WAIT_FOR_POWDER_BELT_AXIS_MOVEMENT 6
+#define RECOATER_STATE_DUAL_AXIS_MOVEMENT 7
+#define RECOATER_STATE_WAIT_FOR_DUAL_AXIS_MOVEMENT 8
+#define RECOATER_STATE_MANUAL_REFERENCING 9
+#define RECOATER_STATE_WAIT_FOR_REFERENCING 10
+#define RECOATER_STATE_ERROR 11
+#define RECOATER_STATE_FAULT 12
+
+// Signal IDs of the recoater axes state machine, in registration order
+#define RECOATER_SIGNAL_INITPOWDERAXIS 0
+#define RECOATER_SIGNAL_INITLINEARAXIS 1
+#define RECOATER_SIGNAL_TRIGGERSINGLEAXISMOVEMENT 2
+#define RECOATER_SIGNAL_REFERENCEAXIS 3
+#define RECOATER_SIGNAL_RECOATERDUALAXISMOVEMENT 4
+
 
 
 namespace BuRCPP {
@@ -54,14 +81,14 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_init");
+			pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_INIT);
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			// check for PC signals
-			auto pSignalInitRecoateraxisPowder = pEnvironment->checkSignal ("initpowderaxis");
-			auto pSignalInitRecoateraxisLinear = pEnvironment->checkSignal ("initlinearaxis");
+			auto pSignalInitRecoateraxisPowder = pEnvironment->checkSignal (RECOATER_SIGNAL_INITPOWDERAXIS);
+			auto pSignalInitRecoateraxisLinear = pEnvironment->checkSignal (RECOATER_SIGNAL_INITLINEARAXIS);
 			
 			// get journal variables
 			auto bInitRecoateraxisPowder = pEnvironment->getBoolValue(JOURNALVARIABLE_INITRECOATERPOWDERBELT);
@@ -70,27 +97,27 @@ namespace BuRCPP {
 			if(bInitRecoateraxisPowder && bInitRecoateraxisLinear)
 			{
 				// wait for PC signal to init
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(RECOATER_STATE_INIT);
 			}
 			else if(pSignalInitRecoateraxisPowder)
 			{
 				pEnvironment->setBoolValue(JOURNALVARIABLE_INITRECOATERPOWDERBELT, true);
-				pSignalInitRecoateraxisPowder->setBoolResult("success", true);
+				pSignalInitRecoateraxisPowder->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 				pSignalInitRecoateraxisPowder->finishProcessing ();
 			}
 			else if (pSignalInitRecoateraxisLinear)
 			{ 
 				pEnvironment->setBoolValue(JOURNALVARIABLE_INITRECOATERLINEAR, true);
-				pSignalInitRecoateraxisLinear->setBoolResult("success", true);
+				pSignalInitRecoateraxisLinear->setBoolResult(SIGNAL_RESULT_SUCCESS, true);
 				pSignalInitRecoateraxisLinear->finishProcessing ();
 			}
 			else if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_init");
+				pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_INIT);
 			}
 						
 		}
@@ -107,8 +134,8 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			if (pRecoaterAxisLinearModule->canSetPower () && pRecoaterAxisPowderbeltModule->canSetPower () ) 
 			{
@@ -116,23 +143,23 @@ namespace BuRCPP {
 				{
 					pRecoaterAxisLinearModule->setPower(true);
 					pRecoaterAxisPowderbeltModule->setPower(true);
-					pEnvironment->setNextState ("idle");
+					pEnvironment->setNextState (RECOATER_STATE_IDLE);
 				}
 				else
 				{
 					pRecoaterAxisLinearModule->setPowerOnAndStartReference ();
 					pRecoaterAxisPowderbeltModule->setPowerOnAndStartReference ();
-					pEnvironment->setNextState ("wait_for_referencing");	
+					pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_REFERENCING);	
 				}
 			
 			} 
 			else if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (RECOATER_STATE_INIT);
 			}
 			
 		}
@@ -149,69 +176,69 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("idle");
+			pEnvironment->setNextState(RECOATER_STATE_IDLE);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			// check for PC signals
-			auto pSignalReferenceAxis = pEnvironment->checkSignal ("referenceaxis");
-			auto pSignalSingleAxisMovement = pEnvironment->checkSignal ("triggersingleaxismovement");
-			auto pSignalDualAxisMovement = pEnvironment->checkSignal ("recoaterdualaxismovement");
+			auto pSignalReferenceAxis = pEnvironment->checkSignal (RECOATER_SIGNAL_REFERENCEAXIS);
+			auto pSignalSingleAxisMovement = pEnvironment->checkSignal (RECOATER_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
+			auto pSignalDualAxisMovement = pEnvironment->checkSignal (RECOATER_SIGNAL_RECOATERDUALAXISMOVEMENT);
 			
 			if (pSignalReferenceAxis) 
 			{
-				bool referenceRecoaterAxisLinear = pSignalReferenceAxis->getBoolParameter("reference_recoateraxis_linear");
-				bool referenceRecoaterAxisPowder = pSignalReferenceAxis->getBoolParameter("reference_recoateraxis_powder");
+				bool referenceRecoaterAxisLinear = pSignalReferenceAxis->getBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR);
+				bool referenceRecoaterAxisPowder = pSignalReferenceAxis->getBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER);
 				
 				if (referenceRecoaterAxisLinear || referenceRecoaterAxisLinear)
 				{
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_REFERENCERECOATERPOWDERBELT, referenceRecoaterAxisPowder);	
 					pEnvironment->setIntegerValue(JOURNALVARIABLE_REFERENCERECOATERLINEAR, referenceRecoaterAxisLinear);
-					pEnvironment->setNextState("manual_referencing");
+					pEnvironment->setNextState(RECOATER_STATE_MANUAL_REFERENCING);
 					pSignalReferenceAxis->finishProcessing (); 
 					return;
 				}
 			}
 			if (pSignalSingleAxisMovement) 
 			{ 
-				int axisid = pSignalSingleAxisMovement->getInt32Parameter("axisid");
+				int axisid = pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID);
 				if (axisid == AXISID_RECOATELINEAR)
 				{
-					pEnvironment->setNextState("linear_axis_movement");
-					pEnvironment->setIntegerValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter("absoluterelative"));
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter("position") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter("speed") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter("acceleration") * 0.001);
+					pEnvironment->setNextState(RECOATER_STATE_LINEAR_AXIS_MOVEMENT);
+					pEnvironment->setIntegerValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE));
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERLINEARMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION) * 0.001);
 					pSignalSingleAxisMovement->finishProcessing (); 
 					return;
 				} 
 				else if (axisid == AXISID_RECOATERPOWDERBELT)
 				{
-					pEnvironment->setNextState("powder_belt_axis_movement");
-					pEnvironment->setIntegerValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter("absoluterelative"));
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter("position") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter("speed") * 0.001);
-					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter("acceleration") * 0.001);
+					pEnvironment->setNextState(RECOATER_STATE_POWDER_BELT_AXIS_MOVEMENT);
+					pEnvironment->setIntegerValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTABSOLUTERELATIVE, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE));
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTPOSITION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTSPEED, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED) * 0.001);
+					pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTACCELERATION, pSignalSingleAxisMovement->getInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION) * 0.001);
 					pSignalSingleAxisMovement->finishProcessing (); 
 					return;
 				}
 			}
 			if (pSignalDualAxisMovement)
 			{
-				pEnvironment->setNextState("dual_axis_movement");
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTSTARTPOSITION, pSignalDualAxisMovement->getInt32Parameter("recoateraxis_linear_start_position") * 0.001);
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTTARGETPOSITION, pSignalDualAxisMovement->getInt32Parameter("recoateraxis_linear_target_position") * 0.001);
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTLINEARAXISSPEED, pSignalDualAxisMovement->getInt32Parameter("recoateraxis_linear_speed") * 0.001);
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTPOWDERAXISSPEED, pSignalDualAxisMovement->getInt32Parameter("recoateraxis_powder_speed") * 0.001);
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTLINEARAXISACCELERATION, pSignalDualAxisMovement->getInt32Parameter("recoater_axes_linear_acceleration") * 0.001);
-				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTPOWDERAXISACCELERATION, pSignalDualAxisMovement->getInt32Parameter("recoater_axes_powder_acceleration") * 0.001);
+				pEnvironment->setNextState(RECOATER_STATE_DUAL_AXIS_MOVEMENT);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTSTARTPOSITION, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSTARTPOSITION) * 0.001);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTTARGETPOSITION, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARTARGETPOSITION) * 0.001);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTLINEARAXISSPEED, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSPEED) * 0.001);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTPOWDERAXISSPEED, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERSPEED) * 0.001);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTLINEARAXISACCELERATION, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARACCELERATION) * 0.001);
+				pEnvironment->setDoubleValue(JOURNALVARIABLE_RECOATERMOVEMENTPOWDERAXISACCELERATION, pSignalDualAxisMovement->getInt32Parameter(SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERACCELERATION) * 0.001);
 				pSignalDualAxisMovement->finishProcessing (); 
 			}
 			if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 		}
 	};
@@ -226,10 +253,10 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("linear_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_LINEAR_AXIS_MOVEMENT);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
 			
 			if (pRecoaterAxisLinearModule->canMoveAxis ()) 
 			{	
@@ -244,15 +271,15 @@ namespace BuRCPP {
 				}else if (absoluterelative == AXISMOVEMENT_RELATIVE){
 					pRecoaterAxisLinearModule->moveAxisRelative (position, speed, acceleration);
 				}
-				pEnvironment->setNextState ("wait_for_linear_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_LINEAR_AXIS_MOVEMENT);
 			} 
 			else if (pRecoaterAxisLinearModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("linear_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_LINEAR_AXIS_MOVEMENT);
 			}
 		}
 	
@@ -268,23 +295,23 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_linear_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_LINEAR_AXIS_MOVEMENT);
 				
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
 				
 			if (pRecoaterAxisLinearModule->isInPosition())
 			{	
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (RECOATER_STATE_IDLE);
 			} 
 			else if (pRecoaterAxisLinearModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("wait_for_linear_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_LINEAR_AXIS_MOVEMENT);
 			}
 
 		}
@@ -301,10 +328,10 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("powder_belt_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_POWDER_BELT_AXIS_MOVEMENT);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			if (pRecoaterAxisPowderbeltModule->canMoveAxis ()) 
 			{	
@@ -319,15 +346,15 @@ namespace BuRCPP {
 				}else if (absoluterelative == AXISMOVEMENT_RELATIVE){
 					pRecoaterAxisPowderbeltModule->moveAxisRelative (position, speed, acceleration);
 				}
-				pEnvironment->setNextState ("wait_for_powder_belt_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_POWDER_BELT_AXIS_MOVEMENT);
 			} 
 			else if (pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("powder_belt_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_POWDER_BELT_AXIS_MOVEMENT);
 			}
 		}
 	
@@ -343,22 +370,22 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_powder_belt_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_POWDER_BELT_AXIS_MOVEMENT);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 				
 			if (pRecoaterAxisPowderbeltModule->isInPosition())
 			{	
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (RECOATER_STATE_IDLE);
 			} 
 			else if (pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("wait_for_powder_belt_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_POWDER_BELT_AXIS_MOVEMENT);
 			}
 
 		}
@@ -375,11 +402,11 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("dual_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_DUAL_AXIS_MOVEMENT);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			
 			if (pRecoaterAxisLinearModule->canMoveAxis () && pRecoaterAxisPowderbeltModule->canMoveAxis ()) 
@@ -395,15 +422,15 @@ namespace BuRCPP {
 				auto recoateraxis_powder_target_position = ((-(recoateraxis_linear_target_position-recoateraxis_linear_start_position))/recoateraxis_linear_speed)*recoateraxis_powder_speed;
 				pRecoaterAxisPowderbeltModule->moveAxisRelative (recoateraxis_powder_target_position, recoateraxis_powder_speed, recoater_axes_powder_acceleration);
 				
-				pEnvironment->setNextState ("wait_for_dual_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_DUAL_AXIS_MOVEMENT);
 			} 
 			else if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("dual_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_DUAL_AXIS_MOVEMENT);
 			}
 		}
 	
@@ -419,24 +446,24 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_dual_axis_movement");
+			pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_DUAL_AXIS_MOVEMENT);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 				
 			if (pRecoaterAxisLinearModule->isInPosition() && pRecoaterAxisPowderbeltModule->isInPosition())
 			{	
-				pEnvironment->setNextState ("idle");
+				pEnvironment->setNextState (RECOATER_STATE_IDLE);
 			} 
 			else if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else 
 			{
-				pEnvironment->setNextState ("wait_for_dual_axis_movement");
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_DUAL_AXIS_MOVEMENT);
 			}
 
 		}
@@ -454,15 +481,15 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			auto referenceRecoaterAxisLinear = pEnvironment->getInt32Value(JOURNALVARIABLE_REFERENCERECOATERLINEAR);
 			auto referenceRecoaterAxisPowder = pEnvironment->getInt32Value(JOURNALVARIABLE_REFERENCERECOATERPOWDERBELT);
 				
 			if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else if (referenceRecoaterAxisLinear || referenceRecoaterAxisPowder)
 			{
@@ -474,11 +501,11 @@ namespace BuRCPP {
 				{
 					pRecoaterAxisPowderbeltModule->startReference ();
 				}
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_REFERENCING);
 			}
 			else
 			{
-				pEnvironment->setNextState("manual_referencing");
+				pEnvironment->setNextState(RECOATER_STATE_MANUAL_REFERENCING);
 			}
 			
 		}
@@ -495,23 +522,23 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("wait_for_referencing");
+			pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_REFERENCING);
 				
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
 			
 			if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else if(pRecoaterAxisLinearModule->isReferenced () && pRecoaterAxisPowderbeltModule->isReferenced ())
 			{
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(RECOATER_STATE_IDLE);
 			}
 			else
 			{
-				pEnvironment->setNextState("wait_for_referencing");
+				pEnvironment->setNextState(RECOATER_STATE_WAIT_FOR_REFERENCING);
 			}
 
 		}
@@ -528,12 +555,12 @@ namespace BuRCPP {
 	
 		void Execute (CEnvironment * pEnvironment) 
 		{
-			pEnvironment->setNextState("error");
+			pEnvironment->setNextState(RECOATER_STATE_ERROR);
 			
 			// access an IO modules
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, "RecoaterLinear");
-			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, "RecoaterAxisPowderbelt");
-			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, "115KF53"); //acknowledge button
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisLinearModule (pEnvironment, RECOATER_MODULE_RECOATERLINEAR);
+			ioModuleAccess<CMappMotion_SingleLinearAxis> pRecoaterAxisPowderbeltModule (pEnvironment, RECOATER_MODULE_RECOATERAXISPOWDERBELT);
+			ioModuleAccess<CIOModule_X20SC0842> pSafeDigitalInputModule115KF53 (pEnvironment, RECOATER_MODULE_115KF53); //acknowledge button
 					
 			if(pSafeDigitalInputModule115KF53->getInput(2) == 1) //acknowledge button pressed
 			{
@@ -543,11 +570,51 @@ namespace BuRCPP {
 			
 			if (pRecoaterAxisLinearModule-> isError () || pRecoaterAxisPowderbeltModule-> isError ())
 			{
-				pEnvironment->setNextState ("error");
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (RECOATER_STATE_INIT);
+			}
+								
+		}
+	
+	};
+	
+		
+	
+	class CStateRecoaterAxes_Fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// bring both axes to standstill, the stop takes effect once the axis modules are handled again
+			auto pRecoaterAxisLinearModule = pEnvironment->getModuleForFaultState<CMappMotion_SingleLinearAxis> (RECOATER_MODULE_RECOATERLINEAR);
+			auto pRecoaterAxisPowderbeltModule = pEnvironment->getModuleForFaultState<CMappMotion_SingleLinearAxis> (RECOATER_MODULE_RECOATERAXISPOWDERBELT);
+			pRecoaterAxisLinearModule->stopAxis ();
+			pRecoaterAxisPowderbeltModule->stopAxis ();
+			
+			bool bLinearAxisStopped = pRecoaterAxisLinearModule->isIdle () || pRecoaterAxisLinearModule->isError ();
+			bool bPowderbeltAxisStopped = pRecoaterAxisPowderbeltModule->isIdle () || pRecoaterAxisPowderbeltModule->isError ();
+			
+			if (!pEnvironment->boundModulesAreAvailable () || !bLinearAxisStopped || !bPowderbeltAxisStopped)
+			{
+				pEnvironment->setNextState (RECOATER_STATE_FAULT);
+			}
+			else if (pRecoaterAxisLinearModule->isError () || pRecoaterAxisPowderbeltModule->isError ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (RECOATER_STATE_ERROR);
+			}
+			else
+			{ // the axes have to be initialized again by the PC
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState (RECOATER_STATE_WAIT_FOR_INIT);
 			}
 								
 		}
@@ -563,19 +630,28 @@ namespace BuRCPP {
 			// retrieve the journal group variable
 			: CStateHandler (pApplication->getJournal(), "recoater_axes", pApplication->getModuleHandler (), JOURNALGROUP_RECOATER_AXES)
 		{
-			// register state machines
-			addState (std::make_shared<CStateRecoaterAxes_WaitForInit> ());
-			addState (std::make_shared<CStateRecoaterAxes_Init> ());
-			addState (std::make_shared<CStateRecoaterAxes_Idle> ());
-			addState (std::make_shared<CStateRecoaterAxes_LinearAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_WaitForLinearAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_PowderBeltAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_WaitForPowderBeltAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_DualAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_WaitForDualAxisMovement> ());
-			addState (std::make_shared<CStateRecoaterAxes_ManualReferencing> ());
-			addState (std::make_shared<CStateRecoaterAxes_WaitForReferencing> ());
-			addState (std::make_shared<CStateRecoaterAxes_Error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CMappMotion_SingleLinearAxis> (RECOATER_MODULE_RECOATERLINEAR, "RecoaterLinear");
+			bindModule<CMappMotion_SingleLinearAxis> (RECOATER_MODULE_RECOATERAXISPOWDERBELT, "RecoaterAxisPowderbelt");
+			bindModule<CIOModule_X20SC0842> (RECOATER_MODULE_115KF53, "115KF53");
+			
+			// register state machines, a registration out of order against the RECOATER_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateRecoaterAxes_WaitForInit> (), RECOATER_STATE_WAIT_FOR_INIT);
+			addState (std::make_shared<CStateRecoaterAxes_Init> (), RECOATER_STATE_INIT);
+			addState (std::make_shared<CStateRecoaterAxes_Idle> (), RECOATER_STATE_IDLE);
+			addState (std::make_shared<CStateRecoaterAxes_LinearAxisMovement> (), RECOATER_STATE_LINEAR_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_WaitForLinearAxisMovement> (), RECOATER_STATE_WAIT_FOR_LINEAR_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_PowderBeltAxisMovement> (), RECOATER_STATE_POWDER_BELT_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_WaitForPowderBeltAxisMovement> (), RECOATER_STATE_WAIT_FOR_POWDER_BELT_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_DualAxisMovement> (), RECOATER_STATE_DUAL_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_WaitForDualAxisMovement> (), RECOATER_STATE_WAIT_FOR_DUAL_AXIS_MOVEMENT);
+			addState (std::make_shared<CStateRecoaterAxes_ManualReferencing> (), RECOATER_STATE_MANUAL_REFERENCING);
+			addState (std::make_shared<CStateRecoaterAxes_WaitForReferencing> (), RECOATER_STATE_WAIT_FOR_REFERENCING);
+			addState (std::make_shared<CStateRecoaterAxes_Error> (), RECOATER_STATE_ERROR);
+			addState (std::make_shared<CStateRecoaterAxes_Fault> (), RECOATER_STATE_FAULT);
+			
+			// a throwing state stops both axes in the fault state
+			setFaultState (RECOATER_STATE_FAULT);
 			
 			// register journal variables
 			registerIntegerValue("recoater_powder_absoluterelative", JOURNALVARIABLE_RECOATERPOWDERBELTMOVEMENTABSOLUTERELATIVE, 0, 1);
@@ -599,36 +675,36 @@ namespace BuRCPP {
 			registerBoolValue("init_powderaxis", JOURNALVARIABLE_INITRECOATERPOWDERBELT);
 			registerBoolValue("init_linearaxis", JOURNALVARIABLE_INITRECOATERLINEAR);
 				
-			// register signals
-			auto pSignalInitRecoateraxisPowder = registerSignal ("initpowderaxis", 4, 1000);
-			pSignalInitRecoateraxisPowder->addBoolResult ("success", false);
-			
-			auto pSignalInitRecoateraxisLinear = registerSignal ("initlinearaxis", 4, 1000);
-			pSignalInitRecoateraxisLinear->addBoolResult ("success", false);
-			
-			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000);
-			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("position", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0);
-			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0);
-			pSignalSingleAxisMovement->addBoolResult ("success", false);
+			// register signals, a registration out of order against the RECOATER_SIGNAL_* IDs fails the initialization
+			auto pSignalInitRecoateraxisPowder = registerSignal ("initpowderaxis", 4, 1000, RECOATER_SIGNAL_INITPOWDERAXIS);
+			pSignalInitRecoateraxisPowder->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			
+			auto pSignalInitRecoateraxisLinear = registerSignal ("initlinearaxis", 4, 1000, RECOATER_SIGNAL_INITLINEARAXIS);
+			pSignalInitRecoateraxisLinear->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			
+			auto pSignalSingleAxisMovement = registerSignal ("triggersingleaxismovement", 4, 1000, RECOATER_SIGNAL_TRIGGERSINGLEAXISMOVEMENT);
+			pSignalSingleAxisMovement->addInt32Parameter ("axisid", 0, SIGNAL_AXISMOVEMENT_PARAM_AXISID);
+			pSignalSingleAxisMovement->addInt32Parameter ("absoluterelative", 0, SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE);
+			pSignalSingleAxisMovement->addInt32Parameter ("position", 0, SIGNAL_AXISMOVEMENT_PARAM_POSITION);
+			pSignalSingleAxisMovement->addInt32Parameter ("speed", 0, SIGNAL_AXISMOVEMENT_PARAM_SPEED);
+			pSignalSingleAxisMovement->addInt32Parameter ("acceleration", 0, SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION);
+			pSignalSingleAxisMovement->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
-			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000);
-			pSignalReferenceAxis->addBoolParameter ("reference_platform", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false);
-			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false);
-			pSignalReferenceAxis->addBoolResult ("success", false);
-			
-			auto pSignalRecoaterDualAxisMovement = registerSignal ("recoaterdualaxismovement", 4, 1000);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_start_position", 0);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_target_position", 0);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_speed", 0);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_powder_speed", 0);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoater_axes_linear_acceleration", 0);
-			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoater_axes_powder_acceleration", 0);
-			pSignalRecoaterDualAxisMovement->addBoolResult ("success", false);
+			auto pSignalReferenceAxis = registerSignal ("referenceaxis", 4, 1000, RECOATER_SIGNAL_REFERENCEAXIS);
+			pSignalReferenceAxis->addBoolParameter ("reference_platform", false, SIGNAL_REFERENCEAXIS_PARAM_PLATFORM);
+			pSignalReferenceAxis->addBoolParameter ("reference_powderreservoir", false, SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_powder", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER);
+			pSignalReferenceAxis->addBoolParameter ("reference_recoateraxis_linear", false, SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR);
+			pSignalReferenceAxis->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
+			
+			auto pSignalRecoaterDualAxisMovement = registerSignal ("recoaterdualaxismovement", 4, 1000, RECOATER_SIGNAL_RECOATERDUALAXISMOVEMENT);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_start_position", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSTARTPOSITION);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_target_position", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARTARGETPOSITION);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_linear_speed", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSPEED);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoateraxis_powder_speed", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERSPEED);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoater_axes_linear_acceleration", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARACCELERATION);
+			pSignalRecoaterDualAxisMovement->addInt32Parameter ("recoater_axes_powder_acceleration", 0, SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERACCELERATION);
+			pSignalRecoaterDualAxisMovement->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 		
 		}
 	
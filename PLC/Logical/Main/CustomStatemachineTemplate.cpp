@@ -39,6 +39,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20DI6371.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the template state machine, bound once in the state handler constructor
+#define TEMPLATE_MODULE_OUTPUTMODULENAME 0
+#define TEMPLATE_MODULE_INPUTMODULENAME 1
+#define TEMPLATE_MODULE_AXISNAME 2
+
+// State IDs of the template state machine, in registration order
+#define TEMPLATE_STATE_INIT 0
+#define TEMPLATE_STATE_EXAMPLE_STATE 1
+
 
 
 namespace BuRCPP {
@@ -62,11 +71,11 @@ namespace BuRCPP {
 			// add your custom implementation of the init state here
 			
 			// for example, access an IO module, has to be globally registered inside the CustomApplication.cpp
-			//ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule1 (pEnvironment, "OutputModuleName");
-			//ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule1 (pEnvironment, "InputModuleName");
+			//ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule1 (pEnvironment, TEMPLATE_MODULE_OUTPUTMODULENAME);
+			//ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule1 (pEnvironment, TEMPLATE_MODULE_INPUTMODULENAME);
 			
 			//or access an axis module, has to be globally registered inside the CustomApplication.cpp
-			//ioModuleAccess<CMappMotion_SingleLinearAxis> pTemplateAxisModule (pEnvironment, "Axisname");	
+			//ioModuleAccess<CMappMotion_SingleLinearAxis> pTemplateAxisModule (pEnvironment, TEMPLATE_MODULE_AXISNAME);	
 			
 			//add your custom method for the transition to the next state
 			
@@ -78,11 +87,11 @@ namespace BuRCPP {
 			//if not, stay in the init state and reset output 1 to false
 			
 			/*if(pDigitalInputModule1->getInput(2)){		
-				pEnvironment->setNextState ("example_state");
+				pEnvironment->setNextState (TEMPLATE_STATE_EXAMPLE_STATE);
 				pDigitalOutputModule1->setOutput(1, true);
 			}
 			else{
-				pEnvironment->setNextState ("init");
+				pEnvironment->setNextState (TEMPLATE_STATE_INIT);
 				pDigitalOutputModule->setOutput(1, false);
 			}*/
 			
@@ -109,7 +118,7 @@ namespace BuRCPP {
 			// implement functionality
 			// implement transition requirenments to go to the next state or to stay here
 			// ensure pEnvironment->setNextState() is calles at least once in all cases
-			// pEnvironment->setNextState("init");
+			// pEnvironment->setNextState(TEMPLATE_STATE_INIT);
 
 		}
 	
@@ -124,9 +133,14 @@ namespace BuRCPP {
 			// retrieve the journal group variable for this template state machine
 			: CStateHandler (pApplication->getJournal (), "template", pApplication->getModuleHandler (), JOURNALGROUP_TEMPLATE)
 		{
-			// register all states of this state machine here
-			addState (std::make_shared<CStateTEMPLATE_Init> ());
-			addState (std::make_shared<CStateTEMPLATE_Example_State> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20DO6322> (TEMPLATE_MODULE_OUTPUTMODULENAME, "OutputModuleName");
+			bindModule<CIOModule_X20DI6371> (TEMPLATE_MODULE_INPUTMODULENAME, "InputModuleName");
+			bindModule<CMappMotion_SingleLinearAxis> (TEMPLATE_MODULE_AXISNAME, "Axisname");
+			
+			// register all states of this state machine here, a registration out of order against the TEMPLATE_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateTEMPLATE_Init> (), TEMPLATE_STATE_INIT);
+			addState (std::make_shared<CStateTEMPLATE_Example_State> (), TEMPLATE_STATE_EXAMPLE_STATE);
 		
 		}
 	
@@ -43,6 +43,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Modules/IOModule_X20AI4622.hpp"
 #include "Modules/MappMotion_SingleAxis.hpp"
 
+// Module IDs of the vacuum system state machine, bound once in the state handler constructor
+#define VACUUMSYSTEM_MODULE_114KF28 0
+#define VACUUMSYSTEM_MODULE_114KF25 1
+#define VACUUMSYSTEM_MODULE_113KF19 2
+#define VACUUMSYSTEM_MODULE_113KF18 3
+#define VACUUMSYSTEM_MODULE_113KF17 4
+#define VACUUMSYSTEM_MODULE_113KF21 5
+#define VACUUMSYSTEM_MODULE_112KF15 6
+
+// State IDs of the vacuum system state machine, in registration order
+#define VACUUMSYSTEM_STATE_INIT 0
+#define VACUUMSYSTEM_STATE_IDLE 1
+#define VACUUMSYSTEM_STATE_VACUUM_PUMP_ON 2
+#define VACUUMSYSTEM_STATE_ERROR 3
+#define VACUUMSYSTEM_STATE_FAULT 4
+
+// Signal IDs of the vacuum system state machine, in registration order
+#define VACUUMSYSTEM_SIGNAL_INITVACUUMSYSTEM 0
+#define VACUUMSYSTEM_SIGNAL_TOGGLEVALVES 1
+#define VACUUMSYSTEM_SIGNAL_STARTVACUUMPUMP 2
+#define VACUUMSYSTEM_SIGNAL_TURNOFFVACUUMPUMP 3
+
 
 
 namespace BuRCPP {
@@ -57,10 +79,10 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, "114KF28"); // enable pump
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, "114KF25"); // set valves
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pressure measurement error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_1(pEnvironment, VACUUMSYSTEM_MODULE_114KF28); // enable pump
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule_2(pEnvironment, VACUUMSYSTEM_MODULE_114KF25); // set valves
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, VACUUMSYSTEM_MODULE_113KF19);// pressure measurement error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, VACUUMSYSTEM_MODULE_113KF18);// pump error
 			
 			pDigitalOutputModule_1->setOutput(2, false); // disable pump
 		
@@ -68,23 +90,23 @@ namespace BuRCPP {
 			pDigitalOutputModule_2->setOutput(5, false);
 			
 			// Signal from PC
-			auto pSignalInitVacuumSystem = pEnvironment->checkSignal ("initvacuumsystem");
+			auto pSignalInitVacuumSystem = pEnvironment->checkSignal (VACUUMSYSTEM_SIGNAL_INITVACUUMSYSTEM);
 			
 			if (pSignalInitVacuumSystem)
 			{
-				int pressure_threshold_vacuum_off_in_mbar = pSignalInitVacuumSystem->getInt32Parameter("pressurethresholdvacuumoffinmbar");
+				int pressure_threshold_vacuum_off_in_mbar = pSignalInitVacuumSystem->getInt32Parameter(SIGNAL_INITVACUUMSYSTEM_PARAM_PRESSURETHRESHOLDINMBAR);
 				pEnvironment->setIntegerValue(JOURNALVARIABLE_PRESSURE_THRESHOLD_VACUUM_OFF_IN_MBAR, pressure_threshold_vacuum_off_in_mbar);
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_IDLE);
 				pSignalInitVacuumSystem->finishProcessing ();
 			}
 			else 
 			{
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_INIT);
 			}
 			
 			if (pDigitalInputModule_1->getInput(2)==0 || pDigitalInputModule_2->getInput(5)==1)
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_ERROR);
 			}
 		}
 	};
@@ -100,20 +122,20 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pressure measurement error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, "113KF17");// get circulation valves status
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_4(pEnvironment, "113KF21");// get vacuum valves status
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF25"); // set valves
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, VACUUMSYSTEM_MODULE_113KF19);// pressure measurement error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, VACUUMSYSTEM_MODULE_113KF18);// pump error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_3(pEnvironment, VACUUMSYSTEM_MODULE_113KF17);// get circulation valves status
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_4(pEnvironment, VACUUMSYSTEM_MODULE_113KF21);// get vacuum valves status
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, VACUUMSYSTEM_MODULE_114KF25); // set valves
 			
 			// Signal from PC
-			auto pSignalStartVacuumPump = pEnvironment->checkSignal ("startvacuumpump");
-			auto pSignalToggleValves = pEnvironment->checkSignal ("togglevalves");
+			auto pSignalStartVacuumPump = pEnvironment->checkSignal (VACUUMSYSTEM_SIGNAL_STARTVACUUMPUMP);
+			auto pSignalToggleValves = pEnvironment->checkSignal (VACUUMSYSTEM_SIGNAL_TOGGLEVALVES);
 			
 			if (pSignalToggleValves) // toggle gas flow valves
 			{
-				bool toggle_zAxis_vacuum_valve = pSignalToggleValves->getBoolParameter("toggle_zAxis_vacuum_valve");
-				bool toggle_chamber_vacuum_valve = pSignalToggleValves->getBoolParameter("toggle_chamber_vacuum_valve");
+				bool toggle_zAxis_vacuum_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+				bool toggle_chamber_vacuum_valve = pSignalToggleValves->getBoolParameter(SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
 				
 				pDigitalOutputModule->setOutput(5, toggle_zAxis_vacuum_valve);
 				pDigitalOutputModule->setOutput(4, toggle_chamber_vacuum_valve);
@@ -122,17 +144,17 @@ namespace BuRCPP {
 			
 			if (pSignalStartVacuumPump && pDigitalInputModule_3->getInput(2)==1 && pDigitalInputModule_3->getInput(4)==1 && pDigitalInputModule_4->getInput(1)==1 && pDigitalInputModule_4->getInput(3)==1)
 			{
-				pEnvironment->setNextState("vacuum_pump_on");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_VACUUM_PUMP_ON);
 				pSignalStartVacuumPump->finishProcessing ();
 			}
 			else
 			{
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_IDLE);
 			}
 			
 			if (pDigitalInputModule_1->getInput(2)==0 || pDigitalInputModule_2->getInput(5)==1)
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_ERROR);
 			}
 		}
 	
@@ -149,13 +171,13 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pressure measurement error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
-			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule(pEnvironment, "112KF15");// pressure in volt
-			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, "114KF28");// enable vacuum pump
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, VACUUMSYSTEM_MODULE_113KF19);// pressure measurement error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, VACUUMSYSTEM_MODULE_113KF18);// pump error
+			ioModuleAccess<CIOModule_X20AI4622> pAnalogInputModule(pEnvironment, VACUUMSYSTEM_MODULE_112KF15);// pressure in volt
+			ioModuleAccess<CIOModule_X20DO6322> pDigitalOutputModule(pEnvironment, VACUUMSYSTEM_MODULE_114KF28);// enable vacuum pump
 			
 			// Signal from PC
-			auto pSignalTurnOffVacuumPump = pEnvironment->checkSignal ("turnoffvacuumpump");
+			auto pSignalTurnOffVacuumPump = pEnvironment->checkSignal (VACUUMSYSTEM_SIGNAL_TURNOFFVACUUMPUMP);
 			
 			double pressure_in_volt = pAnalogInputModule->getInputVoltageInVolt(1);
 			int pressure_in_mbar = (int) (std::pow(10 , 0.778*(pressure_in_volt - 6.143))); //characteristic curve of the pressure sensor, type-casting to integer
@@ -167,18 +189,18 @@ namespace BuRCPP {
 			if (pSignalTurnOffVacuumPump || (pressure_in_mbar < pressure_threshold_vacuum_off_in_mbar))
 			{
 				pDigitalOutputModule->setOutput(2, false); // disable vacuum pump
-				pEnvironment->setNextState("idle");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_IDLE);
 				pSignalTurnOffVacuumPump->finishProcessing ();
 			}
 			else
 			{
-				pEnvironment->setNextState("vacuum_pump_on");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_VACUUM_PUMP_ON);
 			}
 			
 			if (pDigitalInputModule_1->getInput(2)==0 || pDigitalInputModule_2->getInput(5)==1)
 			{
 				pDigitalOutputModule->setOutput(2, false); // disable vacuum pump
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_ERROR);
 			}
 		}
 	
@@ -195,16 +217,16 @@ namespace BuRCPP {
 		void Execute (CEnvironment * pEnvironment) 
 		{
 			// access io modules
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, "113KF19");// pressure measurement error
-			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, "113KF18");// pump error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_1(pEnvironment, VACUUMSYSTEM_MODULE_113KF19);// pressure measurement error
+			ioModuleAccess<CIOModule_X20DI6371> pDigitalInputModule_2(pEnvironment, VACUUMSYSTEM_MODULE_113KF18);// pump error
 				
 			if (pDigitalInputModule_1->getInput(2)==0 || pDigitalInputModule_2->getInput(5)==1)
 			{
-				pEnvironment->setNextState("error");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_ERROR);
 			}
 			else
 			{
-				pEnvironment->setNextState("init");
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_INIT);
 			}
 		}
 	
@@ -212,6 +234,41 @@ namespace BuRCPP {
 	
 		
 	
+	class CStateVacuumSystem_fault : public CState {
+		public:
+
+		std::string getName () 
+		{
+			return "fault";
+		}
+	
+		void Execute (CEnvironment * pEnvironment) 
+		{
+			// the outputs are written even if the modules are faulted
+			auto pDigitalOutputModule_1 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (VACUUMSYSTEM_MODULE_114KF28); // enable pump
+			auto pDigitalOutputModule_2 = pEnvironment->getModuleForFaultState<CIOModule_X20DO6322> (VACUUMSYSTEM_MODULE_114KF25); // set valves
+			
+			pDigitalOutputModule_1->setOutput(2, false); // disable pump
+		
+			pDigitalOutputModule_2->setOutput(4, false); // close vacuum valves
+			pDigitalOutputModule_2->setOutput(5, false);
+			
+			// start over once all modules are available again
+			if (pEnvironment->boundModulesAreAvailable ())
+			{
+				pEnvironment->clearFault ();
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_INIT);
+			}
+			else
+			{
+				pEnvironment->setNextState(VACUUMSYSTEM_STATE_FAULT);
+			}
+		}
+	
+	};
+	
+	
+	
 	class CStateHandlerVacuumSystem : public CStateHandler {
 		public:
 
@@ -219,30 +276,43 @@ namespace BuRCPP {
 			// retrieve the journal group variable for this vacuum system state machine
 			: CStateHandler (pApplication->getJournal (), "vacuumsystem", pApplication->getModuleHandler (), JOURNALGROUP_VACUUMSYSTEM)
 		{
-			// register all states of this state machine here
-			addState (std::make_shared<CStateVacuumSystem_Init> ());
-			addState (std::make_shared<CStateVacuumSystem_idle> ());
-			addState (std::make_shared<CStateVacuumSystem_vacuum_pump_on> ());
-			addState (std::make_shared<CStateVacuumSystem_error> ());
+			// bind the modules used by the states, a missing or mistyped module fails the initialization
+			bindModule<CIOModule_X20DO6322> (VACUUMSYSTEM_MODULE_114KF28, "114KF28");
+			bindModule<CIOModule_X20DO6322> (VACUUMSYSTEM_MODULE_114KF25, "114KF25");
+			bindModule<CIOModule_X20DI6371> (VACUUMSYSTEM_MODULE_113KF19, "113KF19");
+			bindModule<CIOModule_X20DI6371> (VACUUMSYSTEM_MODULE_113KF18, "113KF18");
+			bindModule<CIOModule_X20DI6371> (VACUUMSYSTEM_MODULE_113KF17, "113KF17");
+			bindModule<CIOModule_X20DI6371> (VACUUMSYSTEM_MODULE_113KF21, "113KF21");
+			bindModule<CIOModule_X20AI4622> (VACUUMSYSTEM_MODULE_112KF15, "112KF15");
+			
+			// register all states of this state machine here, a registration out of order against the VACUUMSYSTEM_STATE_* IDs fails the initialization
+			addState (std::make_shared<CStateVacuumSystem_Init> (), VACUUMSYSTEM_STATE_INIT);
+			addState (std::make_shared<CStateVacuumSystem_idle> (), VACUUMSYSTEM_STATE_IDLE);
+			addState (std::make_shared<CStateVacuumSystem_vacuum_pump_on> (), VACUUMSYSTEM_STATE_VACUUM_PUMP_ON);
+			addState (std::make_shared<CStateVacuumSystem_error> (), VACUUMSYSTEM_STATE_ERROR);
+			addState (std::make_shared<CStateVacuumSystem_fault> (), VACUUMSYSTEM_STATE_FAULT);
+			
+			// a throwing state stops the pump and closes the valves in the fault state
+			setFaultState (VACUUMSYSTEM_STATE_FAULT);
 			
-			//register signal
-			auto pSignalInitVacuumSystem = registerSignal ("initvacuumsystem", 4, 1000);
-			pSignalInitVacuumSystem->addInt32Parameter ("pressurethresholdvacuumoffinmbar", 0);
-			pSignalInitVacuumSystem->addBoolResult ("success", false);
+			//register signal, a registration out of order against the VACUUMSYSTEM_SIGNAL_* IDs fails the initialization
+			auto pSignalInitVacuumSystem = registerSignal ("initvacuumsystem", 4, 1000, VACUUMSYSTEM_SIGNAL_INITVACUUMSYSTEM);
+			pSignalInitVacuumSystem->addInt32Parameter ("pressurethresholdvacuumoffinmbar", 0, SIGNAL_INITVACUUMSYSTEM_PARAM_PRESSURETHRESHOLDINMBAR);
+			pSignalInitVacuumSystem->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000);
-			pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false);
-			pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false);
-			pSignalToggleValves->addBoolResult ("success", false);
+			auto pSignalToggleValves = registerSignal ("togglevalves", 4, 1000, VACUUMSYSTEM_SIGNAL_TOGGLEVALVES);
+			pSignalToggleValves->addBoolParameter ("toggle_lower_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_upper_gas_flow_circuit_valve", false, SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_shielding_gas_valve", false, SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_chamber_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE);
+			pSignalToggleValves->addBoolParameter ("toggle_zAxis_vacuum_valve", false, SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE);
+			pSignalToggleValves->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalStartVacuumPump = registerSignal ("startvacuumpump", 4, 1000);
-			pSignalStartVacuumPump->addBoolResult ("success", false);
+			auto pSignalStartVacuumPump = registerSignal ("startvacuumpump", 4, 1000, VACUUMSYSTEM_SIGNAL_STARTVACUUMPUMP);
+			pSignalStartVacuumPump->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
-			auto pSignalTurnOffVacuumPump = registerSignal ("turnoffvacuumpump", 4, 1000);
-			pSignalTurnOffVacuumPump->addBoolResult ("success", false);
+			auto pSignalTurnOffVacuumPump = registerSignal ("turnoffvacuumpump", 4, 1000, VACUUMSYSTEM_SIGNAL_TURNOFFVACUUMPUMP);
+			pSignalTurnOffVacuumPump->addBoolResult ("success", false, SIGNAL_RESULT_SUCCESS);
 			
 			// register journal variables
 			registerIntegerValue("pressurethresholdvacuumoffinmbar", JOURNALVARIABLE_PRESSURE_THRESHOLD_VACUUM_OFF_IN_MBAR, 0, 1000);
@@ -141,7 +141,7 @@ class CTcpPacketHandler_Command_LockDoor : public CTcpPacketHandler_Buffered
 			bool bLockDoor = pEnvironment->readPayloadUint8(0);
 
 			auto pSignal = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OPENDOORS, "door", "lockdoor");
-			pSignal->setBoolParameter("doorstate", bLockDoor);
+			pSignal->setBoolParameter(SIGNAL_LOCKDOOR_PARAM_DOORSTATE, bLockDoor);
 			pSignal->triggerSignal();
 		}
 
@@ -215,41 +215,41 @@ class CTcpPacketHandler_TriggerSingleAxisMovement : public CTcpPacketHandler_Buf
 		if (nAxisID == AXISID_BUILDPLATFORM)
 		{
 			auto pSignalSingleAxisMovement = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUILDPLATFORM, "build_platform_axis", "triggersingleaxismovement");
-			pSignalSingleAxisMovement->setInt32Parameter("axisid", nAxisID);
-			pSignalSingleAxisMovement->setInt32Parameter("absoluterelative", nAbsoluteRelative);
-			pSignalSingleAxisMovement->setInt32Parameter("position", nTargetPositionInMicron);
-			pSignalSingleAxisMovement->setInt32Parameter("speed", nSpeedInMicronPerSecond);
-			pSignalSingleAxisMovement->setInt32Parameter("acceleration", nAccelerationInMicronPerSecondSquared);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID, nAxisID);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE, nAbsoluteRelative);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION, nTargetPositionInMicron);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED, nSpeedInMicronPerSecond);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION, nAccelerationInMicronPerSecondSquared);
 			pSignalSingleAxisMovement->triggerSignal();
 		}
 		else if (nAxisID == AXISID_POWDERRESERVOIR)
 		{
 			auto pSignalSingleAxisMovement = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_POWDERRESERVOIR, "powder_reservoir_axis", "triggersingleaxismovement");
-			pSignalSingleAxisMovement->setInt32Parameter("axisid", nAxisID);
-			pSignalSingleAxisMovement->setInt32Parameter("absoluterelative", nAbsoluteRelative);
-			pSignalSingleAxisMovement->setInt32Parameter("position", nTargetPositionInMicron);
-			pSignalSingleAxisMovement->setInt32Parameter("speed", nSpeedInMicronPerSecond);
-			pSignalSingleAxisMovement->setInt32Parameter("acceleration", nAccelerationInMicronPerSecondSquared);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID, nAxisID);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE, nAbsoluteRelative);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION, nTargetPositionInMicron);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED, nSpeedInMicronPerSecond);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION, nAccelerationInMicronPerSecondSquared);
 			pSignalSingleAxisMovement->triggerSignal();
 		}
 		else if (nAxisID == AXISID_RECOATERPOWDERBELT)
 		{
 			auto pSignalSingleAxisMovement = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_RECOATERPOWDERBELT, "recoater_axes", "triggersingleaxismovement");
-			pSignalSingleAxisMovement->setInt32Parameter("axisid", nAxisID);
-			pSignalSingleAxisMovement->setInt32Parameter("absoluterelative", nAbsoluteRelative);
-			pSignalSingleAxisMovement->setInt32Parameter("position", nTargetPositionInMicron);
-			pSignalSingleAxisMovement->setInt32Parameter("speed", nSpeedInMicronPerSecond);
-			pSignalSingleAxisMovement->setInt32Parameter("acceleration", nAccelerationInMicronPerSecondSquared);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID, nAxisID);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE, nAbsoluteRelative);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION, nTargetPositionInMicron);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED, nSpeedInMicronPerSecond);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION, nAccelerationInMicronPerSecondSquared);
 			pSignalSingleAxisMovement->triggerSignal();
 		}
 		else if (nAxisID == AXISID_RECOATELINEAR)
 		{
 			auto pSignalSingleAxisMovement = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_RECOATELINEAR, "recoater_axes", "triggersingleaxismovement");
-			pSignalSingleAxisMovement->setInt32Parameter("axisid", nAxisID);
-			pSignalSingleAxisMovement->setInt32Parameter("absoluterelative", nAbsoluteRelative);
-			pSignalSingleAxisMovement->setInt32Parameter("position", nTargetPositionInMicron);
-			pSignalSingleAxisMovement->setInt32Parameter("speed", nSpeedInMicronPerSecond);
-			pSignalSingleAxisMovement->setInt32Parameter("acceleration", nAccelerationInMicronPerSecondSquared);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_AXISID, nAxisID);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ABSOLUTERELATIVE, nAbsoluteRelative);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_POSITION, nTargetPositionInMicron);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_SPEED, nSpeedInMicronPerSecond);
+			pSignalSingleAxisMovement->setInt32Parameter(SIGNAL_AXISMOVEMENT_PARAM_ACCELERATION, nAccelerationInMicronPerSecondSquared);
 			pSignalSingleAxisMovement->triggerSignal();
 		}
 		
@@ -299,25 +299,25 @@ class CTcpPacketHandler_ReferenceAxis : public CTcpPacketHandler_Buffered
 		if (bReferencePlatform)
 		{
 			auto pSignalReferencePlatformAxis = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUILDPLATFORM, "build_platform_axis", "referenceaxis");
-			pSignalReferencePlatformAxis->setBoolParameter("reference_platform", bReferencePlatform);
+			pSignalReferencePlatformAxis->setBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_PLATFORM, bReferencePlatform);
 			pSignalReferencePlatformAxis->triggerSignal();
 		}
 		if (bReferencePowderreservoir)
 		{
 			auto pSignalReferencePowderreservoirAxis = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_POWDERRESERVOIR, "powder_reservoir_axis", "referenceaxis");
-			pSignalReferencePowderreservoirAxis->setBoolParameter("reference_powderreservoir", bReferencePowderreservoir);
+			pSignalReferencePowderreservoirAxis->setBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_POWDERRESERVOIR, bReferencePowderreservoir);
 			pSignalReferencePowderreservoirAxis->triggerSignal();
 		}
 		if (bReferenceRecoateraxisPowder)
 		{
 			auto pSignalReferenceRecoateraxisPowder = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_RECOATERPOWDERBELT, "recoater_axes", "referenceaxis");
-			pSignalReferenceRecoateraxisPowder->setBoolParameter("reference_recoateraxis_powder", bReferenceRecoateraxisPowder);
+			pSignalReferenceRecoateraxisPowder->setBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISPOWDER, bReferenceRecoateraxisPowder);
 			pSignalReferenceRecoateraxisPowder->triggerSignal();
 		}
 		if (bReferenceRecoateraxisLinear)
 		{
 			auto pSignalReferenceRecoateraxisLinear = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_RECOATELINEAR, "recoater_axes", "referenceaxis");
-			pSignalReferenceRecoateraxisLinear->setBoolParameter("reference_recoateraxis_linear", bReferenceRecoateraxisLinear);
+			pSignalReferenceRecoateraxisLinear->setBoolParameter(SIGNAL_REFERENCEAXIS_PARAM_RECOATERAXISLINEAR, bReferenceRecoateraxisLinear);
 			pSignalReferenceRecoateraxisLinear->triggerSignal();
 		}
 	}
@@ -464,12 +464,12 @@ class CTcpPacketHandler_RecoaterDualAxisMovement : public CTcpPacketHandler_Buff
 		int32_t recoateraxespowderacceleration = pEnvironment->readPayloadInt32(20);
 				
 		auto pSignalRecoaterDualAxisMovement = pEnvironment->prepareSignal(1, "recoater_axes", "recoaterdualaxismovement");
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoateraxis_linear_start_position", recoateraxislinearstartposition);
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoateraxis_linear_target_position", recoateraxislineartargetposition);
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoateraxis_linear_speed", recoateraxislinearspeed);
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoateraxis_powder_speed", recoateraxispowderspeed);
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoater_axes_linear_acceleration", recoateraxeslinearacceleration);
-		pSignalRecoaterDualAxisMovement->setInt32Parameter ("recoater_axes_powder_acceleration", recoateraxespowderacceleration);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSTARTPOSITION, recoateraxislinearstartposition);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARTARGETPOSITION, recoateraxislineartargetposition);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARSPEED, recoateraxislinearspeed);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERSPEED, recoateraxispowderspeed);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_LINEARACCELERATION, recoateraxeslinearacceleration);
+		pSignalRecoaterDualAxisMovement->setInt32Parameter (SIGNAL_DUALAXISMOVEMENT_PARAM_POWDERACCELERATION, recoateraxespowderacceleration);
 		pSignalRecoaterDualAxisMovement->triggerSignal();
 		/*auto pSignalSingleAxisMovement = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_RECOATELINEAR, "recoater_axes", "triggersingleaxismovement");
 		pSignalSingleAxisMovement->setInt32Parameter("axisid", 4);
@@ -519,27 +519,27 @@ class CTcpPacketHandler_Toggle_Valves : public CTcpPacketHandler_Buffered
 			bool toggle_zAxis_vacuum_valve = pEnvironment->readPayloadUint8(4);
 			
 			auto pSignalToggleValvesGasCirculation = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_GASCIRCULATION, "gascirculation", "togglevalves");
-			pSignalToggleValvesGasCirculation->setBoolParameter ("toggle_lower_gas_flow_circuit_valve", toggle_lower_gas_flow_circuit_valve);
-			pSignalToggleValvesGasCirculation->setBoolParameter ("toggle_upper_gas_flow_circuit_valve", toggle_upper_gas_flow_circuit_valve);
-			pSignalToggleValvesGasCirculation->setBoolParameter ("toggle_shielding_gas_valve", toggle_shielding_gas_valve);
-			pSignalToggleValvesGasCirculation->setBoolParameter ("toggle_chamber_vacuum_valve", toggle_chamber_vacuum_valve);
-			pSignalToggleValvesGasCirculation->setBoolParameter ("toggle_zAxis_vacuum_valve", toggle_zAxis_vacuum_valve);
+			pSignalToggleValvesGasCirculation->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE, toggle_lower_gas_flow_circuit_valve);
+			pSignalToggleValvesGasCirculation->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE, toggle_upper_gas_flow_circuit_valve);
+			pSignalToggleValvesGasCirculation->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE, toggle_shielding_gas_valve);
+			pSignalToggleValvesGasCirculation->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE, toggle_chamber_vacuum_valve);
+			pSignalToggleValvesGasCirculation->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE, toggle_zAxis_vacuum_valve);
 			pSignalToggleValvesGasCirculation->triggerSignal();
 
 			auto pSignalToggleValvesVacuumSystem = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_VACUUMPUMP, "vacuumsystem", "togglevalves");
-			pSignalToggleValvesVacuumSystem->setBoolParameter ("toggle_lower_gas_flow_circuit_valve", toggle_lower_gas_flow_circuit_valve);
-			pSignalToggleValvesVacuumSystem->setBoolParameter ("toggle_upper_gas_flow_circuit_valve", toggle_upper_gas_flow_circuit_valve);
-			pSignalToggleValvesVacuumSystem->setBoolParameter ("toggle_shielding_gas_valve", toggle_shielding_gas_valve);
-			pSignalToggleValvesVacuumSystem->setBoolParameter ("toggle_chamber_vacuum_valve", toggle_chamber_vacuum_valve);
-			pSignalToggleValvesVacuumSystem->setBoolParameter ("toggle_zAxis_vacuum_valve", toggle_zAxis_vacuum_valve);
+			pSignalToggleValvesVacuumSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE, toggle_lower_gas_flow_circuit_valve);
+			pSignalToggleValvesVacuumSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE, toggle_upper_gas_flow_circuit_valve);
+			pSignalToggleValvesVacuumSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE, toggle_shielding_gas_valve);
+			pSignalToggleValvesVacuumSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE, toggle_chamber_vacuum_valve);
+			pSignalToggleValvesVacuumSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE, toggle_zAxis_vacuum_valve);
 			pSignalToggleValvesVacuumSystem->triggerSignal();
 
 			auto pSignalToggleValvesShieldingGasSystem = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "togglevalves");
-			pSignalToggleValvesShieldingGasSystem->setBoolParameter ("toggle_lower_gas_flow_circuit_valve", toggle_lower_gas_flow_circuit_valve);
-			pSignalToggleValvesShieldingGasSystem->setBoolParameter ("toggle_upper_gas_flow_circuit_valve", toggle_upper_gas_flow_circuit_valve);
-			pSignalToggleValvesShieldingGasSystem->setBoolParameter ("toggle_shielding_gas_valve", toggle_shielding_gas_valve);
-			pSignalToggleValvesShieldingGasSystem->setBoolParameter ("toggle_chamber_vacuum_valve", toggle_chamber_vacuum_valve);
-			pSignalToggleValvesShieldingGasSystem->setBoolParameter ("toggle_zAxis_vacuum_valve", toggle_zAxis_vacuum_valve);
+			pSignalToggleValvesShieldingGasSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_LOWERGASFLOWCIRCUITVALVE, toggle_lower_gas_flow_circuit_valve);
+			pSignalToggleValvesShieldingGasSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_UPPERGASFLOWCIRCUITVALVE, toggle_upper_gas_flow_circuit_valve);
+			pSignalToggleValvesShieldingGasSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_SHIELDINGGASVALVE, toggle_shielding_gas_valve);
+			pSignalToggleValvesShieldingGasSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_CHAMBERVACUUMVALVE, toggle_chamber_vacuum_valve);
+			pSignalToggleValvesShieldingGasSystem->setBoolParameter (SIGNAL_TOGGLEVALVES_PARAM_ZAXISVACUUMVALVE, toggle_zAxis_vacuum_valve);
 			pSignalToggleValvesShieldingGasSystem->triggerSignal();
 
 		}
@@ -582,8 +582,8 @@ class CTcpPacketHandler_InitAtmosphereControl : public CTcpPacketHandler_Buffere
 			int o2_threshold_circulation_off_in_ppm = pEnvironment->readPayloadInt32(4);
 			
 			auto pSignalInitAtmosphereControl = pEnvironment->prepareSignal(1, "gascirculation", "initatmospherecontrol");
-			pSignalInitAtmosphereControl->setInt32Parameter ("o2thresholdcirculationoninppm", o2_threshold_circulation_on_in_ppm);
-			pSignalInitAtmosphereControl->setInt32Parameter ("o2thresholdcirculationoffinppm", o2_threshold_circulation_off_in_ppm);
+			pSignalInitAtmosphereControl->setInt32Parameter (SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDONINPPM, o2_threshold_circulation_on_in_ppm);
+			pSignalInitAtmosphereControl->setInt32Parameter (SIGNAL_INITATMOSPHERECONTROL_PARAM_O2THRESHOLDOFFINPPM, o2_threshold_circulation_off_in_ppm);
 			pSignalInitAtmosphereControl->triggerSignal();
 		}
 
@@ -624,7 +624,7 @@ class CTcpPacketHandler_StartGasFlow : public CTcpPacketHandler_Buffered
 			int setpoint_in_percent = pEnvironment->readPayloadInt32(0);
 			
 			auto pSignalStartGasFlow = pEnvironment->prepareSignal(1, "gascirculation", "startgasflow");
-			pSignalStartGasFlow->setInt32Parameter ("setpointinpercent", setpoint_in_percent);
+			pSignalStartGasFlow->setInt32Parameter (SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT, setpoint_in_percent);
 			pSignalStartGasFlow->triggerSignal();
 		}
 
@@ -665,7 +665,7 @@ class CTcpPacketHandler_UpdateGasFlowSetpoint : public CTcpPacketHandler_Buffere
 			int setpoint_in_percent = pEnvironment->readPayloadInt32(0);
 			
 			auto pSignalUpdateGasFlowSetpoint = pEnvironment->prepareSignal(1, "gascirculation", "updategasflowsetpoint");
-			pSignalUpdateGasFlowSetpoint->setInt32Parameter ("setpointinpercent", setpoint_in_percent);
+			pSignalUpdateGasFlowSetpoint->setInt32Parameter (SIGNAL_GASFLOWSETPOINT_PARAM_SETPOINTINPERCENT, setpoint_in_percent);
 			pSignalUpdateGasFlowSetpoint->triggerSignal();
 		}
 
@@ -745,7 +745,7 @@ class CTcpPacketHandler_InitVacuumSystem : public CTcpPacketHandler_Buffered
 			int pressure_threshold_vacuum_off_in_mbar = pEnvironment->readPayloadInt32(0);
 			
 			auto pSignalInitVacuumSystem = pEnvironment->prepareSignal(1, "vacuumsystem", "initvacuumsystem");
-			pSignalInitVacuumSystem->setInt32Parameter ("pressurethresholdvacuumoffinmbar", pressure_threshold_vacuum_off_in_mbar);
+			pSignalInitVacuumSystem->setInt32Parameter (SIGNAL_INITVACUUMSYSTEM_PARAM_PRESSURETHRESHOLDINMBAR, pressure_threshold_vacuum_off_in_mbar);
 			pSignalInitVacuumSystem->triggerSignal();
 		}
 
@@ -927,25 +927,25 @@ class CTcpPacketHandler_UpdateControllerPidParameters : public CTcpPacketHandler
 		if (controller_ID == CONTROLLERID_BUIDLPLATETEMPCONTROL)
 		{
 			auto pSignalUpdateHeaterControllerPidParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUIDLPLATETEMPCONTROL, "heater", "updatecontrollerparameters");
-			pSignalUpdateHeaterControllerPidParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("derivativetime", derivativetime);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("integrationtime", integrationtime);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("gain", gain);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("filtertime", filtertime);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("maxout", maxout);
-			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter ("minout", minout);
+			pSignalUpdateHeaterControllerPidParameters->setBoolParameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME, derivativetime);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME, integrationtime);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN, gain);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME, filtertime);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT, maxout);
+			pSignalUpdateHeaterControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT, minout);
 			pSignalUpdateHeaterControllerPidParameters->triggerSignal();
 		}
 		else if (controller_ID == CONTROLLERID_OXYGENCONTROL)
 		{
 			auto pSignalUpdateOxygenControllerPidParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "updatecontrollerparameters");
-			pSignalUpdateOxygenControllerPidParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("derivativetime", derivativetime);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("integrationtime", integrationtime);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("gain", gain);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("filtertime", filtertime);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("maxout", maxout);
-			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter ("minout", minout);
+			pSignalUpdateOxygenControllerPidParameters->setBoolParameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_DERIVATIVETIME, derivativetime);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_INTEGRATIONTIME, integrationtime);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_GAIN, gain);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_FILTERTIME, filtertime);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_MAXOUT, maxout);
+			pSignalUpdateOxygenControllerPidParameters->setInt32Parameter (SIGNAL_CONTROLLERPARAMETERS_PARAM_MINOUT, minout);
 			pSignalUpdateOxygenControllerPidParameters->triggerSignal();
 		}
 	}
@@ -997,23 +997,23 @@ class CTcpPacketHandler_UpdateControllerTunerParameters : public CTcpPacketHandl
 		if (controller_ID == CONTROLLERID_BUIDLPLATETEMPCONTROL)
 		{
 			auto pSignalUpdateHeaterControllerTunerParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUIDLPLATETEMPCONTROL, "heater", "updatecontrollertunerparameters");
-			pSignalUpdateHeaterControllerTunerParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter ("stepheight", stepheight);
-			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter ("maxactvalue", maxactvalue);
-			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter ("minactvalue", minactvalue);
-			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter ("systemsettlingtime", systemsettlingtime);
-			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter ("maxtuningtime", maxtuningtime);
+			pSignalUpdateHeaterControllerTunerParameters->setBoolParameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT, stepheight);
+			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE, maxactvalue);
+			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE, minactvalue);
+			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME, systemsettlingtime);
+			pSignalUpdateHeaterControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME, maxtuningtime);
 			pSignalUpdateHeaterControllerTunerParameters->triggerSignal();
 		}
 		else if (controller_ID == CONTROLLERID_OXYGENCONTROL)
 		{
 			auto pSignalUpdateOxygenControllerTunerParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "updatecontrollertunerparameters");
-			pSignalUpdateOxygenControllerTunerParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter ("stepheight", stepheight);
-			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter ("maxactvalue", maxactvalue);
-			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter ("minactvalue", minactvalue);
-			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter ("systemsettlingtime", systemsettlingtime);
-			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter ("maxtuningtime", maxtuningtime);
+			pSignalUpdateOxygenControllerTunerParameters->setBoolParameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_STEPHEIGHT, stepheight);
+			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXACTVALUE, maxactvalue);
+			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MINACTVALUE, minactvalue);
+			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_SYSTEMSETTLINGTIME, systemsettlingtime);
+			pSignalUpdateOxygenControllerTunerParameters->setInt32Parameter (SIGNAL_CONTROLLERTUNERPARAMETERS_PARAM_MAXTUNINGTIME, maxtuningtime);
 			pSignalUpdateOxygenControllerTunerParameters->triggerSignal();
 		}
 	}
@@ -1062,21 +1062,21 @@ class CTcpPacketHandler_UpdateControllerPwmParameters : public CTcpPacketHandler
 		if (controller_ID == CONTROLLERID_BUIDLPLATETEMPCONTROL)
 		{
 			auto pSignalUpdateHeaterControllerPwmParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUIDLPLATETEMPCONTROL, "heater", "updatecontrollerpwmparameters");
-			pSignalUpdateHeaterControllerPwmParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter ("dutycycle", dutycycle);
-			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter ("period", period);
-			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter ("maxFrequency", maxFrequency);
-			pSignalUpdateHeaterControllerPwmParameters->setBoolParameter ("mode", mode);
+			pSignalUpdateHeaterControllerPwmParameters->setBoolParameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE, dutycycle);
+			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD, period);
+			pSignalUpdateHeaterControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY, maxFrequency);
+			pSignalUpdateHeaterControllerPwmParameters->setBoolParameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE, mode);
 			pSignalUpdateHeaterControllerPwmParameters->triggerSignal();
 		}
 		else if (controller_ID == CONTROLLERID_OXYGENCONTROL)
 		{
 			auto pSignalUpdateOxygenControllerPwmParameters = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "updatecontrollerpwmparameters");
-			pSignalUpdateOxygenControllerPwmParameters->setBoolParameter ("isinit", isinit);
-			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter ("dutycycle", dutycycle);
-			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter ("period", period);
-			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter ("maxFrequency", maxFrequency);
-			pSignalUpdateOxygenControllerPwmParameters->setBoolParameter ("mode", mode);
+			pSignalUpdateOxygenControllerPwmParameters->setBoolParameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_ISINIT, isinit);
+			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_DUTYCYCLE, dutycycle);
+			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_PERIOD, period);
+			pSignalUpdateOxygenControllerPwmParameters->setInt32Parameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MAXFREQUENCY, maxFrequency);
+			pSignalUpdateOxygenControllerPwmParameters->setBoolParameter (SIGNAL_CONTROLLERPWMPARAMETERS_PARAM_MODE, mode);
 			pSignalUpdateOxygenControllerPwmParameters->triggerSignal();
 		}
 	}
@@ -1128,21 +1128,21 @@ class CTcpPacketHandler_AutoTuneController : public CTcpPacketHandler_Buffered
 		if (controller_ID == CONTROLLERID_BUIDLPLATETEMPCONTROL)
 		{
 			auto pSignalAutoTuneHeaterController = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUIDLPLATETEMPCONTROL, "heater", "autotunecontroller");
-			pSignalAutoTuneHeaterController->setInt32Parameter ("stepheight", stepheight);
-			pSignalAutoTuneHeaterController->setInt32Parameter ("maxactvalue", maxactvalue);
-			pSignalAutoTuneHeaterController->setInt32Parameter ("minactvalue", minactvalue);
-			pSignalAutoTuneHeaterController->setInt32Parameter ("systemsettlingtime", systemsettlingtime);
-			pSignalAutoTuneHeaterController->setInt32Parameter ("maxtuningtime", maxtuningtime);
+			pSignalAutoTuneHeaterController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT, stepheight);
+			pSignalAutoTuneHeaterController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE, maxactvalue);
+			pSignalAutoTuneHeaterController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE, minactvalue);
+			pSignalAutoTuneHeaterController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME, systemsettlingtime);
+			pSignalAutoTuneHeaterController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME, maxtuningtime);
 			pSignalAutoTuneHeaterController->triggerSignal();
 		}
 		else if (controller_ID == CONTROLLERID_OXYGENCONTROL)
 		{
 			auto pSignalAutoTuneOxygenController = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "autotunecontroller");
-			pSignalAutoTuneOxygenController->setInt32Parameter ("stepheight", stepheight);
-			pSignalAutoTuneOxygenController->setInt32Parameter ("maxactvalue", maxactvalue);
-			pSignalAutoTuneOxygenController->setInt32Parameter ("minactvalue", minactvalue);
-			pSignalAutoTuneOxygenController->setInt32Parameter ("systemsettlingtime", systemsettlingtime);
-			pSignalAutoTuneOxygenController->setInt32Parameter ("maxtuningtime", maxtuningtime);
+			pSignalAutoTuneOxygenController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_STEPHEIGHT, stepheight);
+			pSignalAutoTuneOxygenController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXACTVALUE, maxactvalue);
+			pSignalAutoTuneOxygenController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MINACTVALUE, minactvalue);
+			pSignalAutoTuneOxygenController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_SYSTEMSETTLINGTIME, systemsettlingtime);
+			pSignalAutoTuneOxygenController->setInt32Parameter (SIGNAL_AUTOTUNECONTROLLER_PARAM_MAXTUNINGTIME, maxtuningtime);
 			pSignalAutoTuneOxygenController->triggerSignal();
 		}
 	}
@@ -1188,15 +1188,15 @@ class CTcpPacketHandler_UpdateControllerSetpoint : public CTcpPacketHandler_Buff
 		if (controller_ID == CONTROLLERID_BUIDLPLATETEMPCONTROL)
 		{
 			auto pSignalUpdateHeaterControllerSetpoint = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_BUIDLPLATETEMPCONTROL, "heater", "updatecontrollersetpoint");
-			pSignalUpdateHeaterControllerSetpoint->setBoolParameter ("isinit", isinit);
-			pSignalUpdateHeaterControllerSetpoint->setInt32Parameter ("setvalue", setvalue);
+			pSignalUpdateHeaterControllerSetpoint->setBoolParameter (SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT, isinit);
+			pSignalUpdateHeaterControllerSetpoint->setInt32Parameter (SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE, setvalue);
 			pSignalUpdateHeaterControllerSetpoint->triggerSignal();
 		}
 		else if (controller_ID == CONTROLLERID_OXYGENCONTROL)
 		{
 			auto pSignalUpdateOxygenControllerSetpoint = pEnvironment->prepareSignal(CUSTOMCOMMAND_SIGNALSLOT_OXYGENCONTROL, "oxygen", "updatecontrollersetpoint");
-			pSignalUpdateOxygenControllerSetpoint->setBoolParameter ("isinit", isinit);
-			pSignalUpdateOxygenControllerSetpoint->setInt32Parameter ("setvalue", setvalue);
+			pSignalUpdateOxygenControllerSetpoint->setBoolParameter (SIGNAL_CONTROLLERSETPOINT_PARAM_ISINIT, isinit);
+			pSignalUpdateOxygenControllerSetpoint->setInt32Parameter (SIGNAL_CONTROLLERSETPOINT_PARAM_SETVALUE, setvalue);
 			pSignalUpdateOxygenControllerSetpoint->triggerSignal();
 		}
 	}
@@ -33,6 +33,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Application.hpp"
 #include "Utils.hpp"
 
+#include <exception>
+
 namespace BuRCPP
 {
 	
@@ -40,6 +42,7 @@ namespace BuRCPP
 
 	
 	CApplication::CApplication ()
+		: m_nProfileSectionCycle (0), m_nProfileSectionModules (0), m_nProfileSectionServer (0), m_nProfileSectionListHandler (0), m_nFaultCount (0), m_LastFaultCode (eErrorCode::UNKNOWN)
 	{
 		m_pSystemInfo = std::make_shared<CSystemInfo> ();
 	}
@@ -55,6 +58,21 @@ namespace BuRCPP
 		m_pJournal = std::make_shared<CJournal> (65536, m_pSystemInfo);
 		
 		m_pModuleHandler = std::make_shared<CModuleHandler> (m_pJournal);
+		m_pModuleHandler->setFaultReporter (this);
+		
+		m_pCycleProfiler = std::make_shared<CCycleProfiler> (m_pJournal, m_pSystemInfo, JOURNALGROUP_CYCLEPROFILER, "cycleprofiler");
+		m_nProfileSectionCycle = m_pCycleProfiler->addSection ("cycle");
+		m_nProfileSectionModules = m_pCycleProfiler->addSection ("modules");
+		m_nProfileSectionServer = m_pCycleProfiler->addSection ("server");
+		m_nProfileSectionListHandler = m_pCycleProfiler->addSection ("listhandler");
+		
+		setCycleTimeBudget ("cycle", APPLICATION_BUDGET_CYCLE);
+		setCycleTimeBudget ("modules", APPLICATION_BUDGET_MODULES);
+		setCycleTimeBudget ("server", APPLICATION_BUDGET_SERVER);
+		setCycleTimeBudget ("listhandler", APPLICATION_BUDGET_LISTHANDLER);
+		
+		// Incoming TCP traffic is parsed into freshly allocated packets, only the server section may allocate
+		m_pCycleProfiler->setAllocationCheckExempt ("server", true);
 	
 		auto pPacketRegistry = m_pTcpServer->getPacketRegistry ();
 	
@@ -63,14 +81,20 @@ namespace BuRCPP
 		
 		registerHandlers ();
 		
+#ifndef BURCPP_HOSTBUILD
 		fbTcpServer = (TcpServer_typ*) m_pTcpServer->getFunctionBlockServer ();
 		fbTcpOpen = (TcpOpen_typ*) m_pTcpServer->getFunctionBlockOpen ();
 		fbTcpClose = (TcpClose_typ*) m_pTcpServer->getFunctionBlockClose ();
+#endif
 	
 		m_pJournal->prepareJournal ();
 
 		m_pTcpServer->startServer ();
 		
+#ifdef HEAPMONITOR_ALLOCATIONCHECK
+		m_pCycleProfiler->setAllocationCheck (true);
+#endif
+		
 	}
 	
 	void CApplication::handleCyclic ()
@@ -79,47 +103,92 @@ namespace BuRCPP
 		// Update system information, for example System Time Counter
 		m_pSystemInfo->handleCyclic ();
 		
+		uint64_t nCycleStartTimestamp = m_pCycleProfiler->beginCycle ();
+		uint64_t nTimestamp = nCycleStartTimestamp;
+		
 		// Handle all states
-		for (auto iter : m_StateHandlers) {
-			auto pStateHandler = iter.second;
-			
-			CState * pCurrentState = pStateHandler->getCurrentState ();
-			if (pCurrentState != nullptr) {
+		for (auto & iter : m_StateHandlers) {
+			CStateHandler * pStateHandler = iter.second.get ();
 			
-				std::string sName = pCurrentState->getName();
-			
-				CEnvironment environment (pStateHandler.get ());
-				pCurrentState->Execute (&environment);
-			
-				CState * pNextState = environment.getNextState ();
-				if (pNextState == nullptr)
-					throw CException (eErrorCode::NEXTSTATEHASNOTBEENSET, "next state has not been set!");
-			
-			
-				pStateHandler->setCurrentState (pNextState);				
-				
-				pStateHandler->writeDebugInformation ();
+			// State handlers with a cycle divider skip the cycles in between
+			if (!pStateHandler->advanceCycleSchedule ())
+				continue;
 			
+			// An exception faults only the throwing state handler, all others and the server keep running
+			if (!pStateHandler->isHalted ()) {
+				try {
+					executeStateHandler (pStateHandler);
+				}
+				catch (CException & Exception) {
+					handleStateHandlerFault (pStateHandler, Exception.getCode (), Exception.getMessage ());
+				}
+				catch (std::exception & StdException) {
+					handleStateHandlerFault (pStateHandler, eErrorCode::UNHANDLEDEXCEPTION, StdException.what ());
+				}
+				catch (...) {
+					handleStateHandlerFault (pStateHandler, eErrorCode::UNHANDLEDEXCEPTION, "<untyped exception>");
+				}
 			}
 			
-			pStateHandler->releaseExpiredSignals ();
-			
+			nTimestamp = m_pCycleProfiler->recordSection (pStateHandler->getProfileSectionIndex (), nTimestamp);
 			
 		}
 		
 		m_pModuleHandler->handleModules ();
+		nTimestamp = m_pCycleProfiler->recordSection (m_nProfileSectionModules, nTimestamp);
 	
 		
 		// Handle TCP Communication
 		if (m_pTcpServer.get () != nullptr) {		
-			m_pTcpServer->handleServer ();				
+			executeContained (m_pTcpServer.get (), &CTcpServer::handleServer, "tcpserver");
 		}
+		nTimestamp = m_pCycleProfiler->recordSection (m_nProfileSectionServer, nTimestamp);
 	
 		// Handle List Execution
 		if (m_pListHandler.get () != nullptr) {
-			m_pListHandler->handleCyclic ();
+			executeContained (m_pListHandler.get (), &CTcpListHandler::handleCyclic, "listhandler");
 		}
+		nTimestamp = m_pCycleProfiler->recordSection (m_nProfileSectionListHandler, nTimestamp);
+		
+		m_pCycleProfiler->recordCycle (m_nProfileSectionCycle, nCycleStartTimestamp);
+		m_pCycleProfiler->finishCycle ();
+		
+	}
+	
+	void CApplication::executeStateHandler (CStateHandler * pStateHandler)
+	{
+		CState * pCurrentState = pStateHandler->getCurrentState ();
+		if (pCurrentState != nullptr) {
+		
+			CEnvironment environment (pStateHandler);
+			pCurrentState->Execute (&environment);
+		
+			CState * pNextState = environment.getNextState ();
+			if (pNextState == nullptr)
+				throw CException (eErrorCode::NEXTSTATEHASNOTBEENSET, "next state has not been set!");
+		
+		
+			pStateHandler->setCurrentState (pNextState);				
+			
+			pStateHandler->writeDebugInformation ();
+		
+		}
+		
+		pStateHandler->releaseExpiredSignals ();
+	}
+	
+	void CApplication::handleStateHandlerFault (CStateHandler * pStateHandler, eErrorCode FaultCode, const std::string & sFaultMessage)
+	{
+		reportFault (pStateHandler->getName (), FaultCode, sFaultMessage);
 		
+		pStateHandler->setFault (FaultCode, sFaultMessage);
+	}
+	
+	void CApplication::reportFault (const std::string & sSource, eErrorCode FaultCode, const std::string & sFaultMessage)
+	{
+		m_nFaultCount++;
+		m_LastFaultCode = FaultCode;
+		m_sLastFaultMessage = sSource + ": " + sFaultMessage;
 	}
 
 		
@@ -131,7 +200,7 @@ namespace BuRCPP
 		m_pTcpServer->registerPacketHandler (pPacketHandler);
 	}
 		
-	void CApplication::registerStateHandler (std::shared_ptr<CStateHandler> pStateHandler)
+	void CApplication::registerStateHandler (std::shared_ptr<CStateHandler> pStateHandler, uint32_t nCycleDivider)
 	{
 		if (pStateHandler.get () == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "state handler is null.");
@@ -144,8 +213,15 @@ namespace BuRCPP
 		if (iIter != m_StateHandlers.end ())
 			throw CException (eErrorCode::INVALIDNAME, "duplicate state handler registration: " + sName);
 		
+		uint32_t nCyclePhase = m_StateHandlerCycleDividerUsage[nCycleDivider];
+		pStateHandler->setCycleSchedule (nCycleDivider, nCyclePhase);
+		m_StateHandlerCycleDividerUsage[nCycleDivider] = nCyclePhase + 1;
+		
 		pStateHandler->onRegister ();
 		
+		pStateHandler->setProfileSectionIndex (m_pCycleProfiler->addSection ("statemachine_" + sName));
+		setCycleTimeBudget ("statemachine_" + sName, APPLICATION_BUDGET_STATEHANDLER);
+		
 		m_StateHandlers.insert (std::make_pair (sName, pStateHandler));
 	}
 	
@@ -180,9 +256,39 @@ namespace BuRCPP
 		return m_pModuleHandler;
 	}
 
-	void CApplication::registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID)
+	void CApplication::registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID, uint32_t nCycleDivider)
+	{
+		m_pModuleHandler->registerModule (pModule, nJournalGroupID, nCycleDivider);
+	}
+	
+	CCycleProfiler * CApplication::getCycleProfiler ()
+	{
+		return m_pCycleProfiler.get ();
+	}
+	
+	void CApplication::setCycleTimeBudget (const std::string & sSectionName, uint32_t nBudgetInMicroseconds)
+	{
+		m_pCycleProfiler->setBudget (sSectionName, nBudgetInMicroseconds);
+	}
+	
+	uint32_t CApplication::getOverBudgetCount ()
+	{
+		return m_pCycleProfiler->getOverBudgetCount ();
+	}
+	
+	uint32_t CApplication::getFaultCount ()
+	{
+		return m_nFaultCount;
+	}
+	
+	eErrorCode CApplication::getLastFaultCode ()
+	{
+		return m_LastFaultCode;
+	}
+	
+	std::string CApplication::getLastFaultMessage ()
 	{
-		m_pModuleHandler->registerModule (pModule, nJournalGroupID);
+		return m_sLastFaultMessage;
 	}
 
 	
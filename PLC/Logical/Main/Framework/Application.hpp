@@ -39,12 +39,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TcpListHandler.hpp"
 #include "Journal.hpp"
 #include "SystemInfo.hpp"
+#include "CycleProfiler.hpp"
 
 #include <map>
 
+#define JOURNALGROUP_CYCLEPROFILER 0xF00
+
+// Cycle time budgets in microseconds. The whole cycle has to fit into the 4 ms task class cycle, the
+// sections share it. Every state handler gets its own budget of APPLICATION_BUDGET_STATEHANDLER.
+#define APPLICATION_BUDGET_CYCLE 4000
+#define APPLICATION_BUDGET_STATEHANDLER 200
+#define APPLICATION_BUDGET_MODULES 500
+#define APPLICATION_BUDGET_SERVER 1000
+#define APPLICATION_BUDGET_LISTHANDLER 500
+
 namespace BuRCPP {
 	
-	class CApplication : public CSignalHandlerRegistry
+	class CApplication : public CSignalHandlerRegistry, public CFaultReporter
 	{	
 		private:
 		std::shared_ptr<CTcpServer> m_pTcpServer;
@@ -52,7 +63,39 @@ namespace BuRCPP {
 		std::shared_ptr<CJournal> m_pJournal;
 		std::shared_ptr<CModuleHandler> m_pModuleHandler;
 		std::shared_ptr<CSystemInfo> m_pSystemInfo;
+		std::shared_ptr<CCycleProfiler> m_pCycleProfiler;
 		std::map<std::string, std::shared_ptr<CStateHandler>> m_StateHandlers;
+		std::map<uint32_t, uint32_t> m_StateHandlerCycleDividerUsage;
+		
+		uint32_t m_nProfileSectionCycle;
+		uint32_t m_nProfileSectionModules;
+		uint32_t m_nProfileSectionServer;
+		uint32_t m_nProfileSectionListHandler;
+		
+		uint32_t m_nFaultCount;
+		eErrorCode m_LastFaultCode;
+		std::string m_sLastFaultMessage;
+		
+		void executeStateHandler (CStateHandler * pStateHandler);
+		void handleStateHandlerFault (CStateHandler * pStateHandler, eErrorCode FaultCode, const std::string & sFaultMessage);
+		
+		// Runs the cyclic method of the server or the list handler, an exception is reported as fault of pSource
+		template<typename T> void executeContained (T * pObject, void (T::*pMethod) (), const char * pSource)
+		{
+			try {
+				(pObject->*pMethod) ();
+			}
+			catch (CException & Exception) {
+				reportFault (pSource, Exception.getCode (), Exception.getMessage ());
+			}
+			catch (std::exception & StdException) {
+				reportFault (pSource, eErrorCode::UNHANDLEDEXCEPTION, StdException.what ());
+			}
+			catch (...) {
+				reportFault (pSource, eErrorCode::UNHANDLEDEXCEPTION, "<untyped exception>");
+			}
+		}
+		
 		public:
 		
 		CApplication ();
@@ -62,7 +105,7 @@ namespace BuRCPP {
 		void handleCyclic ();		
 		
 		void registerPacketHandler (std::shared_ptr<CTcpPacketHandler> pPacketHandler);
-		void registerStateHandler (std::shared_ptr<CStateHandler> pStateHandler);
+		void registerStateHandler (std::shared_ptr<CStateHandler> pStateHandler, uint32_t nCycleDivider = 1);
 		
 		CTcpListHandler * getListHandler ();
 		
@@ -74,7 +117,18 @@ namespace BuRCPP {
 		
 		std::shared_ptr<CModuleHandler> getModuleHandler ();
 		
-		void registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID);
+		void registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID, uint32_t nCycleDivider = 1);
+		
+		CCycleProfiler * getCycleProfiler ();
+		
+		void setCycleTimeBudget (const std::string & sSectionName, uint32_t nBudgetInMicroseconds);
+		uint32_t getOverBudgetCount ();
+		
+		// Faults of single state handlers, modules, the server or the list handler, which do not stop the application
+		virtual void reportFault (const std::string & sSource, eErrorCode FaultCode, const std::string & sFaultMessage) override;
+		uint32_t getFaultCount ();
+		eErrorCode getLastFaultCode ();
+		std::string getLastFaultMessage ();
 
 	};
 	
@@ -0,0 +1,317 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "CycleProfiler.hpp"
+
+namespace BuRCPP {
+
+
+	CCycleProfileSection::CCycleProfileSection (const std::string & sName, CJournal * pJournal, uint32_t nJournalGroupID, uint32_t nSectionIndex)
+		: m_sName (sName), m_nBudgetInMicroseconds (0), m_nTotalOverBudgetCount (0), m_bIsAllocationCheckExempt (false)
+	{
+		if (pJournal == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");
+		
+		uint32_t nBaseID = nSectionIndex << CYCLEPROFILER_ENTRYSHIFT;
+		m_MinimumHandle = pJournal->registerIntegerValue (sName + "_min", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_MIN, 0, UINT32_MAX);
+		m_AverageHandle = pJournal->registerIntegerValue (sName + "_avg", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_AVERAGE, 0, UINT32_MAX);
+		m_MaximumHandle = pJournal->registerIntegerValue (sName + "_max", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_MAX, 0, UINT32_MAX);
+		m_P99Handle = pJournal->registerIntegerValue (sName + "_p99", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_P99, 0, UINT32_MAX);
+		m_BudgetHandle = pJournal->registerIntegerValue (sName + "_budget", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_BUDGET, 0, UINT32_MAX);
+		m_OverBudgetCountHandle = pJournal->registerIntegerValue (sName + "_overbudgetcount", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_OVERBUDGETCOUNT, 0, UINT32_MAX);
+		m_OverBudgetHandle = pJournal->registerBoolValue (sName + "_overbudget", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_OVERBUDGET);
+		m_AllocationsHandle = pJournal->registerIntegerValue (sName + "_allocations", nJournalGroupID, nBaseID | CYCLEPROFILER_ENTRY_ALLOCATIONS, 0, UINT32_MAX);
+		
+		resetWindow ();
+	}
+	
+	std::string CCycleProfileSection::getName ()
+	{
+		return m_sName;
+	}
+	
+	void CCycleProfileSection::setBudget (uint32_t nBudgetInMicroseconds)
+	{
+		m_nBudgetInMicroseconds = nBudgetInMicroseconds;
+	}
+	
+	uint32_t CCycleProfileSection::getBudget ()
+	{
+		return m_nBudgetInMicroseconds;
+	}
+	
+	uint32_t CCycleProfileSection::getTotalOverBudgetCount ()
+	{
+		return m_nTotalOverBudgetCount;
+	}
+	
+	void CCycleProfileSection::setAllocationCheckExempt (bool bIsExempt)
+	{
+		m_bIsAllocationCheckExempt = bIsExempt;
+	}
+	
+	bool CCycleProfileSection::isAllocationCheckExempt ()
+	{
+		return m_bIsAllocationCheckExempt;
+	}
+	
+	void CCycleProfileSection::resetWindow ()
+	{
+		m_nWindowCount = 0;
+		m_nWindowMinimum = UINT32_MAX;
+		m_nWindowMaximum = 0;
+		m_nWindowSum = 0;
+		m_nWindowOverBudgetCount = 0;
+		m_nWindowAllocationCount = 0;
+		
+		for (uint32_t nIndex = 0; nIndex < CYCLEPROFILER_BUCKETCOUNT; nIndex++)
+			m_Histogram[nIndex] = 0;
+	}
+	
+	void CCycleProfileSection::recordDuration (uint32_t nDurationInMicroseconds)
+	{
+		m_nWindowCount++;
+		m_nWindowSum += nDurationInMicroseconds;
+		
+		if (nDurationInMicroseconds < m_nWindowMinimum)
+			m_nWindowMinimum = nDurationInMicroseconds;
+		if (nDurationInMicroseconds > m_nWindowMaximum)
+			m_nWindowMaximum = nDurationInMicroseconds;
+		
+		uint32_t nBucket = nDurationInMicroseconds / CYCLEPROFILER_BUCKETWIDTH;
+		if (nBucket >= CYCLEPROFILER_BUCKETCOUNT)
+			nBucket = CYCLEPROFILER_BUCKETCOUNT - 1;
+		m_Histogram[nBucket]++;
+		
+		if ((m_nBudgetInMicroseconds > 0) && (nDurationInMicroseconds > m_nBudgetInMicroseconds)) {
+			m_nWindowOverBudgetCount++;
+			m_nTotalOverBudgetCount++;
+		}
+	}
+	
+	void CCycleProfileSection::recordAllocations (uint64_t nAllocationCount)
+	{
+		m_nWindowAllocationCount += nAllocationCount;
+	}
+	
+	uint32_t CCycleProfileSection::computePercentile (uint32_t nPercent)
+	{
+		if (m_nWindowCount == 0)
+			return 0;
+		
+		// Number of samples that must lie at or below the percentile, rounded up
+		uint64_t nTargetCount = ((uint64_t) m_nWindowCount * nPercent + 99) / 100;
+		uint64_t nCount = 0;
+		
+		for (uint32_t nBucket = 0; nBucket < CYCLEPROFILER_BUCKETCOUNT; nBucket++) {
+			nCount += m_Histogram[nBucket];
+			if (nCount >= nTargetCount) {
+				// Report the upper bucket bound, but never more than the observed maximum
+				uint32_t nUpperBound = (nBucket + 1) * CYCLEPROFILER_BUCKETWIDTH - 1;
+				if ((nBucket == CYCLEPROFILER_BUCKETCOUNT - 1) || (nUpperBound > m_nWindowMaximum))
+					return m_nWindowMaximum;
+				return nUpperBound;
+			}
+		}
+		
+		return m_nWindowMaximum;
+	}
+	
+	void CCycleProfileSection::publish (CJournal * pJournal)
+	{
+		if (m_nWindowCount > 0) {
+			pJournal->setIntegerValue (m_MinimumHandle, m_nWindowMinimum);
+			pJournal->setIntegerValue (m_AverageHandle, (int64_t) (m_nWindowSum / m_nWindowCount));
+			pJournal->setIntegerValue (m_MaximumHandle, m_nWindowMaximum);
+			pJournal->setIntegerValue (m_P99Handle, computePercentile (99));
+		}
+		
+		pJournal->setIntegerValue (m_BudgetHandle, m_nBudgetInMicroseconds);
+		pJournal->setIntegerValue (m_OverBudgetCountHandle, m_nTotalOverBudgetCount);
+		pJournal->setBoolValue (m_OverBudgetHandle, m_nWindowOverBudgetCount > 0);
+		pJournal->setIntegerValue (m_AllocationsHandle, (m_nWindowAllocationCount > UINT32_MAX) ? UINT32_MAX : (int64_t) m_nWindowAllocationCount);
+		
+		resetWindow ();
+	}
+	
+	
+	CCycleProfiler::CCycleProfiler (std::shared_ptr<CJournal> pJournal, std::shared_ptr<CSystemInfo> pSystemInfo, uint32_t nJournalGroupID, const std::string & sGroupName)
+		: m_pJournal (pJournal), m_pSystemInfo (pSystemInfo), m_nJournalGroupID (nJournalGroupID), m_nWindowCycles (CYCLEPROFILER_DEFAULTWINDOWCYCLES), m_nCycleCounter (0),
+		  m_bAllocationCheckIsEnabled (false), m_nCycleStartAllocationCount (0), m_nSectionStartAllocationCount (0)
+	{
+		if (pJournal.get () == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");
+		
+		if (pSystemInfo.get () == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid system info parameter");
+		
+		m_pJournal->registerGroup (nJournalGroupID, sGroupName);
+	}
+	
+	CCycleProfiler::~CCycleProfiler ()
+	{
+	}
+	
+	uint32_t CCycleProfiler::addSection (const std::string & sName)
+	{
+		if (sName.empty ())
+			throw CException (eErrorCode::INVALIDNAME, "cycle profile section has empty name.");
+		
+		for (auto & pSection : m_Sections) {
+			if (pSection->getName () == sName)
+				throw CException (eErrorCode::INVALIDNAME, "duplicate cycle profile section: " + sName);
+		}
+		
+		if (m_Sections.size () >= CYCLEPROFILER_MAXSECTIONS)
+			throw CException (eErrorCode::TOOMANYCYCLEPROFILESECTIONS, "too many cycle profile sections: " + sName);
+		
+		uint32_t nSectionIndex = (uint32_t) m_Sections.size ();
+		m_Sections.push_back (std::make_shared<CCycleProfileSection> (sName, m_pJournal.get (), m_nJournalGroupID, nSectionIndex));
+		
+		return nSectionIndex;
+	}
+	
+	uint32_t CCycleProfiler::findSection (const std::string & sName)
+	{
+		for (uint32_t nIndex = 0; nIndex < m_Sections.size (); nIndex++) {
+			if (m_Sections[nIndex]->getName () == sName)
+				return nIndex;
+		}
+		
+		throw CException (eErrorCode::CYCLEPROFILESECTIONNOTFOUND, "cycle profile section not found: " + sName);
+	}
+	
+	void CCycleProfiler::setBudget (const std::string & sName, uint32_t nBudgetInMicroseconds)
+	{
+		m_Sections[findSection (sName)]->setBudget (nBudgetInMicroseconds);
+	}
+	
+	uint32_t CCycleProfiler::getOverBudgetCount ()
+	{
+		uint32_t nOverBudgetCount = 0;
+		for (auto & pSection : m_Sections)
+			nOverBudgetCount += pSection->getTotalOverBudgetCount ();
+		
+		return nOverBudgetCount;
+	}
+	
+	void CCycleProfiler::setWindowCycles (uint32_t nWindowCycles)
+	{
+		if (nWindowCycles == 0)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid cycle profile window");
+		
+		m_nWindowCycles = nWindowCycles;
+	}
+	
+	uint32_t CCycleProfiler::getWindowCycles ()
+	{
+		return m_nWindowCycles;
+	}
+	
+	void CCycleProfiler::setAllocationCheck (bool bIsEnabled)
+	{
+		m_bAllocationCheckIsEnabled = bIsEnabled;
+	}
+	
+	bool CCycleProfiler::getAllocationCheck ()
+	{
+		return m_bAllocationCheckIsEnabled;
+	}
+	
+	void CCycleProfiler::setAllocationCheckExempt (const std::string & sName, bool bIsExempt)
+	{
+		m_Sections[findSection (sName)]->setAllocationCheckExempt (bIsExempt);
+	}
+	
+	uint64_t CCycleProfiler::getTimestamp ()
+	{
+		return m_pSystemInfo->getFreeRunningTimeInMicroseconds ();
+	}
+	
+	uint64_t CCycleProfiler::beginCycle ()
+	{
+		m_nCycleStartAllocationCount = CHeapMonitor::getAllocationCount ();
+		m_nSectionStartAllocationCount = m_nCycleStartAllocationCount;
+		
+		return m_pSystemInfo->getFreeRunningTimeInMicroseconds ();
+	}
+	
+	uint64_t CCycleProfiler::recordSection (uint32_t nSectionIndex, uint64_t nStartTimestamp)
+	{
+		uint64_t nTimestamp = m_pSystemInfo->getFreeRunningTimeInMicroseconds ();
+		uint64_t nAllocationCount = CHeapMonitor::getAllocationCount ();
+		uint64_t nSectionAllocationCount = nAllocationCount - m_nSectionStartAllocationCount;
+		m_nSectionStartAllocationCount = nAllocationCount;
+		
+		if (nSectionIndex < m_Sections.size ()) {
+			uint64_t nDuration = (nTimestamp >= nStartTimestamp) ? (nTimestamp - nStartTimestamp) : 0;
+			if (nDuration > UINT32_MAX)
+				nDuration = UINT32_MAX;
+			
+			CCycleProfileSection * pSection = m_Sections[nSectionIndex].get ();
+			pSection->recordDuration ((uint32_t) nDuration);
+			pSection->recordAllocations (nSectionAllocationCount);
+			
+			if (m_bAllocationCheckIsEnabled && (nSectionAllocationCount > 0) && !pSection->isAllocationCheckExempt ())
+				throw CException (eErrorCode::HEAPALLOCATIONINCYCLE, "heap allocation in cyclic section: " + pSection->getName ());
+		}
+		
+		return nTimestamp;
+	}
+	
+	void CCycleProfiler::recordCycle (uint32_t nSectionIndex, uint64_t nCycleStartTimestamp)
+	{
+		uint64_t nTimestamp = m_pSystemInfo->getFreeRunningTimeInMicroseconds ();
+		
+		if (nSectionIndex < m_Sections.size ()) {
+			uint64_t nDuration = (nTimestamp >= nCycleStartTimestamp) ? (nTimestamp - nCycleStartTimestamp) : 0;
+			if (nDuration > UINT32_MAX)
+				nDuration = UINT32_MAX;
+			
+			CCycleProfileSection * pSection = m_Sections[nSectionIndex].get ();
+			pSection->recordDuration ((uint32_t) nDuration);
+			pSection->recordAllocations (CHeapMonitor::getAllocationCount () - m_nCycleStartAllocationCount);
+		}
+	}
+	
+	void CCycleProfiler::finishCycle ()
+	{
+		m_nCycleCounter++;
+		if (m_nCycleCounter < m_nWindowCycles)
+			return;
+		
+		m_nCycleCounter = 0;
+		for (auto & pSection : m_Sections)
+			pSection->publish (m_pJournal.get ());
+	}
+	
+}
@@ -0,0 +1,165 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef __CYCLEPROFILER_HPP
+#define __CYCLEPROFILER_HPP
+
+#include "Framework.hpp"
+#include "Journal.hpp"
+#include "SystemInfo.hpp"
+#include "HeapMonitor.hpp"
+
+#include <vector>
+
+// Histogram buckets are CYCLEPROFILER_BUCKETWIDTH microseconds wide, the last bucket collects all longer durations.
+#define CYCLEPROFILER_BUCKETWIDTH 16
+#define CYCLEPROFILER_BUCKETCOUNT 128
+#define CYCLEPROFILER_DEFAULTWINDOWCYCLES 1000
+#define CYCLEPROFILER_MAXSECTIONS 64
+
+// Journal entry IDs of a section are (nSectionIndex << CYCLEPROFILER_ENTRYSHIFT) | CYCLEPROFILER_ENTRY_*
+#define CYCLEPROFILER_ENTRYSHIFT 4
+#define CYCLEPROFILER_ENTRY_MIN 1
+#define CYCLEPROFILER_ENTRY_AVERAGE 2
+#define CYCLEPROFILER_ENTRY_MAX 3
+#define CYCLEPROFILER_ENTRY_P99 4
+#define CYCLEPROFILER_ENTRY_BUDGET 5
+#define CYCLEPROFILER_ENTRY_OVERBUDGETCOUNT 6
+#define CYCLEPROFILER_ENTRY_OVERBUDGET 7
+#define CYCLEPROFILER_ENTRY_ALLOCATIONS 8
+
+namespace BuRCPP {
+	
+	class CCycleProfileSection {
+		private:
+		
+		std::string m_sName;
+		uint32_t m_nBudgetInMicroseconds;
+		
+		uint32_t m_nWindowCount;
+		uint32_t m_nWindowMinimum;
+		uint32_t m_nWindowMaximum;
+		uint64_t m_nWindowSum;
+		uint32_t m_nWindowOverBudgetCount;
+		uint32_t m_nTotalOverBudgetCount;
+		uint64_t m_nWindowAllocationCount;
+		bool m_bIsAllocationCheckExempt;
+		uint32_t m_Histogram[CYCLEPROFILER_BUCKETCOUNT];
+		
+		sJournalHandle m_MinimumHandle;
+		sJournalHandle m_AverageHandle;
+		sJournalHandle m_MaximumHandle;
+		sJournalHandle m_P99Handle;
+		sJournalHandle m_BudgetHandle;
+		sJournalHandle m_OverBudgetCountHandle;
+		sJournalHandle m_OverBudgetHandle;
+		sJournalHandle m_AllocationsHandle;
+		
+		void resetWindow ();
+		uint32_t computePercentile (uint32_t nPercent);
+		
+		public:
+		
+		CCycleProfileSection (const std::string & sName, CJournal * pJournal, uint32_t nJournalGroupID, uint32_t nSectionIndex);
+		
+		std::string getName ();
+		
+		void setBudget (uint32_t nBudgetInMicroseconds);
+		uint32_t getBudget ();
+		uint32_t getTotalOverBudgetCount ();
+		
+		void setAllocationCheckExempt (bool bIsExempt);
+		bool isAllocationCheckExempt ();
+		
+		void recordDuration (uint32_t nDurationInMicroseconds);
+		void recordAllocations (uint64_t nAllocationCount);
+		void publish (CJournal * pJournal);
+		
+	};
+	
+	
+	class CCycleProfiler {
+		private:
+		
+		std::shared_ptr<CJournal> m_pJournal;
+		std::shared_ptr<CSystemInfo> m_pSystemInfo;
+		uint32_t m_nJournalGroupID;
+		
+		std::vector<std::shared_ptr<CCycleProfileSection>> m_Sections;
+		
+		uint32_t m_nWindowCycles;
+		uint32_t m_nCycleCounter;
+		
+		bool m_bAllocationCheckIsEnabled;
+		uint64_t m_nCycleStartAllocationCount;
+		uint64_t m_nSectionStartAllocationCount;
+		
+		public:
+		
+		CCycleProfiler (std::shared_ptr<CJournal> pJournal, std::shared_ptr<CSystemInfo> pSystemInfo, uint32_t nJournalGroupID, const std::string & sGroupName);
+		virtual ~CCycleProfiler ();
+		
+		uint32_t addSection (const std::string & sName);
+		uint32_t findSection (const std::string & sName);
+		
+		void setBudget (const std::string & sName, uint32_t nBudgetInMicroseconds);
+		
+		// Number of section runs since the start that have exceeded their budget, summed over all sections.
+		uint32_t getOverBudgetCount ();
+		
+		void setWindowCycles (uint32_t nWindowCycles);
+		uint32_t getWindowCycles ();
+		
+		// With the allocation check enabled, any heap allocation in a section that is not exempt throws an exception.
+		void setAllocationCheck (bool bIsEnabled);
+		bool getAllocationCheck ();
+		void setAllocationCheckExempt (const std::string & sName, bool bIsExempt);
+		
+		uint64_t getTimestamp ();
+		
+		// Starts a new cycle and returns its start timestamp. Sections chained from it also count their heap allocations.
+		uint64_t beginCycle ();
+		
+		// Records the time since nStartTimestamp for the section and returns the current timestamp, so sections can be chained.
+		uint64_t recordSection (uint32_t nSectionIndex, uint64_t nStartTimestamp);
+		
+		// Records the whole cycle since beginCycle. It is not subject to the allocation check, its sections are.
+		void recordCycle (uint32_t nSectionIndex, uint64_t nCycleStartTimestamp);
+		
+		void finishCycle ();
+		
+	};
+
+
+}
+
+#endif //__CYCLEPROFILER_HPP
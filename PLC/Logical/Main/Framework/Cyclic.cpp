@@ -47,8 +47,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 unsigned long bur_heap_size = 1024 * 1024 * 64; 
 
 #include "Application.hpp"
+#include "Utils.hpp"
 
 std::shared_ptr<BuRCPP::CApplication> pGlobalApplication;
+uint32_t nReportedFaultCount = 0;
 
 
 
@@ -121,6 +123,15 @@ void _CYCLIC ProgramCyclic(void)
 			if (pGlobalApplication.get () != nullptr) {
 				pGlobalApplication->handleCyclic ();
 				
+				// Contained faults do not stop the application, only the latest fault is reported
+				if (pGlobalApplication->getFaultCount () != nReportedFaultCount) {
+					nReportedFaultCount = pGlobalApplication->getFaultCount ();
+					LastFault = (int32_t) pGlobalApplication->getLastFaultCode ();
+					BuRCPP::CUtils::writeStringVariable (pGlobalApplication->getLastFaultMessage (), LastFaultMessage, 256);
+				}
+				
+				CycleOverBudgetCount = pGlobalApplication->getOverBudgetCount ();
+				
 			}
 
 		} 
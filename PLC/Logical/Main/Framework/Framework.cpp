@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Utils.hpp"
 #include "Journal.hpp"
 #include <stdint.h>
+#include <exception>
 
 namespace BuRCPP {
 
@@ -57,7 +58,7 @@ namespace BuRCPP {
 			
 
 CModule::CModule (const std::string & sName)
-	: m_sName (sName), m_bJournalIsRegistering (false)
+	: m_sName (sName), m_bJournalIsRegistering (false), m_nCycleDivider (1), m_nCycleCountdown (0), m_bIsScheduledInCycle (true), m_bIsFaulted (false), m_FaultCode (eErrorCode::UNKNOWN), m_nFaultRecoveryCountdown (0)
 {
 }
 		
@@ -86,6 +87,7 @@ void CModule::setJournal (std::shared_ptr<CJournal> pJournal, uint32_t nJournalG
 	m_nJournalGroupID = nJournalGroupID;
 		
 	m_pJournal->registerGroup (nJournalGroupID, m_sName);
+	m_FaultCodeJournalHandle = m_pJournal->registerIntegerValue ("faultcode", nJournalGroupID, JOURNALVARIABLE_MODULE_FAULTCODE, 0, INT32_MAX);
 		
 	m_bJournalIsRegistering = true;
 	try {
@@ -104,66 +106,166 @@ void CModule::onRegisterJournal ()
 void CModule::onUpdateJournal ()
 {
 }
+
+void CModule::setCycleSchedule (uint32_t nCycleDivider, uint32_t nCyclePhase)
+{
+	if ((nCycleDivider == 0) || (nCycleDivider > CYCLESCHEDULE_MAXDIVIDER))
+		throw CException (eErrorCode::INVALIDCYCLEDIVIDER, "invalid cycle divider: " + std::to_string (nCycleDivider) + " (" + m_sName + ")");
+	
+	m_nCycleDivider = nCycleDivider;
+	m_nCycleCountdown = nCyclePhase % nCycleDivider;
+}
+
+uint32_t CModule::getCycleDivider ()
+{
+	return m_nCycleDivider;
+}
+
+bool CModule::advanceCycleSchedule ()
+{
+	if (m_nCycleCountdown > 0) {
+		m_nCycleCountdown--;
+		m_bIsScheduledInCycle = false;
+	} else {
+		m_nCycleCountdown = m_nCycleDivider - 1;
+		m_bIsScheduledInCycle = true;
+	}
+	
+	return m_bIsScheduledInCycle;
+}
+
+bool CModule::isScheduledInCycle ()
+{
+	return m_bIsScheduledInCycle;
+}
+
+void CModule::setFault (eErrorCode FaultCode, const std::string & sFaultMessage)
+{
+	m_bIsFaulted = true;
+	m_FaultCode = FaultCode;
+	m_sFaultMessage = sFaultMessage;
+	m_nFaultRecoveryCountdown = MODULE_FAULTRECOVERYCYCLES;
 	
-void CModule::registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
+	if (m_pJournal.get () != nullptr)
+		m_pJournal->setIntegerValue (m_FaultCodeJournalHandle, (int64_t) FaultCode);
+}
+
+void CModule::clearFault ()
+{
+	m_bIsFaulted = false;
+	m_FaultCode = eErrorCode::UNKNOWN;
+	m_sFaultMessage = "";
+	
+	if (m_pJournal.get () != nullptr)
+		m_pJournal->setIntegerValue (m_FaultCodeJournalHandle, (int64_t) eErrorCode::UNKNOWN);
+}
+
+bool CModule::isFaulted ()
+{
+	return m_bIsFaulted;
+}
+
+bool CModule::advanceFaultRecovery ()
+{
+	if (m_nFaultRecoveryCountdown > 0) {
+		m_nFaultRecoveryCountdown--;
+		return false;
+	}
+	
+	return true;
+}
+
+eErrorCode CModule::getFaultCode ()
+{
+	return m_FaultCode;
+}
+
+std::string CModule::getFaultMessage ()
+{
+	return m_sFaultMessage;
+}
+	
+const sJournalHandle & CModule::findJournalHandle (const uint32_t nEntryID)
+{
+	if (nEntryID >= m_JournalHandles.size ())
+		throw CException (eErrorCode::JOURNALENTRYNOTFOUND, "journal entry not found: " + std::to_string (nEntryID) + " (" + m_sName + ")");
+	
+	return m_JournalHandles[nEntryID];
+}
+	
+sJournalHandle CModule::registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
 {
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 	if (!m_bJournalIsRegistering)
 		throw CException (eErrorCode::JOURNALISNOTREGISTERING, "journal is not registering");
 		
-	m_pJournal->registerIntegerValue (sEntryName, m_nJournalGroupID, nEntryID, nMinValue, nMaxValue);
+	auto Handle = m_pJournal->registerIntegerValue (sEntryName, m_nJournalGroupID, nEntryID, nMinValue, nMaxValue);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 	
-void CModule::registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID)
 {
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 	if (!m_bJournalIsRegistering)
 		throw CException (eErrorCode::JOURNALISNOTREGISTERING, "journal is not registering");
 
-	m_pJournal->registerBoolValue (sEntryName, m_nJournalGroupID, nEntryID);
+	auto Handle = m_pJournal->registerBoolValue (sEntryName, m_nJournalGroupID, nEntryID);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 	
-void CModule::registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
+sJournalHandle CModule::registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
 {
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 	if (!m_bJournalIsRegistering)
 		throw CException (eErrorCode::JOURNALISNOTREGISTERING, "journal is not registering");
 		
-	m_pJournal->registerDoubleValue (sEntryName, m_nJournalGroupID, nEntryID, dMinValue, dMaxValue, nQuantizationSteps);
-		
+	auto Handle = m_pJournal->registerDoubleValue (sEntryName, m_nJournalGroupID, nEntryID, dMinValue, dMaxValue, nQuantizationSteps);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 	
-void CModule::registerUInt8Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerUInt8Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, 0, UINT8_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, 0, UINT8_MAX);
 }
 	
-void CModule::registerUInt16Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerUInt16Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, 0, UINT16_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, 0, UINT16_MAX);
 }
 	
-void CModule::registerUInt32Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerUInt32Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, 0, UINT32_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, 0, UINT32_MAX);
 }
 	
-void CModule::registerInt8Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerInt8Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, INT8_MIN, INT8_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, INT8_MIN, INT8_MAX);
 }
 	
-void CModule::registerInt16Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerInt16Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, INT16_MIN, INT16_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, INT16_MIN, INT16_MAX);
 }
 	
-void CModule::registerInt32Value (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CModule::registerInt32Value (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	registerIntegerValue (sEntryName, nEntryID, INT32_MIN, INT32_MAX);
+	return registerIntegerValue (sEntryName, nEntryID, INT32_MIN, INT32_MAX);
 }
 			
 		
@@ -172,7 +274,7 @@ void CModule::setIntegerValue (const uint32_t nEntryID, int64_t nValue)
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 		
-	m_pJournal->setIntegerValue (m_nJournalGroupID, nEntryID, nValue);
+	m_pJournal->setIntegerValue (findJournalHandle (nEntryID), nValue);
 }
 	
 void CModule::setBoolValue (const uint32_t nEntryID, bool bValue)
@@ -180,7 +282,7 @@ void CModule::setBoolValue (const uint32_t nEntryID, bool bValue)
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 		
-	m_pJournal->setBoolValue (m_nJournalGroupID, nEntryID, bValue);
+	m_pJournal->setBoolValue (findJournalHandle (nEntryID), bValue);
 }
 	
 void CModule::setDoubleValue (const uint32_t nEntryID, double dValue)
@@ -188,7 +290,31 @@ void CModule::setDoubleValue (const uint32_t nEntryID, double dValue)
 	if (m_pJournal.get () == nullptr)
 		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
 		
-	m_pJournal->setDoubleValue (m_nJournalGroupID, nEntryID, dValue);
+	m_pJournal->setDoubleValue (findJournalHandle (nEntryID), dValue);
+}
+	
+void CModule::setIntegerValue (const sJournalHandle & Handle, int64_t nValue)
+{
+	if (m_pJournal.get () == nullptr)
+		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
+		
+	m_pJournal->setIntegerValue (Handle, nValue);
+}
+	
+void CModule::setBoolValue (const sJournalHandle & Handle, bool bValue)
+{
+	if (m_pJournal.get () == nullptr)
+		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
+		
+	m_pJournal->setBoolValue (Handle, bValue);
+}
+	
+void CModule::setDoubleValue (const sJournalHandle & Handle, double dValue)
+{
+	if (m_pJournal.get () == nullptr)
+		throw CException (eErrorCode::JOURNALNOTSET, "journal is not set");
+		
+	m_pJournal->setDoubleValue (Handle, dValue);
 }
 	
 CIOModule::CIOModule (const std::string & sName)
@@ -247,6 +373,15 @@ void CEnvironment::setNextState (const std::string & sNextState)
 	m_pNextState = pState;
 }
 
+void CEnvironment::setNextState (uint32_t nNextStateID)
+{
+	CState * pState = m_pStateHandler->getStateByID (nNextStateID);
+	if (pState == nullptr)
+		throw CException (eErrorCode::STATENOTFOUND, "state has not been found: " + std::to_string (nNextStateID));
+		
+	m_pNextState = pState;
+}
+
 CModule * CEnvironment::findModule (const std::string & sName, bool bFailIfNotExist)
 {
 	auto pModule = m_pStateHandler->findModule (sName);
@@ -258,6 +393,31 @@ CModule * CEnvironment::findModule (const std::string & sName, bool bFailIfNotEx
 	return pModule;
 		
 }
+
+CModule * CEnvironment::getBoundModule (uint32_t nModuleID, const std::type_info & ModuleType)
+{
+	return m_pStateHandler->getBoundModule (nModuleID, ModuleType);
+}
+
+bool CEnvironment::isFaulted ()
+{
+	return m_pStateHandler->isFaulted ();
+}
+
+eErrorCode CEnvironment::getFaultCode ()
+{
+	return m_pStateHandler->getFaultCode ();
+}
+
+void CEnvironment::clearFault ()
+{
+	m_pStateHandler->clearFault ();
+}
+
+bool CEnvironment::boundModulesAreAvailable ()
+{
+	return m_pStateHandler->boundModulesAreAvailable ();
+}
 	
 CSignalProcessingInstance * CEnvironment::checkSignal (const std::string & sName)
 {
@@ -268,6 +428,16 @@ CSignalProcessingInstance * CEnvironment::checkSignal (const std::string & sName
 		
 	return nullptr;
 }
+
+CSignalProcessingInstance * CEnvironment::checkSignal (uint32_t nSignalID)
+{
+	auto pSignalHandler = m_pStateHandler->getSignalHandler();
+	if (pSignalHandler != nullptr) {
+		return pSignalHandler->checkSignal (nSignalID);
+	}
+		
+	return nullptr;
+}
 	
 void CEnvironment::setIntegerValue (const uint32_t nEntryID, int64_t nValue)
 {
@@ -334,7 +504,43 @@ uint8_t CEnvironment::getUint8Value (const uint32_t nEntryID)
 	return m_pStateHandler->getUint8Value (nEntryID);
 }
 	
+void CEnvironment::setIntegerValue (const sJournalHandle & Handle, int64_t nValue)
+{
+	m_pStateHandler->setIntegerValue (Handle, nValue);
+}
+	
+void CEnvironment::setBoolValue (const sJournalHandle & Handle, bool bValue)
+{
+	m_pStateHandler->setBoolValue (Handle, bValue);
+}
+
+void CEnvironment::setDoubleValue (const sJournalHandle & Handle, double dValue)
+{
+	m_pStateHandler->setDoubleValue (Handle, dValue);
+}
+	
+bool CEnvironment::getBoolValue (const sJournalHandle & Handle)
+{
+	return m_pStateHandler->getBoolValue (Handle);
+}
+	
+double CEnvironment::getDoubleValue (const sJournalHandle & Handle)
+{
+	return m_pStateHandler->getDoubleValue (Handle);
+}
+	
+int64_t CEnvironment::getInt64Value (const sJournalHandle & Handle)
+{
+	return m_pStateHandler->getInt64Value (Handle);
+}
+	
+int32_t CEnvironment::getInt32Value (const sJournalHandle & Handle)
+{
+	return m_pStateHandler->getInt32Value (Handle);
+}
+	
 CState::CState ()
+	: m_nStateID (0)
 {
 }
 			
@@ -342,8 +548,24 @@ CState::~CState ()
 {
 }
 
+void CState::initializeStateID (uint32_t nStateID)
+{
+	m_nStateID = nStateID;
+	m_sStateName = getName ();
+}
+
+uint32_t CState::getStateID ()
+{
+	return m_nStateID;
+}
+
+const std::string & CState::getStateName ()
+{
+	return m_sStateName;
+}
+
 CModuleHandler::CModuleHandler (std::shared_ptr<CJournal> pJournal)
-		: m_pJournal (pJournal)
+		: m_pJournal (pJournal), m_pFaultReporter (nullptr)
 {
 	if (pJournal.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");
@@ -357,10 +579,52 @@ CModuleHandler::~CModuleHandler ()
 	
 void CModuleHandler::handleModules ()
 {
-	for (auto iIterator : m_Modules)
-		iIterator.second->handleCyclic ();
-	for (auto iIterator : m_Modules)
-		iIterator.second->onUpdateJournal ();
+	for (auto & iIterator : m_Modules) {
+		CModule * pModule = iIterator.second.get ();
+		bool bIsScheduled = pModule->advanceCycleSchedule ();
+		
+		// A faulted module is retried after the recovery delay, if it throws again it is faulted again
+		if (pModule->isFaulted () && pModule->advanceFaultRecovery ())
+			pModule->clearFault ();
+		
+		if (bIsScheduled && !pModule->isFaulted ())
+			callModule (pModule, &CModule::handleCyclic);
+	}
+	for (auto & iIterator : m_Modules) {
+		CModule * pModule = iIterator.second.get ();
+		if (pModule->isScheduledInCycle () && !pModule->isFaulted ())
+			callModule (pModule, &CModule::onUpdateJournal);
+	}
+}
+
+void CModuleHandler::callModule (CModule * pModule, void (CModule::*pMethod) ())
+{
+	// An exception faults the module only, so the other modules keep running
+	try {
+		(pModule->*pMethod) ();
+	}
+	catch (CException & Exception) {
+		setModuleFault (pModule, Exception.getCode (), Exception.getMessage ());
+	}
+	catch (std::exception & StdException) {
+		setModuleFault (pModule, eErrorCode::UNHANDLEDEXCEPTION, StdException.what ());
+	}
+	catch (...) {
+		setModuleFault (pModule, eErrorCode::UNHANDLEDEXCEPTION, "<untyped exception>");
+	}
+}
+
+void CModuleHandler::setModuleFault (CModule * pModule, eErrorCode FaultCode, const std::string & sFaultMessage)
+{
+	pModule->setFault (FaultCode, sFaultMessage);
+	
+	if (m_pFaultReporter != nullptr)
+		m_pFaultReporter->reportFault (pModule->getName (), FaultCode, sFaultMessage);
+}
+
+void CModuleHandler::setFaultReporter (CFaultReporter * pFaultReporter)
+{
+	m_pFaultReporter = pFaultReporter;
 }
 		
 		
@@ -373,7 +637,7 @@ CModule * CModuleHandler::findModule (const std::string & sName)
 	return nullptr;
 }
 	
-void CModuleHandler::registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID)
+void CModuleHandler::registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID, uint32_t nCycleDivider)
 {
 	if (pModule.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid module parameter");
@@ -382,6 +646,11 @@ void CModuleHandler::registerModule (std::shared_ptr<CModule> pModule, uint32_t
 	if (findModule (sName) != nullptr)
 		throw CException (eErrorCode::MODULEALREADYEXISTS, "module already exists");
 	
+	// Modules with the same divider get consecutive phases, so their work is spread evenly across cycles
+	uint32_t nCyclePhase = m_CycleDividerUsage[nCycleDivider];
+	pModule->setCycleSchedule (nCycleDivider, nCyclePhase);
+	m_CycleDividerUsage[nCycleDivider] = nCyclePhase + 1;
+	
 	m_Modules.insert (std::make_pair (sName, pModule));
 	
 	pModule->setJournal (m_pJournal, nJournalGroupID);
@@ -390,7 +659,7 @@ void CModuleHandler::registerModule (std::shared_ptr<CModule> pModule, uint32_t
 
 
 CStateHandler::CStateHandler (std::shared_ptr<CJournal> pJournal, const std::string & sName, std::shared_ptr<CModuleHandler> pModuleHandler, uint32_t nJournalGroupID)
-	: m_pCurrentState (nullptr), m_pStateNameDebug (nullptr), m_nStateNameDebugLength (0), m_pJournal (pJournal), m_nJournalGroupID (nJournalGroupID), m_sName (sName), m_pModuleHandler (pModuleHandler)
+	: m_pModuleHandler (pModuleHandler), m_pCurrentState (nullptr), m_pDebugState (nullptr), m_bDebugStateIsWritten (false), m_pFaultState (nullptr), m_bIsFaulted (false), m_bIsHalted (false), m_FaultCode (eErrorCode::UNKNOWN), m_pStateNameDebug (nullptr), m_nStateNameDebugLength (0), m_pJournal (pJournal), m_nJournalGroupID (nJournalGroupID), m_sName (sName), m_nProfileSectionIndex (UINT32_MAX), m_nCycleDivider (1), m_nCycleCountdown (0)
 {
 	if (pJournal.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");
@@ -400,6 +669,10 @@ CStateHandler::CStateHandler (std::shared_ptr<CJournal> pJournal, const std::str
 		
 	m_pSignalHandler = std::make_shared<CSignalHandler> (pJournal->getSystemInfo ());
 	pJournal->registerGroup (nJournalGroupID, getName ());
+	
+	m_CurrentStateJournalHandle = pJournal->registerIntegerValue ("currentstate", nJournalGroupID, JOURNALVARIABLE_STATEHANDLER_CURRENTSTATE, 0, STATEHANDLER_MAXSTATECOUNT - 1);
+	m_FaultedJournalHandle = pJournal->registerBoolValue ("faulted", nJournalGroupID, JOURNALVARIABLE_STATEHANDLER_FAULTED);
+	m_FaultCodeJournalHandle = pJournal->registerIntegerValue ("faultcode", nJournalGroupID, JOURNALVARIABLE_STATEHANDLER_FAULTCODE, 0, INT32_MAX);
 		
 }
 		
@@ -421,9 +694,17 @@ CState * CStateHandler::findState (const std::string & sName) {
 	return nullptr;
 		
 }
+
+CState * CStateHandler::getStateByID (uint32_t nStateID)
+{
+	if (nStateID < m_StatesByID.size ())
+		return m_StatesByID[nStateID];
+	
+	return nullptr;
+}
 		
 	
-void CStateHandler::addState (std::shared_ptr<CState> pState)
+uint32_t CStateHandler::addState (std::shared_ptr<CState> pState)
 {
 		
 	if (pState.get () == nullptr)
@@ -432,19 +713,113 @@ void CStateHandler::addState (std::shared_ptr<CState> pState)
 	std::string sName = pState->getName ();		
 	if (findState (sName) != nullptr)
 		throw CException (eErrorCode::STATEALREADYEXISTS, "state already exists");
+	
+	if (m_StatesByID.size () >= STATEHANDLER_MAXSTATECOUNT)
+		throw CException (eErrorCode::TOOMANYSTATES, "too many states: " + sName);
+	
+	uint32_t nStateID = (uint32_t) m_StatesByID.size ();
+	pState->initializeStateID (nStateID);
 			
 	m_States.insert (std::make_pair (sName, pState));
+	m_StatesByID.push_back (pState.get ());
 		
 	if (m_pCurrentState == nullptr)
 		m_pCurrentState = pState.get();
 		
+	return nStateID;
 		
 }
 	
+void CStateHandler::addState (std::shared_ptr<CState> pState, uint32_t nExpectedStateID)
+{
+	uint32_t nStateID = addState (pState);
+	if (nStateID != nExpectedStateID)
+		throw CException (eErrorCode::REGISTRATIONIDMISMATCH, "state ID mismatch: " + pState->getName () + " has ID " + std::to_string (nStateID) + ", expected " + std::to_string (nExpectedStateID) + " (" + m_sName + ")");
+}
+	
+void CStateHandler::setFaultState (uint32_t nStateID)
+{
+	CState * pState = getStateByID (nStateID);
+	if (pState == nullptr)
+		throw CException (eErrorCode::STATENOTFOUND, "state has not been found: " + std::to_string (nStateID));
+	
+	m_pFaultState = pState;
+}
+
+void CStateHandler::setFault (eErrorCode FaultCode, const std::string & sFaultMessage)
+{
+	m_bIsFaulted = true;
+	m_FaultCode = FaultCode;
+	m_sFaultMessage = sFaultMessage;
+	
+	m_pJournal->setBoolValue (m_FaultedJournalHandle, true);
+	m_pJournal->setIntegerValue (m_FaultCodeJournalHandle, (int64_t) FaultCode);
+	
+	// A fault in the fault state itself can not be handled by the state machine anymore
+	if ((m_pFaultState != nullptr) && (m_pCurrentState != m_pFaultState)) {
+		setCurrentState (m_pFaultState);
+		writeDebugInformation ();
+	} else {
+		m_bIsHalted = true;
+		
+		if ((m_pStateNameDebug != nullptr) && (m_nStateNameDebugLength > 0))
+			CUtils::writeStringVariable ("<halted> " + sFaultMessage, m_pStateNameDebug, m_nStateNameDebugLength);
+	}
+}
+
+void CStateHandler::clearFault ()
+{
+	m_bIsFaulted = false;
+	m_bIsHalted = false;
+	m_FaultCode = eErrorCode::UNKNOWN;
+	m_sFaultMessage = "";
+	
+	m_pJournal->setBoolValue (m_FaultedJournalHandle, false);
+	m_pJournal->setIntegerValue (m_FaultCodeJournalHandle, (int64_t) eErrorCode::UNKNOWN);
+	
+	// Make sure the halt message is replaced by the state name again
+	m_bDebugStateIsWritten = false;
+}
+
+bool CStateHandler::isFaulted ()
+{
+	return m_bIsFaulted;
+}
+
+bool CStateHandler::isHalted ()
+{
+	return m_bIsHalted;
+}
+
+eErrorCode CStateHandler::getFaultCode ()
+{
+	return m_FaultCode;
+}
+
+std::string CStateHandler::getFaultMessage ()
+{
+	return m_sFaultMessage;
+}
+
+bool CStateHandler::boundModulesAreAvailable ()
+{
+	for (auto & Binding : m_ModuleBindings) {
+		CModule * pModule = Binding.m_pModule;
+		if ((pModule != nullptr) && ((!pModule->isActive ()) || pModule->isFaulted ()))
+			return false;
+	}
+	
+	return true;
+}
+
 void CStateHandler::setCurrentState (CState * pState)
 {
 	if (pState == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid state parameter");
+	
+	if (pState != m_pCurrentState) {
+		m_pJournal->setIntegerValue (m_CurrentStateJournalHandle, pState->getStateID ());
+	}
 		
 	m_pCurrentState = pState;
 		
@@ -463,17 +838,93 @@ CModule * CStateHandler::findModule (const std::string & sName)
 	return m_pModuleHandler->findModule (sName);
 }
 
+void CStateHandler::addModuleBinding (uint32_t nModuleID, CModule * pModule, const std::type_info & ModuleType)
+{
+	if (nModuleID >= MODULEBINDING_MAXCOUNT)
+		throw CException (eErrorCode::INVALIDPARAM, "invalid module binding ID: " + std::to_string (nModuleID));
+	
+	if (nModuleID >= m_ModuleBindings.size ())
+		m_ModuleBindings.resize (nModuleID + 1);
+	
+	auto & Binding = m_ModuleBindings[nModuleID];
+	if (Binding.m_pModule != nullptr)
+		throw CException (eErrorCode::DUPLICATEMODULEBINDING, "duplicate module binding: " + std::to_string (nModuleID) + " (" + m_sName + ")");
+	
+	Binding.m_pModule = pModule;
+	Binding.m_pModuleType = &ModuleType;
+}
+
+CModule * CStateHandler::getBoundModule (uint32_t nModuleID, const std::type_info & ModuleType)
+{
+	if (nModuleID >= m_ModuleBindings.size ())
+		throw CException (eErrorCode::MODULEBINDINGNOTFOUND, "module binding not found: " + std::to_string (nModuleID) + " (" + m_sName + ")");
+	
+	auto & Binding = m_ModuleBindings[nModuleID];
+	if (Binding.m_pModule == nullptr)
+		throw CException (eErrorCode::MODULEBINDINGNOTFOUND, "module binding not found: " + std::to_string (nModuleID) + " (" + m_sName + ")");
+	
+	// Accessing a binding with a different type than it was bound with would make the static cast invalid
+	if (*Binding.m_pModuleType != ModuleType)
+		throw CException (eErrorCode::INVALIDMODULETYPE, "invalid module type: " + Binding.m_pModule->getName ());
+	
+	return Binding.m_pModule;
+}
+
 
 CSignalHandler* CStateHandler::getSignalHandler ()
 {
 	return m_pSignalHandler.get ();
 }
+
+void CStateHandler::setProfileSectionIndex (uint32_t nProfileSectionIndex)
+{
+	m_nProfileSectionIndex = nProfileSectionIndex;
+}
+
+uint32_t CStateHandler::getProfileSectionIndex ()
+{
+	return m_nProfileSectionIndex;
+}
+
+void CStateHandler::setCycleSchedule (uint32_t nCycleDivider, uint32_t nCyclePhase)
+{
+	if ((nCycleDivider == 0) || (nCycleDivider > CYCLESCHEDULE_MAXDIVIDER))
+		throw CException (eErrorCode::INVALIDCYCLEDIVIDER, "invalid cycle divider: " + std::to_string (nCycleDivider) + " (" + m_sName + ")");
+	
+	m_nCycleDivider = nCycleDivider;
+	m_nCycleCountdown = nCyclePhase % nCycleDivider;
+}
+
+uint32_t CStateHandler::getCycleDivider ()
+{
+	return m_nCycleDivider;
+}
+
+bool CStateHandler::advanceCycleSchedule ()
+{
+	if (m_nCycleCountdown > 0) {
+		m_nCycleCountdown--;
+		return false;
+	}
+	
+	m_nCycleCountdown = m_nCycleDivider - 1;
+	return true;
+}
 		
 std::shared_ptr<CSignalDefinition> CStateHandler::registerSignal (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifetimeInMilliseconds)
 {
 	return m_pSignalHandler->registerSignal (sName, nQueueSize, nLifetimeInMilliseconds);
 }
 	
+std::shared_ptr<CSignalDefinition> CStateHandler::registerSignal (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifetimeInMilliseconds, const uint32_t nExpectedSignalID)
+{
+	auto pSignalDefinition = registerSignal (sName, nQueueSize, nLifetimeInMilliseconds);
+	if (pSignalDefinition->getSignalID () != nExpectedSignalID)
+		throw CException (eErrorCode::REGISTRATIONIDMISMATCH, "signal ID mismatch: " + sName + " has ID " + std::to_string (pSignalDefinition->getSignalID ()) + ", expected " + std::to_string (nExpectedSignalID) + " (" + m_sName + ")");
+	
+	return pSignalDefinition;
+}
+	
 	
 void CStateHandler::onRegister ()
 {
@@ -485,16 +936,22 @@ void CStateHandler::setDebugVariables (char * pStateNameDebug, uint32_t nStateNa
 {
 	m_pStateNameDebug = pStateNameDebug;
 	m_nStateNameDebugLength = nStateNameDebugLength;
+	m_bDebugStateIsWritten = false;
 }
 
 void CStateHandler::writeDebugInformation ()
 {
 	if ((m_pStateNameDebug != nullptr) && (m_nStateNameDebugLength > 0)) {
 						
+		// The name only needs to be rewritten when the state has changed
+		if (m_bDebugStateIsWritten && (m_pCurrentState == m_pDebugState))
+			return;
+		m_pDebugState = m_pCurrentState;
+		m_bDebugStateIsWritten = true;
+						
 		if (m_pCurrentState != nullptr) {
 				
-			std::string sStateName = m_pCurrentState->getName();
-			CUtils::writeStringVariable (sStateName, m_pStateNameDebug, m_nStateNameDebugLength);
+			CUtils::writeStringVariable (m_pCurrentState->getStateName (), m_pStateNameDebug, m_nStateNameDebugLength);
 				
 		} else {
 				
@@ -505,84 +962,142 @@ void CStateHandler::writeDebugInformation ()
 	}
 }
 	
-void CStateHandler::registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
+const sJournalHandle & CStateHandler::findJournalHandle (const uint32_t nEntryID)
+{
+	if (nEntryID >= m_JournalHandles.size ())
+		throw CException (eErrorCode::JOURNALENTRYNOTFOUND, "journal entry not found: " + std::to_string (nEntryID) + " (" + m_sName + ")");
+	
+	return m_JournalHandles[nEntryID];
+}
+	
+sJournalHandle CStateHandler::registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
 {
-	m_pJournal->registerIntegerValue (sEntryName, m_nJournalGroupID, nEntryID, nMinValue, nMaxValue);
+	auto Handle = m_pJournal->registerIntegerValue (sEntryName, m_nJournalGroupID, nEntryID, nMinValue, nMaxValue);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 		
-void CStateHandler::registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID)
+sJournalHandle CStateHandler::registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID)
 {
-	m_pJournal->registerBoolValue (sEntryName, m_nJournalGroupID, nEntryID);
+	auto Handle = m_pJournal->registerBoolValue (sEntryName, m_nJournalGroupID, nEntryID);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 	
-void CStateHandler::registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
+sJournalHandle CStateHandler::registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
 {
-	m_pJournal->registerDoubleValue (sEntryName, m_nJournalGroupID, nEntryID, dMinValue, dMaxValue, nQuantizationSteps);
+	auto Handle = m_pJournal->registerDoubleValue (sEntryName, m_nJournalGroupID, nEntryID, dMinValue, dMaxValue, nQuantizationSteps);
+	if (nEntryID >= m_JournalHandles.size ())
+		m_JournalHandles.resize (nEntryID + 1);
+	m_JournalHandles[nEntryID] = Handle;
+	
+	return Handle;
 }
 
 void CStateHandler::setIntegerValue (const uint32_t nEntryID, int64_t nValue)
 {
-	m_pJournal->setIntegerValue (m_nJournalGroupID, nEntryID, nValue );
+	m_pJournal->setIntegerValue (findJournalHandle (nEntryID), nValue);
 }
 	
 void CStateHandler::setBoolValue (const uint32_t nEntryID, bool bValue)
 {
-	m_pJournal->setBoolValue (m_nJournalGroupID, nEntryID, bValue );
+	m_pJournal->setBoolValue (findJournalHandle (nEntryID), bValue);
 }
 	
 void CStateHandler::setDoubleValue (const uint32_t nEntryID, double dValue)
 {
-	m_pJournal->setDoubleValue (m_nJournalGroupID, nEntryID, dValue );
+	m_pJournal->setDoubleValue (findJournalHandle (nEntryID), dValue);
 }
 	
 bool CStateHandler::getBoolValue (const uint32_t nEntryID)
 {
-	return m_pJournal->getBoolValue (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getBoolValue (findJournalHandle (nEntryID));
 }
 		
 double CStateHandler::getDoubleValue (const uint32_t nEntryID)
 {
-	return m_pJournal->getDoubleValue (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getDoubleValue (findJournalHandle (nEntryID));
 }
 	
 int64_t CStateHandler::getInt64Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getInt64Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getInt64Value (findJournalHandle (nEntryID));
 }
 	
 int32_t CStateHandler::getInt32Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getInt32Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getInt32Value (findJournalHandle (nEntryID));
 }
 	
 int16_t CStateHandler::getInt16Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getInt16Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getInt16Value (findJournalHandle (nEntryID));
 }
 	
 int8_t CStateHandler::getInt8Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getInt8Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getInt8Value (findJournalHandle (nEntryID));
 }
 	
 uint64_t CStateHandler::getUint64Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getUint64Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getUint64Value (findJournalHandle (nEntryID));
 }
 	
 uint32_t CStateHandler::getUint32Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getUint32Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getUint32Value (findJournalHandle (nEntryID));
 }
 	
 uint16_t CStateHandler::getUint16Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getUint16Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getUint16Value (findJournalHandle (nEntryID));
 }
 	
 uint8_t CStateHandler::getUint8Value (const uint32_t nEntryID)
 {
-	return m_pJournal->getUint8Value (m_nJournalGroupID, nEntryID);
+	return m_pJournal->getUint8Value (findJournalHandle (nEntryID));
+}
+	
+void CStateHandler::setIntegerValue (const sJournalHandle & Handle, int64_t nValue)
+{
+	m_pJournal->setIntegerValue (Handle, nValue);
+}
+	
+void CStateHandler::setBoolValue (const sJournalHandle & Handle, bool bValue)
+{
+	m_pJournal->setBoolValue (Handle, bValue);
+}
+	
+void CStateHandler::setDoubleValue (const sJournalHandle & Handle, double dValue)
+{
+	m_pJournal->setDoubleValue (Handle, dValue);
+}
+	
+bool CStateHandler::getBoolValue (const sJournalHandle & Handle)
+{
+	return m_pJournal->getBoolValue (Handle);
+}
+	
+double CStateHandler::getDoubleValue (const sJournalHandle & Handle)
+{
+	return m_pJournal->getDoubleValue (Handle);
+}
+	
+int64_t CStateHandler::getInt64Value (const sJournalHandle & Handle)
+{
+	return m_pJournal->getInt64Value (Handle);
+}
+	
+int32_t CStateHandler::getInt32Value (const sJournalHandle & Handle)
+{
+	return m_pJournal->getInt32Value (Handle);
 }
 
 void CStateHandler::releaseExpiredSignals ()
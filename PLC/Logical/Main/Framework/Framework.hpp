@@ -36,8 +36,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <map>
 #include <vector>
+#include <cstring>
+#include <typeinfo>
 
 #include <bur/plctypes.h>
 
@@ -45,6 +48,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <AsDefault.h>
 #endif
 
+// BURCPP_HOSTBUILD builds the program natively on Linux, see PLC/Host. The TCP server then uses
+// POSIX sockets and the IO mapping is simulated in memory.
+
 #define COMMAND_DEFAULT_BEGINLIST 101
 #define COMMAND_DEFAULT_FINISHLIST 102
 #define COMMAND_DEFAULT_EXECUTELIST 103
@@ -52,11 +58,34 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define COMMAND_DEFAULT_LISTSTATUS 105
 #define COMMAND_DEFAULT_ABORTLIST 106
 #define COMMAND_DEFAULT_RESUMELIST 107
+#define COMMAND_DEFAULT_BATCHLIST 108
+#define COMMAND_DEFAULT_DEFINELISTTEMPLATE 109
+#define COMMAND_DEFAULT_INSTANTIATELISTTEMPLATE 110
 #define COMMAND_DEFAULT_DELETELIST 112
 #define COMMAND_DEFAULT_CURRENTJOURNALSTATUS 120
 #define COMMAND_DEFAULT_CURRENTJOURNALSCHEMA 121
 #define COMMAND_DEFAULT_RETRIEVEJOURNALVARIABLE 122
 #define COMMAND_DEFAULT_RETRIEVEJOURNALHISTORY 123
+#define COMMAND_DEFAULT_STREAMJOURNALHISTORY 124
+#define COMMAND_DEFAULT_DELTAJOURNALSTATUS 125
+
+// Modules and state handlers may run every n-th cycle only
+#define CYCLESCHEDULE_MAXDIVIDER 1000
+
+// State handlers bind their modules once at registration, see CStateHandler::bindModule
+#define MODULEBINDING_MAXCOUNT 64
+
+// States get dense IDs in the order they are added to their state handler
+#define STATEHANDLER_MAXSTATECOUNT 1024
+#define JOURNALVARIABLE_STATEHANDLER_CURRENTSTATE 0x7FFF
+
+// An exception in a state handler or module faults only that handler or module, the rest of the application keeps running
+#define JOURNALVARIABLE_STATEHANDLER_FAULTED 0x7FFE
+#define JOURNALVARIABLE_STATEHANDLER_FAULTCODE 0x7FFD
+#define JOURNALVARIABLE_MODULE_FAULTCODE 0x7FFF
+
+// A faulted module is handled again after this number of cycles, one second with the 4 ms task cycle
+#define MODULE_FAULTRECOVERYCYCLES 250
 
 namespace BuRCPP {
 	
@@ -183,9 +212,53 @@ namespace BuRCPP {
 		INVALIDCHANNELTYPE = 116,
 		SIGNALTRIGGERTIMEISINFUTURE = 117,
 		INVALIDCHANNELVALUE = 118,
+		INVALIDJOURNALHANDLE = 119,
+		TCPRECEIVEBUFFERISFULL = 120,
+		TCPRECEIVEBUFFERUNDERRUN = 121,
+		INVALIDEXTENDEDFRAME = 122,
+		PACKETHANDLERNOTFOUND = 123,
+		COMMANDISNOTBUFFERED = 124,
+		INVALIDLISTLANE = 125,
+		LISTLANECONFLICT = 126,
+		LISTISNOTINERRORSTATE = 127,
+		INVALIDLISTRESUMEMODE = 128,
+		LISTTEMPLATENOTFOUND = 129,
+		INVALIDLISTTEMPLATEID = 130,
+		INVALIDLISTTEMPLATEPATCH = 131,
+		TOOMANYLISTTEMPLATES = 132,
+		INVALIDSIGNALHANDLE = 133,
+		TOOMANYSIGNALDEFINITIONS = 134,
+		LISTEXECUTIONABORTED = 135,
+		LISTISNOTEXECUTING = 136,
+		CYCLEPROFILESECTIONNOTFOUND = 137,
+		TOOMANYCYCLEPROFILESECTIONS = 138,
+		INVALIDCYCLEDIVIDER = 139,
+		MODULEBINDINGNOTFOUND = 140,
+		DUPLICATEMODULEBINDING = 141,
+		TOOMANYSTATES = 142,
+		HEAPALLOCATIONINCYCLE = 143,
+		MODULEISFAULTED = 144,
+		SIGNALSTILLINPROCESS = 145,
+		REGISTRATIONIDMISMATCH = 146,
+		LISTISEXECUTING = 147,
 		
 	};
 	
+	enum class eJournalValueType : uint8_t {
+		Unknown = 0,
+		Integer = 1,
+		Double = 2,
+		Bool = 3
+	};
+	
+	// Pre-resolved reference to a journal value. Returned on registration and used for cyclic access without any lookups.
+	typedef struct _sJournalHandle {
+		uint32_t m_nAddress = 0;
+		uint16_t m_nGroupID = 0;
+		uint16_t m_nEntryID = 0;
+		eJournalValueType m_ValueType = eJournalValueType::Unknown;
+	} sJournalHandle;
+	
 
 	class CStateHandler;
 	class CSignalDefinition;
@@ -223,6 +296,17 @@ namespace BuRCPP {
 	} TcpIncomingMessage;
 	
 	
+	// Header of a variable length frame. It is followed by the payload and a uint32 payload checksum.
+	typedef struct _TcpExtendedMessageHeader {
+		uint32_t m_nSignature;
+		uint32_t m_nClientId;
+		uint32_t m_nSequenceId;
+		uint32_t m_nCommandId;
+		uint32_t m_nPayloadLength;
+		uint32_t m_nHeaderChecksum;
+	} TcpExtendedMessageHeader;
+	
+	
 	typedef struct _TcpOutgoingMessageHeader {
 		uint32_t m_nSignature;
 		uint32_t m_nClientId;
@@ -284,6 +368,19 @@ namespace BuRCPP {
 		std::shared_ptr<CJournal> m_pJournal;
 		uint32_t m_nJournalGroupID;
 		bool m_bJournalIsRegistering;
+		std::vector<sJournalHandle> m_JournalHandles;
+		
+		uint32_t m_nCycleDivider;
+		uint32_t m_nCycleCountdown;
+		bool m_bIsScheduledInCycle;
+		
+		bool m_bIsFaulted;
+		eErrorCode m_FaultCode;
+		std::string m_sFaultMessage;
+		sJournalHandle m_FaultCodeJournalHandle;
+		uint32_t m_nFaultRecoveryCountdown;
+		
+		const sJournalHandle & findJournalHandle (const uint32_t nEntryID);
 
 		public:
 		CModule (const std::string & sName);
@@ -299,21 +396,41 @@ namespace BuRCPP {
 		virtual void onRegisterJournal ();
 		virtual void onUpdateJournal ();
 		
-		void registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
-		void registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
-
-		void registerUInt8Value (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerUInt16Value (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerUInt32Value (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerInt8Value (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerInt16Value (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerInt32Value (const std::string & sEntryName,const uint32_t nEntryID);
+		// The module is handled every nCycleDivider-th cycle, starting with the cycle nCyclePhase.
+		void setCycleSchedule (uint32_t nCycleDivider, uint32_t nCyclePhase);
+		uint32_t getCycleDivider ();
+		bool advanceCycleSchedule ();
+		bool isScheduledInCycle ();
+		
+		// A faulted module is not handled anymore until the fault is cleared
+		void setFault (eErrorCode FaultCode, const std::string & sFaultMessage);
+		void clearFault ();
+		bool isFaulted ();
+		
+		// Counts down the cycles until a faulted module is retried, returns true when the retry is due
+		bool advanceFaultRecovery ();
+		eErrorCode getFaultCode ();
+		std::string getFaultMessage ();
+		
+		sJournalHandle registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
+		sJournalHandle registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
+
+		sJournalHandle registerUInt8Value (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerUInt16Value (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerUInt32Value (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerInt8Value (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerInt16Value (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerInt32Value (const std::string & sEntryName,const uint32_t nEntryID);
 		
 		void setIntegerValue (const uint32_t nEntryID, int64_t nValue);
 		void setBoolValue (const uint32_t nEntryID, bool bValue);
 		void setDoubleValue (const uint32_t nEntryID, double dValue);
 		
+		void setIntegerValue (const sJournalHandle & Handle, int64_t nValue);
+		void setBoolValue (const sJournalHandle & Handle, bool bValue);
+		void setDoubleValue (const sJournalHandle & Handle, double dValue);
+		
 	};
 	
 	
@@ -384,17 +501,33 @@ namespace BuRCPP {
 		virtual ~CEnvironment ();
 		
 		void setNextState (const std::string & sNextState);
+		void setNextState (uint32_t nNextStateID);
 		
 		CState * getNextState ();
 		
 		
 		CModule * findModule (const std::string & sName, bool bFailIfNotExist);
+		CModule * getBoundModule (uint32_t nModuleID, const std::type_info & ModuleType);
 		
 
 		CSignalProcessingInstance * checkSignal (const std::string & sName);
+		CSignalProcessingInstance * checkSignal (uint32_t nSignalID);
 	
 		CSignalProcessingInstance * findSignal (uint32_t nSignalID);
 		
+		// Lets the fault state of a state handler inspect and acknowledge the fault
+		bool isFaulted ();
+		eErrorCode getFaultCode ();
+		void clearFault ();
+		bool boundModulesAreAvailable ();
+		
+		// Unlike ioModuleAccess, the module is returned also if it is inactive or faulted. Fault states use it to
+		// drive the outputs safe, the IO modules write them into the IO mapping directly.
+		template<typename T> T * getModuleForFaultState (uint32_t nModuleID)
+		{
+			return static_cast<T *> (getBoundModule (nModuleID, typeid (T)));
+		}
+		
 		void setIntegerValue (const uint32_t nEntryID, int64_t nValue);
 		void setBoolValue (const uint32_t nEntryID, bool bValue);
 		void setDoubleValue (const uint32_t nEntryID, double dValue);
@@ -409,6 +542,15 @@ namespace BuRCPP {
 		uint32_t getUint32Value (const uint32_t nEntryID);
 		uint16_t getUint16Value (const uint32_t nEntryID);
 		uint8_t getUint8Value (const uint32_t nEntryID);		
+		
+		void setIntegerValue (const sJournalHandle & Handle, int64_t nValue);
+		void setBoolValue (const sJournalHandle & Handle, bool bValue);
+		void setDoubleValue (const sJournalHandle & Handle, double dValue);
+		
+		bool getBoolValue (const sJournalHandle & Handle);
+		double getDoubleValue (const sJournalHandle & Handle);
+		int64_t getInt64Value (const sJournalHandle & Handle);
+		int32_t getInt32Value (const sJournalHandle & Handle);
 	
 	};
 
@@ -416,6 +558,9 @@ namespace BuRCPP {
 	class CState {
 
 		private:
+		
+		uint32_t m_nStateID;
+		std::string m_sStateName;
 	
 		public:
 	
@@ -425,36 +570,75 @@ namespace BuRCPP {
 		
 		virtual std::string getName () = 0;
 		
+		// Called once by the state handler when the state is added. Caches the name, so the cyclic code does not need to build it.
+		void initializeStateID (uint32_t nStateID);
+		uint32_t getStateID ();
+		const std::string & getStateName ();
+		
 		virtual void Execute (CEnvironment * pEnvironment) = 0;
 		
 		
 	};
 
+	// Receives the faults that are contained within the cycle, see CApplication
+	class CFaultReporter {
+		public:
+		
+			virtual void reportFault (const std::string & sSource, eErrorCode FaultCode, const std::string & sFaultMessage) = 0;
+	};
+
 	class CModuleHandler {
 		private:
 			std::map<std::string, std::shared_ptr<CModule>> m_Modules;		
 			std::shared_ptr<CJournal> m_pJournal;
+			std::map<uint32_t, uint32_t> m_CycleDividerUsage;
+			CFaultReporter * m_pFaultReporter;
+			
+			void setModuleFault (CModule * pModule, eErrorCode FaultCode, const std::string & sFaultMessage);
+			
+			void callModule (CModule * pModule, void (CModule::*pMethod) ());
 		public:
 			CModuleHandler (std::shared_ptr<CJournal> pJournal);
 		
 			virtual ~CModuleHandler ();
 	
-			void registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID);
+			void registerModule (std::shared_ptr<CModule> pModule, uint32_t nJournalGroupID, uint32_t nCycleDivider = 1);
 		
 			void handleModules ();
 		
 			CModule * findModule (const std::string & sName);
+			
+			void setFaultReporter (CFaultReporter * pFaultReporter);
 		
 	};
 
+	// Module resolved by a state handler at registration, see CStateHandler::bindModule
+	typedef struct _sModuleBinding {
+		CModule * m_pModule = nullptr;
+		const std::type_info * m_pModuleType = nullptr;
+	} sModuleBinding;
+
 	class CStateHandler {
 		private:
 	
 		
 		std::map<std::string, std::shared_ptr<CState>> m_States;
+		std::vector<CState *> m_StatesByID;
 		std::shared_ptr<CModuleHandler> m_pModuleHandler;
 		
 		CState * m_pCurrentState;
+		CState * m_pDebugState;
+		bool m_bDebugStateIsWritten;
+		sJournalHandle m_CurrentStateJournalHandle;
+		
+		CState * m_pFaultState;
+		bool m_bIsFaulted;
+		bool m_bIsHalted;
+		eErrorCode m_FaultCode;
+		std::string m_sFaultMessage;
+		sJournalHandle m_FaultedJournalHandle;
+		sJournalHandle m_FaultCodeJournalHandle;
+		
 		char * m_pStateNameDebug;
 		uint32_t m_nStateNameDebugLength;
 		
@@ -463,16 +647,45 @@ namespace BuRCPP {
 		
 		uint32_t m_nJournalGroupID;
 		std::string m_sName;	
+		std::vector<sJournalHandle> m_JournalHandles;
+		uint32_t m_nProfileSectionIndex;
+		uint32_t m_nCycleDivider;
+		uint32_t m_nCycleCountdown;
+		
+		std::vector<sModuleBinding> m_ModuleBindings;
+		
+		const sJournalHandle & findJournalHandle (const uint32_t nEntryID);
+		
+		void addModuleBinding (uint32_t nModuleID, CModule * pModule, const std::type_info & ModuleType);
 		
 		protected:		
 		
-		void addState (std::shared_ptr<CState> pState);
+		uint32_t addState (std::shared_ptr<CState> pState);
+		
+		// Registers a state and checks it against the ID table of the state machine, a reordered registration fails the initialization
+		void addState (std::shared_ptr<CState> pState, uint32_t nExpectedStateID);
+		
+		// The state handler switches to the fault state when one of its states throws. Without a fault state it halts.
+		void setFaultState (uint32_t nStateID);
+		
+		// Resolves a module once at registration. A missing module or a module of the wrong type fails the initialization.
+		template<typename T> void bindModule (uint32_t nModuleID, const std::string & sModuleName)
+		{
+			auto pModule = findModule (sModuleName);
+			if (pModule == nullptr)
+				throw CException (eErrorCode::MODULENOTFOUND, "module has not been found: " + sModuleName);
+			
+			if (dynamic_cast<T *> (pModule) == nullptr)
+				throw CException (eErrorCode::INVALIDMODULETYPE, "invalid module type: " + sModuleName);
+			
+			addModuleBinding (nModuleID, pModule, typeid (T));
+		}
 				
 		
 		
-		void registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
-		void registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID);
-		void registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
+		sJournalHandle registerIntegerValue (const std::string & sEntryName,const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
+		sJournalHandle registerBoolValue (const std::string & sEntryName,const uint32_t nEntryID);
+		sJournalHandle registerDoubleValue (const std::string & sEntryName,const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
 		
 		public:
 	
@@ -482,8 +695,10 @@ namespace BuRCPP {
 	
 		
 		CState * findState (const std::string & sName);
+		CState * getStateByID (uint32_t nStateID);
 		
 		CModule * findModule (const std::string & sName);
+		CModule * getBoundModule (uint32_t nModuleID, const std::type_info & ModuleType);
 				
 		CState * getCurrentState ();
 		
@@ -492,6 +707,7 @@ namespace BuRCPP {
 		std::string getName ();
 				
 		std::shared_ptr<CSignalDefinition> registerSignal (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifetimeInMilliseconds);		
+		std::shared_ptr<CSignalDefinition> registerSignal (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifetimeInMilliseconds, const uint32_t nExpectedSignalID);
 		
 		void setDebugVariables (char * pStateNameDebug, uint32_t nStateNameDebugLength);
 		void writeDebugInformation ();
@@ -502,6 +718,24 @@ namespace BuRCPP {
 		
 		void releaseExpiredSignals ();		
 		
+		void setFault (eErrorCode FaultCode, const std::string & sFaultMessage);
+		void clearFault ();
+		bool isFaulted ();
+		bool isHalted ();
+		eErrorCode getFaultCode ();
+		std::string getFaultMessage ();
+		
+		// True if all bound modules are active and not faulted, so that a fault state may return to normal operation
+		bool boundModulesAreAvailable ();
+		
+		void setProfileSectionIndex (uint32_t nProfileSectionIndex);
+		uint32_t getProfileSectionIndex ();
+		
+		// The state handler is executed every nCycleDivider-th cycle, starting with the cycle nCyclePhase.
+		void setCycleSchedule (uint32_t nCycleDivider, uint32_t nCyclePhase);
+		uint32_t getCycleDivider ();
+		bool advanceCycleSchedule ();
+		
 		void setIntegerValue (const uint32_t nEntryID, int64_t nValue);
 		void setBoolValue (const uint32_t nEntryID, bool bValue);
 		void setDoubleValue (const uint32_t nEntryID, double dValue);
@@ -517,6 +751,14 @@ namespace BuRCPP {
 		uint16_t getUint16Value (const uint32_t nEntryID);
 		uint8_t getUint8Value (const uint32_t nEntryID);
 		
+		void setIntegerValue (const sJournalHandle & Handle, int64_t nValue);
+		void setBoolValue (const sJournalHandle & Handle, bool bValue);
+		void setDoubleValue (const sJournalHandle & Handle, double dValue);
+		
+		bool getBoolValue (const sJournalHandle & Handle);
+		double getDoubleValue (const sJournalHandle & Handle);
+		int64_t getInt64Value (const sJournalHandle & Handle);
+		int32_t getInt32Value (const sJournalHandle & Handle);
 		
 	};
 
@@ -533,6 +775,19 @@ namespace BuRCPP {
 		
 		public:
 	
+		ioModuleAccess (CEnvironment * pEnvironment, uint32_t nModuleID)
+			: m_Module (nullptr)
+		{
+			// The module type has been checked when binding, so no lookup or dynamic cast is needed here
+			auto pModule = pEnvironment->getBoundModule (nModuleID, typeid (T));
+			if (!pModule->isActive ())
+				throw CException (eErrorCode::MODULENOTACTIVE, "module not active: " + pModule->getName ());
+			if (pModule->isFaulted ())
+				throw CException (eErrorCode::MODULEISFAULTED, "module is faulted: " + pModule->getName ());
+			
+			m_Module = static_cast<T *> (pModule);
+		}
+		
 		ioModuleAccess (CEnvironment * pEnvironment, const std::string & sModuleName)
 			: m_Module (nullptr)
 		{
@@ -551,6 +806,8 @@ namespace BuRCPP {
 			} else 
 				throw CException (eErrorCode::MODULENOTACTIVE, "module not active: " + sModuleName);
 			
+			if (pModule->isFaulted ())
+				throw CException (eErrorCode::MODULEISFAULTED, "module is faulted: " + sModuleName);
 			
 		}
 		
@@ -0,0 +1,141 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "HeapMonitor.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// The counters are not atomic, the program runs its initialization and cyclic code in one task.
+static uint64_t g_nHeapAllocationCount = 0;
+static uint64_t g_nHeapDeallocationCount = 0;
+static uint64_t g_nHeapAllocatedBytes = 0;
+
+namespace BuRCPP {
+
+	uint64_t CHeapMonitor::getAllocationCount ()
+	{
+		return g_nHeapAllocationCount;
+	}
+	
+	uint64_t CHeapMonitor::getDeallocationCount ()
+	{
+		return g_nHeapDeallocationCount;
+	}
+	
+	uint64_t CHeapMonitor::getAllocatedBytes ()
+	{
+		return g_nHeapAllocatedBytes;
+	}
+
+}
+
+#ifndef HEAPMONITOR_DISABLED
+
+static void * countedAllocate (std::size_t nSize)
+{
+	g_nHeapAllocationCount++;
+	g_nHeapAllocatedBytes += nSize;
+	
+	if (nSize == 0)
+		nSize = 1;
+	
+	return std::malloc (nSize);
+}
+
+static void countedFree (void * pMemory)
+{
+	if (pMemory != nullptr) {
+		g_nHeapDeallocationCount++;
+		std::free (pMemory);
+	}
+}
+
+void * operator new (std::size_t nSize)
+{
+	void * pMemory = countedAllocate (nSize);
+	if (pMemory == nullptr)
+		throw std::bad_alloc ();
+	
+	return pMemory;
+}
+
+void * operator new[] (std::size_t nSize)
+{
+	void * pMemory = countedAllocate (nSize);
+	if (pMemory == nullptr)
+		throw std::bad_alloc ();
+	
+	return pMemory;
+}
+
+void * operator new (std::size_t nSize, const std::nothrow_t &) noexcept
+{
+	return countedAllocate (nSize);
+}
+
+void * operator new[] (std::size_t nSize, const std::nothrow_t &) noexcept
+{
+	return countedAllocate (nSize);
+}
+
+void operator delete (void * pMemory) noexcept
+{
+	countedFree (pMemory);
+}
+
+void operator delete[] (void * pMemory) noexcept
+{
+	countedFree (pMemory);
+}
+
+void operator delete (void * pMemory, std::size_t) noexcept
+{
+	countedFree (pMemory);
+}
+
+void operator delete[] (void * pMemory, std::size_t) noexcept
+{
+	countedFree (pMemory);
+}
+
+void operator delete (void * pMemory, const std::nothrow_t &) noexcept
+{
+	countedFree (pMemory);
+}
+
+void operator delete[] (void * pMemory, const std::nothrow_t &) noexcept
+{
+	countedFree (pMemory);
+}
+
+#endif //HEAPMONITOR_DISABLED
@@ -56,6 +56,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define JOURNAL_TCPSTREAMENTRYSIGNATURE_ENTRYLISTSIZE 0xD0000000
 #define JOURNAL_TCPSTREAMENTRYSIGNATURE_GROUPID 0xE0000000
 
+// Worst case size of a streamed history record: 10 bytes timestamp delta, 5 bytes key, 8 bytes value
+#define JOURNAL_STREAMMAXRECORDSIZE 23
+
 namespace BuRCPP {
 
 	
@@ -186,9 +189,86 @@ class CTcpPacketHandler_RetrieveJournalVariable : public CTcpPacketHandler_Direc
 	};
 
 
+class CTcpPacketHandler_DeltaJournalStatus : public CTcpPacketHandler_Direct {
+	private:
+	CJournal* m_pJournal;
+			
+	public: 
+					
+	CTcpPacketHandler_DeltaJournalStatus (CJournal * pJournal)
+		: CTcpPacketHandler_Direct (), m_pJournal (pJournal)
+	{
+		if (pJournal == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");		
+	}
+					
+	virtual ~CTcpPacketHandler_DeltaJournalStatus ()
+	{
+	}
+		
+	virtual uint32_t getCommandID () override
+	{
+		return COMMAND_DEFAULT_DELTAJOURNALSTATUS;
+	}
+							
+	void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+	{
+		uint32_t nGeneration = readUint32FromPayload (pPayload, 0);
+		uint32_t nChangeSequence = readUint32FromPayload (pPayload, 4);
+		
+		m_pJournal->writeDeltaStatusToTCPResponse (pResponse, nGeneration, nChangeSequence);
+	}
+
+};
+
+
+class CTcpPacketHandler_StreamJournalHistory : public CTcpPacketHandler_Direct {
+	private:
+	CJournal* m_pJournal;
+			
+	public: 
+					
+	CTcpPacketHandler_StreamJournalHistory (CJournal * pJournal)
+		: CTcpPacketHandler_Direct (), m_pJournal (pJournal)
+	{
+		if (pJournal == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid journal parameter");		
+	}
+					
+	virtual ~CTcpPacketHandler_StreamJournalHistory ()
+	{
+	}
+		
+	virtual uint32_t getCommandID () override
+	{
+		return COMMAND_DEFAULT_STREAMJOURNALHISTORY;
+	}
+							
+	void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+	{
+		m_pJournal->streamJournalHistory (pResponse);
+	}
+
+};
+	
+	
+static uint32_t writeVarUint (uint8_t * pTarget, uint64_t nValue)
+{
+	uint32_t nSize = 0;
+	while (nValue >= 0x80) {
+		pTarget[nSize] = (uint8_t) (nValue | 0x80);
+		nValue >>= 7;
+		nSize++;
+	}
+	pTarget[nSize] = (uint8_t) nValue;
+	
+	return nSize + 1;
+}
+
+
 
 CJournalData::CJournalData (std::shared_ptr<CSystemInfo> pSystemInfo)
-  : m_nRingBufferHead (0), m_nRingBufferTail (0), m_nRingBufferSize (0), m_nJournalOverFlowCounter (0), m_pSystemInfo (pSystemInfo)
+  : m_nRingBufferHead (0), m_nRingBufferTail (0), m_nRingBufferSize (0), m_pSystemInfo (pSystemInfo), m_nJournalOverFlowCounter (0), m_nPendingGapCount (0), m_nChangeSequence (JOURNAL_INITIALCHANGESEQUENCE), m_nGeneration (0)
 {
 	if (pSystemInfo.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid system info parameter");
@@ -200,8 +280,11 @@ CJournalData::CJournalData (uint32_t nCurrentValueSize, uint32_t nRingBufferSize
   :  m_nRingBufferHead (0), 
 	m_nRingBufferTail (0), 
 	m_nRingBufferSize (nRingBufferSize), 
+	m_pSystemInfo (pSystemInfo),
 	m_nJournalOverFlowCounter (0), 
-	m_pSystemInfo (pSystemInfo)
+	m_nPendingGapCount (0),
+	m_nChangeSequence (JOURNAL_INITIALCHANGESEQUENCE),
+	m_nGeneration (0)
 
 {
 	if (nCurrentValueSize == 0)
@@ -211,11 +294,14 @@ CJournalData::CJournalData (uint32_t nCurrentValueSize, uint32_t nRingBufferSize
 	if (pSystemInfo.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid system info parameter");
 
-	m_CurrentValueBuffer.resize (nCurrentValueSize);
-	for (auto & it : m_CurrentValueBuffer)
-		it = 0;
+	uint32_t nSlotCount = (nCurrentValueSize + JOURNAL_MAXENTRYSIZE - 1) / JOURNAL_MAXENTRYSIZE;
+	m_CurrentValueSlots.resize (nSlotCount, 0);
 
 	m_JournalRingBuffer.resize (m_nRingBufferSize);
+	
+	// The start time register differs between restarts and lets clients detect a fresh journal
+	m_ChangeSequences.resize (nSlotCount, JOURNAL_INITIALCHANGESEQUENCE);
+	m_nGeneration = pSystemInfo->getStartSystemTime ();
 
 	clearRingBuffer ();
 }
@@ -227,63 +313,68 @@ CJournalData::~CJournalData ()
 		
 void CJournalData::readData (uint32_t nAddress, uint8_t * pTarget, uint32_t nSize) const
 {
-	if (nAddress >  JOURNAL_MAXSIZE)
+	if ((nAddress > JOURNAL_MAXSIZE) || ((nAddress % JOURNAL_MAXENTRYSIZE) != 0))
 		throw CException (eErrorCode::INVALIDJOURNALADDRESS, "invalid journal address");
-	if (nSize > JOURNAL_MAXSIZE)
+	if (nSize > JOURNAL_MAXENTRYSIZE)
 		throw CException (eErrorCode::INVALIDJOURNALENTRYSIZE, "invalid journal entry size");
 	
-	
-	if (nAddress + nSize > m_CurrentValueBuffer.size ())
+	uint32_t nSlotIndex = nAddress / JOURNAL_MAXENTRYSIZE;
+	if (nSlotIndex >= m_CurrentValueSlots.size ())
 		throw CException (eErrorCode::JOURNALDATABUFFEROVERRUN, "journal data buffer overrun");
 	if (pTarget == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid memory target");
 	
-	for (uint32_t nIndex = 0; nIndex < nSize; nIndex++)
-		pTarget[nIndex] = m_CurrentValueBuffer.at (nAddress + nIndex);
+	memcpy (pTarget, &m_CurrentValueSlots[nSlotIndex], nSize);
 	
 }
 
 void CJournalData::writeData (uint32_t nAddress, uint32_t nGroupID, uint32_t nEntryID, uint8_t * pSource, uint32_t nSize)
 {
-	if (nAddress >  JOURNAL_MAXSIZE)
+	if ((nAddress > JOURNAL_MAXSIZE) || ((nAddress % JOURNAL_MAXENTRYSIZE) != 0))
 		throw CException (eErrorCode::INVALIDJOURNALADDRESS, "invalid journal address");
 	if (nSize > JOURNAL_MAXENTRYSIZE)
 		throw CException (eErrorCode::INVALIDJOURNALENTRYSIZE, "invalid journal entry size");
 	
-	size_t nBufferSize = m_CurrentValueBuffer.size ();
-	if (nAddress + nSize > nBufferSize)
+	uint32_t nSlotIndex = nAddress / JOURNAL_MAXENTRYSIZE;
+	if (nSlotIndex >= m_CurrentValueSlots.size ())
 		throw CException (eErrorCode::JOURNALDATABUFFEROVERRUN, "journal data buffer overrun");
 	if (pSource == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid memory target");
 
-	bool bHasChange = false;
-	for (uint32_t nIndex = 0; nIndex < nSize; nIndex++) {
-		uint8_t* pTargetByte = &m_CurrentValueBuffer.at (nAddress + nIndex);
-		uint8_t nSource = pSource[nIndex];
+	// Values are zero extended into their slot, so a single word compare detects any change.
+	uint64_t nNewValue = 0;
+	memcpy (&nNewValue, pSource, nSize);
+	
+	uint64_t & nSlotValue = m_CurrentValueSlots[nSlotIndex];
+	if (nSlotValue == nNewValue)
+		return;
+	
+	nSlotValue = nNewValue;
+	
+	if (m_nChangeSequence == UINT32_MAX)
+		resetChangeSequences ();
+	m_nChangeSequence++;
+	m_ChangeSequences[nSlotIndex] = m_nChangeSequence;
 
-		if (*pTargetByte != nSource) {
-			*pTargetByte = nSource;
-			bHasChange = true;
-		}
+	if ((m_nPendingGapCount > 0) && (!ringBufferIsFull ())) {
+		sJournalEntry * pGapEntry = pushRingBufferEntry ();
+		pGapEntry->m_nTimeStampInMicroseconds = m_pSystemInfo->getSystemTimeInMicroseconds ();
+		pGapEntry->m_nGroupID = JOURNAL_GAPMARKERGROUPID;
+		pGapEntry->m_nEntryID = 0;
+		memcpy (pGapEntry->m_nBuffer, &m_nPendingGapCount, JOURNAL_MAXENTRYSIZE);
+		
+		m_nPendingGapCount = 0;
 	}
 
-	if (bHasChange) {
-
-		if (!ringBufferIsFull ()) {
-			sJournalEntry * pJournalEntry = pushRingBufferEntry ();
-			pJournalEntry->m_nTimeStampInMicroseconds = m_pSystemInfo->getSystemTimeInMicroseconds ();
-			pJournalEntry->m_nGroupID = (uint16_t) nGroupID;
-			pJournalEntry->m_nEntryID = (uint16_t) nEntryID;
-
-			for (uint32_t nIndex = 0; nIndex < nSize; nIndex++) {
-				pJournalEntry->m_nBuffer[nIndex] = pSource[nIndex];
-			}
-
-			for (uint32_t nIndex = nSize; nIndex < JOURNAL_MAXENTRYSIZE; nIndex++)
-				pJournalEntry->m_nBuffer[nIndex] = 0;
-		} else {
-			m_nJournalOverFlowCounter++;
-		}
+	if (!ringBufferIsFull ()) {
+		sJournalEntry * pJournalEntry = pushRingBufferEntry ();
+		pJournalEntry->m_nTimeStampInMicroseconds = m_pSystemInfo->getSystemTimeInMicroseconds ();
+		pJournalEntry->m_nGroupID = (uint16_t) nGroupID;
+		pJournalEntry->m_nEntryID = (uint16_t) nEntryID;
+		memcpy (pJournalEntry->m_nBuffer, &nNewValue, JOURNAL_MAXENTRYSIZE);
+	} else {
+		m_nJournalOverFlowCounter++;
+		m_nPendingGapCount++;
 	}
 }
 
@@ -292,6 +383,7 @@ void CJournalData::clearRingBuffer ()
 	m_nRingBufferHead = 0;
 	m_nRingBufferTail = m_nRingBufferSize - 1;
 	m_nJournalOverFlowCounter = 0;
+	m_nPendingGapCount = 0;
 }
 		
 bool CJournalData::ringBufferIsFull ()
@@ -324,6 +416,35 @@ uint32_t CJournalData::getOverFlowCounter ()
 	return m_nJournalOverFlowCounter;
 }
 
+uint32_t CJournalData::getGeneration () const
+{
+	return m_nGeneration;
+}
+
+uint32_t CJournalData::getChangeSequence () const
+{
+	return m_nChangeSequence;
+}
+
+uint32_t CJournalData::getChangeSequence (uint32_t nAddress) const
+{
+	uint32_t nSlotIndex = nAddress / JOURNAL_MAXENTRYSIZE;
+	if (nSlotIndex >= m_ChangeSequences.size ())
+		throw CException (eErrorCode::INVALIDJOURNALADDRESS, "invalid journal address");
+	
+	return m_ChangeSequences[nSlotIndex];
+}
+
+void CJournalData::resetChangeSequences ()
+{
+	// Sequence numbers wrapped around, start a new generation so clients request a full status
+	for (auto & it : m_ChangeSequences)
+		it = JOURNAL_INITIALCHANGESEQUENCE;
+	
+	m_nChangeSequence = JOURNAL_INITIALCHANGESEQUENCE;
+	m_nGeneration++;
+}
+
 
 
 sJournalEntry * CJournalData::popRingBufferEntry ()
@@ -398,6 +519,11 @@ sJournalEntry * CJournalData::pushRingBufferEntry ()
 		m_nAddress = nAddress;
 	}
 	
+	bool CJournalEntryDefinition::hasChangedSince (const CJournalData & JournalData, uint32_t nChangeSequence)
+	{
+		return JournalData.getChangeSequence ((uint32_t) m_nAddress) > nChangeSequence;
+	}
+	
 	CJournalEntryIntegerDefinition::CJournalEntryIntegerDefinition (uint32_t nGroupID, uint32_t nEntryID, const std::string & sName, int64_t nMinimum, int64_t nMaximum)
 		: CJournalEntryDefinition (nGroupID, nEntryID, sName), m_nMinimum (nMinimum), m_nMaximum (nMaximum)
 	{
@@ -617,19 +743,6 @@ sJournalEntry * CJournalData::pushRingBufferEntry ()
 	
 		
 
-	size_t CJournalGroup::calculateDataAddresses (size_t nBaseOffset)
-	{
-		size_t nSize = 0;
-		for (auto iIter : m_EntryDefinitionsByID) {
-			size_t nEntrySize = iIter.second->getDataSize ();
-			iIter.second->setAddress (nBaseOffset + nSize);
-			nSize += nEntrySize;
-			
-		}
-		
-		return nSize;
-	}	
-		
 	CJournalEntryDefinition* CJournalGroup::findEntryByID (uint32_t nEntryID, bool bMustExist)
 	{
 		auto iIter = m_EntryDefinitionsByID.find (nEntryID);
@@ -735,6 +848,31 @@ void CJournalGroup::writeVariableToTCPResponse (CTcpPacketResponse * pResponse,
 }
 
 
+bool CJournalGroup::writeDeltaStatusToTCPResponse (CTcpPacketResponse * pResponse, const CJournalData & JournalData, uint32_t nChangeSequence)
+{
+	if (pResponse == nullptr) 
+		throw CException (eErrorCode::INVALIDPARAM, "invalid packet response parameter");
+	
+	uint32_t nChangedEntryCount = 0;
+	for (auto nEntryIter : m_EntryDefinitionsByID) {
+		if (nEntryIter.second->hasChangedSince (JournalData, nChangeSequence))
+			nChangedEntryCount++;
+	}
+	
+	if (nChangedEntryCount == 0)
+		return false;
+	
+	pResponse->addUint32 (m_nGroupID | JOURNAL_TCPSTREAMENTRYSIGNATURE_GROUPID);
+	pResponse->addUint32 (nChangedEntryCount | JOURNAL_TCPSTREAMENTRYSIGNATURE_ENTRYLISTSIZE);
+	
+	for (auto nEntryIter : m_EntryDefinitionsByID) {
+		if (nEntryIter.second->hasChangedSince (JournalData, nChangeSequence))
+			nEntryIter.second->writeStatusToTCPResponse (pResponse, JournalData);
+	}
+	
+	return true;
+}
+
 
 void CJournalGroup::buildSchemaJSON (std::stringstream & jsonStream)
 {
@@ -761,7 +899,7 @@ void CJournalGroup::buildSchemaJSON (std::stringstream & jsonStream)
 
 	
 CJournal::CJournal (uint32_t nRingBufferSize, std::shared_ptr<CSystemInfo> pSystemInfo)
-	: m_bIsInitializing (true), m_nRingBufferSize (nRingBufferSize), m_pSystemInfo (pSystemInfo), m_JournalData (pSystemInfo)
+	: m_bIsInitializing (true), m_JournalData (pSystemInfo), m_nRingBufferSize (nRingBufferSize), m_pSystemInfo (pSystemInfo), m_nCurrentValueSize (0)
 {
 	if (nRingBufferSize == 0)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid journal ring buffer size");
@@ -821,39 +959,50 @@ CJournalGroup* CJournal::findGroupByName (const std::string & sGroupName, bool b
 }
 	
 	
-void CJournal::registerIntegerValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
+sJournalHandle CJournal::registerEntry (std::shared_ptr<CJournalEntryDefinition> pEntry, eJournalValueType ValueType)
 {
 	if (!m_bIsInitializing)
 		throw CException (eErrorCode::JOURNALISNOTINITIALIZING, "journal is not initializing");
-
-		
-	auto pGroup = findGroupByID (nGroupID, true);
-		
-	auto pEntry = std::make_shared<CJournalEntryIntegerDefinition> (nGroupID, nEntryID, sEntryName, nMinValue, nMaxValue);		
-	pGroup->addEntry (pEntry);
-		
-}
 	
-void CJournal::registerBoolValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID)
-{
-	if (!m_bIsInitializing)
-		throw CException (eErrorCode::JOURNALISNOTINITIALIZING, "journal is not initializing");
+	auto pGroup = findGroupByID (pEntry->getGroupID (), true);
 	
-	auto pGroup = findGroupByID (nGroupID, true);
+	if (pEntry->getDataSize () > JOURNAL_MAXENTRYSIZE)
+		throw CException (eErrorCode::INVALIDJOURNALENTRYSIZE, "invalid journal entry size: " + pEntry->getName ());
+	if (m_nCurrentValueSize + JOURNAL_MAXENTRYSIZE > JOURNAL_MAXSIZE)
+		throw CException (eErrorCode::INVALIDJOURNALADDRESS, "journal exceeds maximum size: " + pEntry->getName ());
 	
-	auto pEntry = std::make_shared<CJournalEntryBoolDefinition> (nGroupID, nEntryID, sEntryName);		
 	pGroup->addEntry (pEntry);
+	
+	// Addresses are assigned in registration order, so that the handle is final as soon as it is returned.
+	// Every value occupies an aligned slot of JOURNAL_MAXENTRYSIZE bytes.
+	pEntry->setAddress (m_nCurrentValueSize);
+	m_nCurrentValueSize += JOURNAL_MAXENTRYSIZE;
+	
+	sJournalHandle Handle;
+	Handle.m_nAddress = (uint32_t) pEntry->getAddress ();
+	Handle.m_nGroupID = (uint16_t) pEntry->getGroupID ();
+	Handle.m_nEntryID = (uint16_t) pEntry->getEntryID ();
+	Handle.m_ValueType = ValueType;
+	
+	return Handle;
 }
 	
-void CJournal::registerDoubleValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
+sJournalHandle CJournal::registerIntegerValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue)
 {
-	if (!m_bIsInitializing)
-		throw CException (eErrorCode::JOURNALISNOTINITIALIZING, "journal is not initializing");
+	auto pEntry = std::make_shared<CJournalEntryIntegerDefinition> (nGroupID, nEntryID, sEntryName, nMinValue, nMaxValue);		
+	return registerEntry (pEntry, eJournalValueType::Integer);
+}
 	
-	auto pGroup = findGroupByID (nGroupID, true);
+sJournalHandle CJournal::registerBoolValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID)
+{
+	auto pEntry = std::make_shared<CJournalEntryBoolDefinition> (nGroupID, nEntryID, sEntryName);		
+	return registerEntry (pEntry, eJournalValueType::Bool);
+}
 	
+sJournalHandle CJournal::registerDoubleValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps)
+{
 	auto pEntry = std::make_shared<CJournalEntryDoubleDefinition> (nGroupID, nEntryID, sEntryName, dMinValue, dMaxValue, nQuantizationSteps);		
-	pGroup->addEntry (pEntry);
+	return registerEntry (pEntry, eJournalValueType::Double);
 }
 	
 		
@@ -862,16 +1011,10 @@ void CJournal::prepareJournal ()
 	if (!m_bIsInitializing)
 		throw CException (eErrorCode::JOURNALISNOTINITIALIZING, "journal is not initializing");
 
-	size_t nCurrentValueSize = 0;
-	for (auto iIter : m_GroupIDMap) {
-		size_t nGroupDataSize = iIter.second->calculateDataAddresses (nCurrentValueSize);
-		nCurrentValueSize += nGroupDataSize;
-	}
-		
-	if (nCurrentValueSize == 0)
+	if (m_nCurrentValueSize == 0)
 		throw CException (eErrorCode::EMPTYJOURNALNOTALLOWED, "an empty journal is not allowed");
 		
-	m_JournalData = CJournalData (nCurrentValueSize, m_nRingBufferSize, m_pSystemInfo);
+	m_JournalData = CJournalData (m_nCurrentValueSize, m_nRingBufferSize, m_pSystemInfo);
 	
 	
 	std::stringstream schemaStream;
@@ -1046,6 +1189,147 @@ uint8_t CJournal::getUint8Value (const uint32_t nGroupID, const uint32_t nEntryI
 	return (uint8_t) nValue;
 }
 		
+void CJournal::setIntegerValue (const sJournalHandle & Handle, int64_t nValue)
+{
+	if (Handle.m_ValueType != eJournalValueType::Integer) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type integer: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	m_JournalData.writeData (Handle.m_nAddress, Handle.m_nGroupID, Handle.m_nEntryID, (uint8_t*) &nValue, 8);
+}
+	
+void CJournal::setBoolValue (const sJournalHandle & Handle, bool bValue)
+{
+	if (Handle.m_ValueType != eJournalValueType::Bool) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type bool: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	uint8_t nValue = bValue ? 1 : 0;
+	m_JournalData.writeData (Handle.m_nAddress, Handle.m_nGroupID, Handle.m_nEntryID, &nValue, 1);
+}
+	
+void CJournal::setDoubleValue (const sJournalHandle & Handle, double dValue)
+{
+	if (Handle.m_ValueType != eJournalValueType::Double) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type double: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	m_JournalData.writeData (Handle.m_nAddress, Handle.m_nGroupID, Handle.m_nEntryID, (uint8_t*) &dValue, 8);
+}
+	
+bool CJournal::getBoolValue (const sJournalHandle & Handle)
+{
+	if (Handle.m_ValueType != eJournalValueType::Bool) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type bool: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	uint8_t nValue = 0;
+	m_JournalData.readData (Handle.m_nAddress, &nValue, 1);
+	return nValue != 0;
+}
+	
+double CJournal::getDoubleValue (const sJournalHandle & Handle)
+{
+	if (Handle.m_ValueType != eJournalValueType::Double) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type double: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	double dValue = 0.0;
+	m_JournalData.readData (Handle.m_nAddress, (uint8_t*) &dValue, 8);
+	return dValue;
+}
+	
+int64_t CJournal::readIntegerValue (const sJournalHandle & Handle)
+{
+	if (Handle.m_ValueType != eJournalValueType::Integer) {
+		if (Handle.m_ValueType == eJournalValueType::Unknown)
+			throw CException (eErrorCode::INVALIDJOURNALHANDLE, "invalid journal handle");
+		throw CException (eErrorCode::JOURNALENTRYTYPEMISMATCH, "journal handle is not of type integer: " + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	}
+	
+	int64_t nValue = 0;
+	m_JournalData.readData (Handle.m_nAddress, (uint8_t*) &nValue, 8);
+	return nValue;
+}
+	
+int64_t CJournal::getInt64Value (const sJournalHandle & Handle)
+{
+	return readIntegerValue (Handle);
+}
+	
+int32_t CJournal::getInt32Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > INT32_MAX) || (nValue < INT32_MIN))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (int32_t) nValue;
+}
+	
+int16_t CJournal::getInt16Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > INT16_MAX) || (nValue < INT16_MIN))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (int16_t) nValue;
+}
+	
+int8_t CJournal::getInt8Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > INT8_MAX) || (nValue < INT8_MIN))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (int8_t) nValue;
+}
+	
+uint64_t CJournal::getUint64Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if (nValue < 0)
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (uint64_t) nValue;
+}
+	
+uint32_t CJournal::getUint32Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > UINT32_MAX) || (nValue < 0))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (uint32_t) nValue;
+}
+	
+uint16_t CJournal::getUint16Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > UINT16_MAX) || (nValue < 0))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (uint16_t) nValue;
+}
+	
+uint8_t CJournal::getUint8Value (const sJournalHandle & Handle)
+{
+	int64_t nValue = readIntegerValue (Handle);
+	if ((nValue > UINT8_MAX) || (nValue < 0))
+		throw CException (eErrorCode::JOURNALVALUEOUTSIDEOFRANGE, "journal value outside of range:" + std::to_string (Handle.m_nGroupID) + "/" + std::to_string (Handle.m_nEntryID));
+	
+	return (uint8_t) nValue;
+}
+		
 void CJournal::registerDefaultCommands (CTcpPacketRegistry * pPacketRegistry)
 {
 	if (pPacketRegistry == nullptr) 
@@ -1055,6 +1339,8 @@ void CJournal::registerDefaultCommands (CTcpPacketRegistry * pPacketRegistry)
 	pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_CurrentJournalSchema> (this));
 	pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_RetrieveJournalVariable> (this));
 	pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_RetrieveJournalHistory> (this));
+	pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_StreamJournalHistory> (this));
+	pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_DeltaJournalStatus> (this));
 	
 }
 
@@ -1070,6 +1356,33 @@ void CJournal::writeStatusToTCPResponse (CTcpPacketResponse * pResponse)
 		
 }
 
+/* Writes only the values that changed since the given change sequence, in the same layout as the full status.
+   The response starts with the current generation and change sequence, which the client passes back with the next request.
+   If the generation does not match, e.g. after a restart, all values are sent. */
+void CJournal::writeDeltaStatusToTCPResponse (CTcpPacketResponse * pResponse, uint32_t nGeneration, uint32_t nChangeSequence)
+{
+	if (pResponse == nullptr) 
+		throw CException (eErrorCode::INVALIDPARAM, "invalid packet response parameter");
+	
+	uint32_t nCurrentChangeSequence = m_JournalData.getChangeSequence ();
+	if ((nGeneration != m_JournalData.getGeneration ()) || (nChangeSequence > nCurrentChangeSequence))
+		nChangeSequence = 0;
+	
+	pResponse->addUint32 (m_JournalData.getGeneration ());
+	pResponse->addUint32 (nCurrentChangeSequence);
+	
+	uint32_t nGroupCountOffset = pResponse->getCurrentSize ();
+	pResponse->addUint32 (0);
+	
+	uint32_t nChangedGroupCount = 0;
+	for (auto groupIter : m_GroupIDMap) {
+		if (groupIter.second->writeDeltaStatusToTCPResponse (pResponse, m_JournalData, nChangeSequence))
+			nChangedGroupCount++;
+	}
+	
+	pResponse->writeUint32 (nGroupCountOffset, nChangedGroupCount | JOURNAL_TCPSTREAMENTRYSIGNATURE_GROUPLISTSIZE);
+}
+
 void CJournal::writeVariableToTCPResponse (CTcpPacketResponse * pResponse, uint32_t nGroupId, uint32_t nEntryId)
 {
 	if (pResponse == nullptr) 
@@ -1113,6 +1426,9 @@ void CJournal::retrieveJournalHistory (CTcpPacketResponse * pResponse)
 
 	while ((!m_JournalData.ringBufferIsEmpty ()) && (nMaxEntriesToSend > 0)) {
 		auto pEntry = m_JournalData.popRingBufferEntry ();
+		if (pEntry->m_nGroupID == JOURNAL_GAPMARKERGROUPID)
+			continue;
+			
 		pResponse->addUint32 (pEntry->m_nTimeStampInMicroseconds);
 		pResponse->addUint16 ((uint16_t)pEntry->m_nGroupID);
 		pResponse->addUint16 ((uint16_t)pEntry->m_nEntryID);
@@ -1123,5 +1439,50 @@ void CJournal::retrieveJournalHistory (CTcpPacketResponse * pResponse)
 
 }
 
+/* Streams as many history entries as fit into one response.
+   Header: uint32 entry count, uint32 entries still pending, uint32 overflow counter.
+   Each entry: varint timestamp delta in microseconds (the first entry is relative to 0),
+   varint key ((groupID << 15 | entryID) << 4 | value length), value bytes without trailing zero bytes.
+   A key with group ID JOURNAL_GAPMARKERGROUPID reports the number of entries lost at this point. */
+void CJournal::streamJournalHistory (CTcpPacketResponse * pResponse)
+{
+	if (pResponse == nullptr) 
+		throw CException (eErrorCode::INVALIDPARAM, "invalid packet response parameter");
+	
+	uint32_t nHeaderOffset = pResponse->getCurrentSize ();
+	pResponse->addUint32 (0);
+	pResponse->addUint32 (0);
+	pResponse->addUint32 (m_JournalData.getOverFlowCounter ());
+	
+	uint8_t Record[JOURNAL_STREAMMAXRECORDSIZE];
+	uint64_t nPreviousTimeStamp = 0;
+	uint32_t nEntryCount = 0;
+	
+	while ((!m_JournalData.ringBufferIsEmpty ()) && (pResponse->getRemainingSize () >= JOURNAL_STREAMMAXRECORDSIZE)) {
+		auto pEntry = m_JournalData.popRingBufferEntry ();
+		
+		uint64_t nTimeStamp = pEntry->m_nTimeStampInMicroseconds;
+		uint64_t nTimeDelta = (nTimeStamp > nPreviousTimeStamp) ? (nTimeStamp - nPreviousTimeStamp) : 0;
+		nPreviousTimeStamp = nTimeStamp;
+		
+		uint32_t nValueLength = JOURNAL_MAXENTRYSIZE;
+		while ((nValueLength > 0) && (pEntry->m_nBuffer[nValueLength - 1] == 0))
+			nValueLength--;
+		
+		uint64_t nKey = ((((uint64_t) pEntry->m_nGroupID << 15) | pEntry->m_nEntryID) << 4) | nValueLength;
+		
+		uint32_t nRecordSize = writeVarUint (Record, nTimeDelta);
+		nRecordSize += writeVarUint (&Record[nRecordSize], nKey);
+		memcpy (&Record[nRecordSize], pEntry->m_nBuffer, nValueLength);
+		nRecordSize += nValueLength;
+		
+		pResponse->addPayload (Record, nRecordSize);
+		nEntryCount++;
+	}
+	
+	pResponse->writeUint32 (nHeaderOffset, nEntryCount);
+	pResponse->writeUint32 (nHeaderOffset + 4, m_JournalData.getBufferEntryCount ());
+}
+
 
 }	
@@ -47,6 +47,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define JOURNAL_MAXSIZE (16* 1024 * 1024)
 #define JOURNAL_MAXENTRYSIZE 8
 
+// Ring buffer entries with this group ID mark a gap of lost entries. The buffer holds the number of lost entries.
+#define JOURNAL_GAPMARKERGROUPID 0
+
+// Change sequence that all values carry after the journal has been prepared
+#define JOURNAL_INITIALCHANGESEQUENCE 1
+
 namespace BuRCPP 
 {
 	class CTcpPacketRegistry;
@@ -61,7 +67,8 @@ namespace BuRCPP
 
 	class CJournalData {
 		private:
-		std::vector<uint8_t> m_CurrentValueBuffer;
+		// One aligned slot of JOURNAL_MAXENTRYSIZE bytes per value
+		std::vector<uint64_t> m_CurrentValueSlots;
 
 		std::vector<sJournalEntry> m_JournalRingBuffer;
 		uint32_t m_nRingBufferHead;
@@ -71,6 +78,14 @@ namespace BuRCPP
 		std::shared_ptr<CSystemInfo> m_pSystemInfo;
 
 		uint32_t m_nJournalOverFlowCounter;
+		uint64_t m_nPendingGapCount;
+		
+		// Change sequence of the last write per value slot
+		std::vector<uint32_t> m_ChangeSequences;
+		uint32_t m_nChangeSequence;
+		uint32_t m_nGeneration;
+		
+		void resetChangeSequences ();
 
 		public:
 		CJournalData (std::shared_ptr<CSystemInfo> pSystemInfo);
@@ -86,6 +101,10 @@ namespace BuRCPP
 		
 		uint32_t getBufferEntryCount ();
 		uint32_t getOverFlowCounter ();
+		
+		uint32_t getGeneration () const;
+		uint32_t getChangeSequence () const;
+		uint32_t getChangeSequence (uint32_t nAddress) const;
 
 		sJournalEntry * popRingBufferEntry ();
 		sJournalEntry * pushRingBufferEntry ();
@@ -113,6 +132,8 @@ namespace BuRCPP
 		size_t getAddress ();
 		void setAddress (size_t nAddress);
 		
+		bool hasChangedSince (const CJournalData & JournalData, uint32_t nChangeSequence);
+		
 		virtual void writeStatusToTCPResponse (CTcpPacketResponse * pResponse, const CJournalData & JournalData) = 0;
 		virtual void buildSchemaJSON (std::stringstream & jsonStream) = 0;
 
@@ -205,8 +226,6 @@ namespace BuRCPP
 		void addEntry (std::shared_ptr<CJournalEntryDefinition> pDefinition);
 		CJournalEntryDefinition* findEntryByID (uint32_t nEntryID, bool bMustExist);
 		
-		size_t calculateDataAddresses (size_t nBaseOffset);
-		
 		int64_t readIntegerValue (const CJournalData & JournalData, uint32_t nEntryID);
 		double readDoubleValue (const CJournalData & JournalData, uint32_t nEntryID);
 		bool readBoolValue (const CJournalData & JournalData, uint32_t nEntryID);
@@ -217,6 +236,7 @@ namespace BuRCPP
 		
 		void writeStatusToTCPResponse (CTcpPacketResponse * pResponse, const CJournalData & JournalData);
 		void writeVariableToTCPResponse (CTcpPacketResponse * pResponse, const CJournalData & JournalData, uint32_t nEntryId);	
+		bool writeDeltaStatusToTCPResponse (CTcpPacketResponse * pResponse, const CJournalData & JournalData, uint32_t nChangeSequence);
 		
 		void buildSchemaJSON (std::stringstream & jsonStream);
 
@@ -238,6 +258,11 @@ namespace BuRCPP
 		std::map<std::string, std::shared_ptr<CJournalGroup>> m_GroupNameMap;			
 		
 		std::shared_ptr<CSystemInfo> m_pSystemInfo;
+		
+		uint32_t m_nCurrentValueSize;
+		
+		sJournalHandle registerEntry (std::shared_ptr<CJournalEntryDefinition> pEntry, eJournalValueType ValueType);
+		int64_t readIntegerValue (const sJournalHandle & Handle);
 			
 		public:
 		
@@ -248,9 +273,9 @@ namespace BuRCPP
 		CJournalGroup* findGroupByID (uint32_t nGroupID, bool bMustExist);
 		CJournalGroup* findGroupByName (const std::string & sGroupName, bool bMustExist);
 		
-		void registerIntegerValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
-		void registerBoolValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID);
-		void registerDoubleValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
+		sJournalHandle registerIntegerValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, int64_t nMinValue, int64_t nMaxValue);
+		sJournalHandle registerBoolValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID);
+		sJournalHandle registerDoubleValue (const std::string & sEntryName, const uint32_t nGroupID, const uint32_t nEntryID, double dMinValue, double dMaxValue, int64_t nQuantizationSteps);
 		
 		void prepareJournal ();
 		
@@ -269,12 +294,29 @@ namespace BuRCPP
 		uint16_t getUint16Value (const uint32_t nGroupID, const uint32_t nEntryID);
 		uint8_t getUint8Value (const uint32_t nGroupID, const uint32_t nEntryID);
 		
+		void setIntegerValue (const sJournalHandle & Handle, int64_t nValue);
+		void setBoolValue (const sJournalHandle & Handle, bool bValue);
+		void setDoubleValue (const sJournalHandle & Handle, double dValue);
+		
+		bool getBoolValue (const sJournalHandle & Handle);
+		double getDoubleValue (const sJournalHandle & Handle);
+		int64_t getInt64Value (const sJournalHandle & Handle);
+		int32_t getInt32Value (const sJournalHandle & Handle);
+		int16_t getInt16Value (const sJournalHandle & Handle);
+		int8_t getInt8Value (const sJournalHandle & Handle);
+		uint64_t getUint64Value (const sJournalHandle & Handle);
+		uint32_t getUint32Value (const sJournalHandle & Handle);
+		uint16_t getUint16Value (const sJournalHandle & Handle);
+		uint8_t getUint8Value (const sJournalHandle & Handle);
+		
 		void registerDefaultCommands (CTcpPacketRegistry * pPacketRegistry);
 		void writeStatusToTCPResponse (CTcpPacketResponse * pResponse);
 		void writeVariableToTCPResponse (CTcpPacketResponse * pResponse, uint32_t nGroupId, uint32_t nEntryId);
+		void writeDeltaStatusToTCPResponse (CTcpPacketResponse * pResponse, uint32_t nGeneration, uint32_t nChangeSequence);
 		
 		void writeSchemaToTCPResponse (CTcpPacketResponse * pResponse);
 		void retrieveJournalHistory (CTcpPacketResponse * pResponse);
+		void streamJournalHistory (CTcpPacketResponse * pResponse);
 		
 		std::shared_ptr<CSystemInfo> getSystemInfo ();
 
@@ -34,11 +34,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Utils.hpp"
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #define SIGNALDEFINITION_MINQUEUESIZE 1
 #define SIGNALDEFINITION_MAXQUEUESIZE 64
 
+// Every instance slot of a queue has to be addressable by the slot field of a signal handle.
+static_assert (SIGNALDEFINITION_MAXQUEUESIZE <= SIGNALHANDLE_SLOTMASK + 1, "signal queue size exceeds the handle slot field");
+
 namespace BuRCPP
 {
 
@@ -234,7 +238,7 @@ namespace BuRCPP
 		if (pInstance == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "invalid instance parameter");
 	
-		int32_t nReadValue = 0;		
+		uint32_t nReadValue = 0;		
 		pInstance->readData ((uint8_t*)&nReadValue, getMemoryAddress (), sizeof (uint32_t));
 		
 		return nReadValue;
@@ -285,11 +289,17 @@ namespace BuRCPP
 		return dReadValue;
 	}
 	
-	CSignalDefinition::CSignalDefinition (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifeTimeInMilliseconds, std::shared_ptr<CSystemInfo> pSystemInfo)
-		: m_sName (sName), m_nQueueSize (nQueueSize), m_nCurrentMemorySizePerInstance (0), m_nLifeTimeInMilliseconds (nLifeTimeInMilliseconds), m_pSystemInfo (pSystemInfo)
+	CSignalDefinition::CSignalDefinition (const std::string & sName, const uint32_t nSignalID, uint32_t * pPendingSignalMask, const uint32_t nQueueSize, const uint32_t nLifeTimeInMilliseconds, std::shared_ptr<CSystemInfo> pSystemInfo)
+		: m_sName (sName), m_nSignalID (nSignalID), m_pPendingSignalMask (pPendingSignalMask), m_Priority (eSignalPriority::Normal), m_nQueueSize (nQueueSize), m_nCurrentMemorySizePerInstance (0), m_nLifeTimeInMilliseconds (nLifeTimeInMilliseconds), m_pSystemInfo (pSystemInfo)
 	{
 		if (pSystemInfo.get () == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "invalid system info parameter");
+		
+		if (pPendingSignalMask == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid pending signal mask parameter");
+		
+		if (nSignalID >= SIGNALHANDLER_MAXSIGNALCOUNT)
+			throw CException (eErrorCode::TOOMANYSIGNALDEFINITIONS, "invalid signal ID: " + sName);
 			
 		if ((nQueueSize < SIGNALDEFINITION_MINQUEUESIZE) || (nQueueSize > SIGNALDEFINITION_MAXQUEUESIZE))
 			throw CException (eErrorCode::INVALIDSIGNALQUEUESIZE, "invalid signal queue size.");
@@ -307,12 +317,30 @@ namespace BuRCPP
 		return m_sName;
 	}
 	
+	uint32_t CSignalDefinition::getSignalID ()
+	{
+		return m_nSignalID;
+	}
+	
+	void CSignalDefinition::setPriority (eSignalPriority priority)
+	{
+		if (!isInitializing ())
+			throw CException (eErrorCode::SIGNALINSTANCESALREADYBUILT, "signal priority can only be set in initialization mode.");
+		
+		m_Priority = priority;
+	}
+	
+	eSignalPriority CSignalDefinition::getPriority ()
+	{
+		return m_Priority;
+	}
+	
 	bool CSignalDefinition::isInitializing ()
 	{
 		return (m_Instances.empty ());
 	}
 	
-	void CSignalDefinition::registerParameter (std::shared_ptr<CSignalParameterDefinition> pParameter)
+	uint32_t CSignalDefinition::registerParameter (std::shared_ptr<CSignalParameterDefinition> pParameter)
 	{
 		if (pParameter.get () == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "invalid signal parameter instance.");
@@ -330,12 +358,22 @@ namespace BuRCPP
 			
 		m_Parameters.insert (std::make_pair (sName, pParameter));
 		
+		uint32_t nIndex = (uint32_t) m_ParameterLayout.size ();
+		m_ParameterIndices.insert (std::make_pair (sName, nIndex));
+		
+		SignalParameterLayout layout;
+		layout.m_pParameter = pParameter.get ();
+		layout.m_Type = pParameter->getSignalType ();
+		layout.m_nMemoryAddress = pParameter->getMemoryAddress ();
+		m_ParameterLayout.push_back (layout);
+		
 		m_nCurrentMemorySizePerInstance += pParameter->getSizeInBytes ();
 		
+		return nIndex;
 	}
 	
 	
-	void CSignalDefinition::registerResult (std::shared_ptr<CSignalParameterDefinition> pResult)
+	uint32_t CSignalDefinition::registerResult (std::shared_ptr<CSignalParameterDefinition> pResult)
 	{
 		if (pResult.get () == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "invalid signal result instance.");
@@ -353,49 +391,107 @@ namespace BuRCPP
 			
 		m_Results.insert (std::make_pair (sName, pResult));
 		
+		uint32_t nIndex = (uint32_t) m_ResultLayout.size ();
+		m_ResultIndices.insert (std::make_pair (sName, nIndex));
+		
+		SignalParameterLayout layout;
+		layout.m_pParameter = pResult.get ();
+		layout.m_Type = pResult->getSignalType ();
+		layout.m_nMemoryAddress = pResult->getMemoryAddress ();
+		m_ResultLayout.push_back (layout);
+		
 		m_nCurrentMemorySizePerInstance += pResult->getSizeInBytes ();
 		
+		return nIndex;
 	}
 	
-	void CSignalDefinition::addBoolParameter (const std::string & sName, bool bDefault)
+	uint32_t CSignalDefinition::addBoolParameter (const std::string & sName, bool bDefault)
 	{
-		registerParameter (std::make_shared<CSignalBoolParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, bDefault));
+		return registerParameter (std::make_shared<CSignalBoolParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, bDefault));
 	}
 	
-	void CSignalDefinition::addInt32Parameter (const std::string & sName, int32_t nDefault)
+	uint32_t CSignalDefinition::addInt32Parameter (const std::string & sName, int32_t nDefault)
 	{
-		registerParameter (std::make_shared<CSignalInt32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
+		return registerParameter (std::make_shared<CSignalInt32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
 		
 	}
 	
-	void CSignalDefinition::addUint32Parameter (const std::string & sName, uint32_t nDefault)
+	uint32_t CSignalDefinition::addUint32Parameter (const std::string & sName, uint32_t nDefault)
 	{
-		registerParameter (std::make_shared<CSignalUint32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
+		return registerParameter (std::make_shared<CSignalUint32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
 	}
 	
-	void CSignalDefinition::addDoubleParameter (const std::string & sName, double dDefault)
+	uint32_t CSignalDefinition::addDoubleParameter (const std::string & sName, double dDefault)
 	{
-		registerParameter (std::make_shared<CSignalDoubleParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, dDefault));
+		return registerParameter (std::make_shared<CSignalDoubleParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, dDefault));
 	}
 
-	void CSignalDefinition::addBoolResult (const std::string & sName, bool bDefault)
+	uint32_t CSignalDefinition::addBoolResult (const std::string & sName, bool bDefault)
+	{
+		return registerResult (std::make_shared<CSignalBoolParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, bDefault));
+	}
+	
+	uint32_t CSignalDefinition::addInt32Result (const std::string & sName, int32_t nDefault)
+	{
+		return registerResult (std::make_shared<CSignalInt32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
+	}
+	
+	uint32_t CSignalDefinition::addUint32Result (const std::string & sName, uint32_t nDefault)
 	{
-		registerResult (std::make_shared<CSignalBoolParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, bDefault));
+		return registerResult (std::make_shared<CSignalUint32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
 	}
 	
-	void CSignalDefinition::addInt32Result (const std::string & sName, int32_t nDefault)
+	uint32_t CSignalDefinition::addDoubleResult (const std::string & sName, double dDefault)
 	{
-		registerResult (std::make_shared<CSignalInt32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
+		return registerResult (std::make_shared<CSignalDoubleParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, dDefault));
 	}
 	
-	void CSignalDefinition::addUint32Result (const std::string & sName, uint32_t nDefault)
+	uint32_t CSignalDefinition::verifyIndex (uint32_t nIndex, uint32_t nExpectedIndex, const std::string & sName)
 	{
-		registerResult (std::make_shared<CSignalUint32ParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, nDefault));
+		if (nIndex != nExpectedIndex)
+			throw CException (eErrorCode::REGISTRATIONIDMISMATCH, "signal parameter index mismatch: " + sName + " has index " + std::to_string (nIndex) + ", expected " + std::to_string (nExpectedIndex) + " (" + m_sName + ")");
+		
+		return nIndex;
+	}
+	
+	uint32_t CSignalDefinition::addBoolParameter (const std::string & sName, bool bDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addBoolParameter (sName, bDefault), nExpectedIndex, sName);
 	}
 	
-	void CSignalDefinition::addDoubleResult (const std::string & sName, double dDefault)
+	uint32_t CSignalDefinition::addInt32Parameter (const std::string & sName, int32_t nDefault, uint32_t nExpectedIndex)
 	{
-		registerResult (std::make_shared<CSignalDoubleParameterDefinition> (sName, m_nCurrentMemorySizePerInstance, dDefault));
+		return verifyIndex (addInt32Parameter (sName, nDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addUint32Parameter (const std::string & sName, uint32_t nDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addUint32Parameter (sName, nDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addDoubleParameter (const std::string & sName, double dDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addDoubleParameter (sName, dDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addBoolResult (const std::string & sName, bool bDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addBoolResult (sName, bDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addInt32Result (const std::string & sName, int32_t nDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addInt32Result (sName, nDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addUint32Result (const std::string & sName, uint32_t nDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addUint32Result (sName, nDefault), nExpectedIndex, sName);
+	}
+	
+	uint32_t CSignalDefinition::addDoubleResult (const std::string & sName, double dDefault, uint32_t nExpectedIndex)
+	{
+		return verifyIndex (addDoubleResult (sName, dDefault), nExpectedIndex, sName);
 	}
 	
 	
@@ -406,18 +502,146 @@ namespace BuRCPP
 		
 		m_MemoryBuffer.resize (m_nCurrentMemorySizePerInstance * m_nQueueSize);
 		
+		// Default values are written once into a template block, which is copied into each prepared signal.
+		m_DefaultMemory.resize (m_nCurrentMemorySizePerInstance);
+		CSignalInstanceBase defaultInstance (this, 0, m_DefaultMemory.data (), m_nCurrentMemorySizePerInstance);
+		for (auto & layout : m_ParameterLayout)
+			layout.m_pParameter->writeDefaultToInstance (&defaultInstance);
+		for (auto & layout : m_ResultLayout)
+			layout.m_pParameter->writeDefaultToInstance (&defaultInstance);
+		
+		m_UnusedInstanceQueue.m_nFirstSlot = SIGNALSLOT_NONE;
+		m_UnusedInstanceQueue.m_nLastSlot = SIGNALSLOT_NONE;
+		m_ActiveInstanceQueue = m_UnusedInstanceQueue;
+		m_FinishedInstanceQueue = m_UnusedInstanceQueue;
+		
+		m_Instances.reserve (m_nQueueSize);
+		m_Slots.resize (m_nQueueSize);
+		
 		for (uint32_t nIndex = 0; nIndex < m_nQueueSize; nIndex++) {
 			
-			
 			auto pSignal = std::make_shared<CSignalInstance> (this, nIndex + 1, &m_MemoryBuffer.at (nIndex * m_nCurrentMemorySizePerInstance), m_nCurrentMemorySizePerInstance);
-			m_Instances.insert (std::make_pair(pSignal->getInstanceID (), pSignal));
-			m_UnusedInstanceQueue.push (pSignal);
+			m_Instances.push_back (pSignal);
 			
-					
+			m_Slots[nIndex].m_nGeneration = 1;
+			pushSlot (m_UnusedInstanceQueue, nIndex, eSignalInstanceState::Unused);
 			
+		}
+		
+	}
+	
+	void CSignalDefinition::pushSlot (SignalInstanceQueue & queue, uint32_t nSlot, eSignalInstanceState newState)
+	{
+		auto & slot = m_Slots[nSlot];
+		slot.m_State = newState;
+		slot.m_nNextSlot = SIGNALSLOT_NONE;
+		
+		if (queue.m_nLastSlot == SIGNALSLOT_NONE) {
+			queue.m_nFirstSlot = nSlot;
+		} else {
+			m_Slots[queue.m_nLastSlot].m_nNextSlot = nSlot;
+		}
+		queue.m_nLastSlot = nSlot;
+	}
+	
+	uint32_t CSignalDefinition::popSlot (SignalInstanceQueue & queue)
+	{
+		uint32_t nSlot = queue.m_nFirstSlot;
+		if (nSlot != SIGNALSLOT_NONE) {
+			queue.m_nFirstSlot = m_Slots[nSlot].m_nNextSlot;
+			if (queue.m_nFirstSlot == SIGNALSLOT_NONE)
+				queue.m_nLastSlot = SIGNALSLOT_NONE;
 			
+			m_Slots[nSlot].m_nNextSlot = SIGNALSLOT_NONE;
 		}
 		
+		return nSlot;
+	}
+	
+	uint32_t CSignalDefinition::getSlotOfInstance (CSignalInstanceBase * pSignalInstance, eSignalInstanceState expectedState)
+	{
+		if (pSignalInstance == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid signal instance parameter");
+		
+		uint32_t nSlot = pSignalInstance->getInstanceID () - 1;
+		if ((nSlot >= m_Slots.size ()) || (m_Slots[nSlot].m_State != expectedState))
+			return SIGNALSLOT_NONE;
+		
+		return nSlot;
+	}
+	
+	uint32_t CSignalDefinition::getInstanceHandle (CSignalInstanceBase * pSignalInstance)
+	{
+		if (pSignalInstance == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid signal instance parameter");
+		
+		uint32_t nSlot = pSignalInstance->getInstanceID () - 1;
+		if (nSlot >= m_Slots.size ())
+			throw CException (eErrorCode::INVALIDSIGNALHANDLE, "invalid signal instance: " + m_sName);
+		
+		return (m_Slots[nSlot].m_nGeneration << SIGNALHANDLE_SLOTBITS) | nSlot;
+	}
+	
+	bool CSignalDefinition::signalHasBeenProcessed (uint32_t nHandle)
+	{
+		uint32_t nSlot = nHandle & SIGNALHANDLE_SLOTMASK;
+		if ((nHandle == SIGNALHANDLE_INVALID) || (nSlot >= m_Slots.size ()))
+			throw CException (eErrorCode::INVALIDSIGNALHANDLE, "invalid signal handle: " + m_sName);
+		
+		// An instance is only reused after it has been processed, so a newer generation means processed.
+		if ((nHandle >> SIGNALHANDLE_SLOTBITS) != m_Slots[nSlot].m_nGeneration)
+			return true;
+		
+		return m_Instances[nSlot]->signalHasBeenProcessed ();
+	}
+	
+	bool CSignalDefinition::cancelSignal (uint32_t nHandle)
+	{
+		uint32_t nSlot = nHandle & SIGNALHANDLE_SLOTMASK;
+		if ((nHandle == SIGNALHANDLE_INVALID) || (nSlot >= m_Slots.size ()))
+			throw CException (eErrorCode::INVALIDSIGNALHANDLE, "invalid signal handle: " + m_sName);
+		
+		// The instance has been recycled already, so the signal cannot be delivered anymore.
+		if ((nHandle >> SIGNALHANDLE_SLOTBITS) != m_Slots[nSlot].m_nGeneration)
+			return true;
+		
+		switch (m_Slots[nSlot].m_State) {
+			case eSignalInstanceState::InPreparation:
+				pushSlot (m_UnusedInstanceQueue, nSlot, eSignalInstanceState::Unused);
+				return true;
+				
+			case eSignalInstanceState::Active:
+			{
+				// Unlink the slot from the active queue before the state handler can check it.
+				uint32_t nPreviousSlot = SIGNALSLOT_NONE;
+				uint32_t nCurrentSlot = m_ActiveInstanceQueue.m_nFirstSlot;
+				while ((nCurrentSlot != SIGNALSLOT_NONE) && (nCurrentSlot != nSlot)) {
+					nPreviousSlot = nCurrentSlot;
+					nCurrentSlot = m_Slots[nCurrentSlot].m_nNextSlot;
+				}
+				if (nCurrentSlot == SIGNALSLOT_NONE)
+					throw CException (eErrorCode::INVALIDSIGNALHANDLE, "active signal is not queued: " + m_sName);
+				
+				if (nPreviousSlot == SIGNALSLOT_NONE) {
+					m_ActiveInstanceQueue.m_nFirstSlot = m_Slots[nSlot].m_nNextSlot;
+				} else {
+					m_Slots[nPreviousSlot].m_nNextSlot = m_Slots[nSlot].m_nNextSlot;
+				}
+				if (m_ActiveInstanceQueue.m_nLastSlot == nSlot)
+					m_ActiveInstanceQueue.m_nLastSlot = nPreviousSlot;
+				if (m_ActiveInstanceQueue.m_nFirstSlot == SIGNALSLOT_NONE)
+					*m_pPendingSignalMask &= ~(1u << m_nSignalID);
+				
+				pushSlot (m_UnusedInstanceQueue, nSlot, eSignalInstanceState::Unused);
+				return true;
+			}
+			
+			case eSignalInstanceState::InProcess:
+				return false;
+				
+			default:
+				return true;
+		}
 	}
 	
 	CSignalParameterDefinition * CSignalDefinition::findParameter (const std::string & sName, bool bMustExist)
@@ -439,22 +663,23 @@ namespace BuRCPP
 		if (m_Instances.size () == 0)
 			throw CException (eErrorCode::SIGNALHASNOINSTANCES, "signal has no instances: " + m_sName);
 		
-		if (m_UnusedInstanceQueue.empty ()) 
+		uint32_t nSlot = popSlot (m_UnusedInstanceQueue);
+		if (nSlot == SIGNALSLOT_NONE) 
 			throw CException (eErrorCode::COULDNOTPREPARESIGNAL, "signal instances queue is full: " + m_sName);
 		
-		auto pSignal = m_UnusedInstanceQueue.front ();
-		m_UnusedInstanceQueue.pop ();
-		m_InPreparationInstanceQueue.insert (std::make_pair (pSignal->getInstanceID (), pSignal));
+		auto & slot = m_Slots[nSlot];
+		slot.m_State = eSignalInstanceState::InPreparation;
+		slot.m_nGeneration = (slot.m_nGeneration + 1) & (0xffffffff >> SIGNALHANDLE_SLOTBITS);
+		if (slot.m_nGeneration == 0)
+			slot.m_nGeneration = 1;
 		
+		auto pSignal = m_Instances[nSlot].get ();
 		pSignal->resetTimer ();
 				
-		for (auto pParameter: m_Parameters)
-			pParameter.second->writeDefaultToInstance (pSignal.get ());
-		for (auto pResult: m_Results)
-			pResult.second->writeDefaultToInstance (pSignal.get ());
+		pSignal->writeData (m_DefaultMemory.data (), 0, m_nCurrentMemorySizePerInstance);
 		
 							
-		return pSignal->getSendInstance ().get ();
+		return pSignal->getSendInstance ();
 	
 	}
 	
@@ -464,14 +689,15 @@ namespace BuRCPP
 			throw CException (eErrorCode::SIGNALHASNOINSTANCES, "signal has no instances: " + m_sName);
 		
 		
-		if (m_ActiveInstanceQueue.empty ())
+		uint32_t nSlot = popSlot (m_ActiveInstanceQueue);
+		if (nSlot == SIGNALSLOT_NONE)
 			return nullptr;
 		
-		auto pSignal = m_ActiveInstanceQueue.front ();
-		m_ActiveInstanceQueue.pop ();
-		m_InProcessInstanceQueue.insert (std::make_pair (pSignal->getInstanceID (), pSignal));
+		m_Slots[nSlot].m_State = eSignalInstanceState::InProcess;
+		if (m_ActiveInstanceQueue.m_nFirstSlot == SIGNALSLOT_NONE)
+			*m_pPendingSignalMask &= ~(1u << m_nSignalID);
 		
-		return pSignal->getProcessingInstance ().get ();
+		return m_Instances[nSlot]->getProcessingInstance ();
 		
 		
 	}
@@ -482,22 +708,20 @@ namespace BuRCPP
 		if (m_Instances.size () == 0)
 			throw CException (eErrorCode::SIGNALHASNOINSTANCES, "signal has no instances: " + m_sName);
 		
-		uint32_t nInstanceID = pProcessingInstance->getInstanceID();
-		auto iIter = m_InProcessInstanceQueue.find (nInstanceID);
-		if (iIter == m_InProcessInstanceQueue.end ())
+		uint32_t nSlot = getSlotOfInstance (pProcessingInstance, eSignalInstanceState::InProcess);
+		if (nSlot == SIGNALSLOT_NONE)
 			throw CException (eErrorCode::SIGNALISNOTINPROCESS, "signal is not in process" + m_sName);
 		
-		auto pSignal = iIter->second;
-		m_InProcessInstanceQueue.erase (nInstanceID);
+		auto pSignal = m_Instances[nSlot].get ();
 
-		pProcessingInstance->setBoolResult ("__processed", true);
+		pProcessingInstance->setBoolResult (SIGNALRESULT_PROCESSEDINDEX, true);
 		
 		if (pSignal->signalLifeTimeIsExpired ()) {
-			m_UnusedInstanceQueue.push (pSignal);
+			pushSlot (m_UnusedInstanceQueue, nSlot, eSignalInstanceState::Unused);
 			pSignal->resetTimer ();
 		} else {
 			
-			m_FinishedInstanceQueue.push (pSignal);
+			pushSlot (m_FinishedInstanceQueue, nSlot, eSignalInstanceState::Finished);
 		}
 						
 					
@@ -506,11 +730,11 @@ namespace BuRCPP
 	void CSignalDefinition::releaseExpiredSignals ()
 	{
 		
-		while (!m_FinishedInstanceQueue.empty ()) {
-			auto pSignal = m_FinishedInstanceQueue.front ();
+		while (m_FinishedInstanceQueue.m_nFirstSlot != SIGNALSLOT_NONE) {
+			auto pSignal = m_Instances[m_FinishedInstanceQueue.m_nFirstSlot].get ();
 			if (pSignal->signalLifeTimeIsExpired ()) {
-				m_FinishedInstanceQueue.pop ();
-				m_UnusedInstanceQueue.push (pSignal);
+				uint32_t nSlot = popSlot (m_FinishedInstanceQueue);
+				pushSlot (m_UnusedInstanceQueue, nSlot, eSignalInstanceState::Unused);
 				pSignal->resetTimer ();
 			} else {
 				break;
@@ -524,16 +748,14 @@ namespace BuRCPP
 		if (m_Instances.size () == 0)
 			throw CException (eErrorCode::SIGNALHASNOINSTANCES, "signal has no instances: " + m_sName);
 			
-		uint32_t nInstanceID = pSignalInstance->getInstanceID();
-		auto iIter = m_InPreparationInstanceQueue.find (nInstanceID);
-		if (iIter == m_InPreparationInstanceQueue.end ())
+		uint32_t nSlot = getSlotOfInstance (pSignalInstance, eSignalInstanceState::InPreparation);
+		if (nSlot == SIGNALSLOT_NONE)
 			throw CException (eErrorCode::SIGNALISNOTINPREPARATION, "signal is not in preparation" + m_sName);
 		
-		auto pSignal = iIter->second;
-		m_InPreparationInstanceQueue.erase (nInstanceID);
-		m_ActiveInstanceQueue.push (pSignal);
+		pushSlot (m_ActiveInstanceQueue, nSlot, eSignalInstanceState::Active);
+		*m_pPendingSignalMask |= (1u << m_nSignalID);
 			
-		pSignalInstance->setBoolParameter ("__active", true);
+		pSignalInstance->setBoolParameter (SIGNALPARAMETER_ACTIVEINDEX, true);
 	}
 	
 	CSignalParameterDefinition * CSignalDefinition::findResult (const std::string & sName, bool bMustExist)
@@ -549,6 +771,40 @@ namespace BuRCPP
 		return iIter->second.get ();
 	}
 	
+	uint32_t CSignalDefinition::getParameterIndex (const std::string & sName)
+	{
+		auto iIter = m_ParameterIndices.find (sName);
+		if (iIter == m_ParameterIndices.end ())
+			throw CException (eErrorCode::SIGNALPARAMETERNOTFOUND, "signal parameter not found: " + sName);
+		
+		return iIter->second;
+	}
+	
+	uint32_t CSignalDefinition::getResultIndex (const std::string & sName)
+	{
+		auto iIter = m_ResultIndices.find (sName);
+		if (iIter == m_ResultIndices.end ())
+			throw CException (eErrorCode::SIGNALRESULTNOTFOUND, "signal result not found: " + sName);
+		
+		return iIter->second;
+	}
+	
+	const SignalParameterLayout & CSignalDefinition::getParameterLayout (uint32_t nIndex)
+	{
+		if (nIndex >= m_ParameterLayout.size ())
+			throw CException (eErrorCode::SIGNALPARAMETERNOTFOUND, "signal parameter index not found: " + std::to_string (nIndex));
+		
+		return m_ParameterLayout[nIndex];
+	}
+	
+	const SignalParameterLayout & CSignalDefinition::getResultLayout (uint32_t nIndex)
+	{
+		if (nIndex >= m_ResultLayout.size ())
+			throw CException (eErrorCode::SIGNALRESULTNOTFOUND, "signal result index not found: " + std::to_string (nIndex));
+		
+		return m_ResultLayout[nIndex];
+	}
+	
 	uint32_t CSignalDefinition::getLifeTimeInMilliseconds ()
 	{
 		return m_nLifeTimeInMilliseconds;
@@ -586,7 +842,7 @@ namespace BuRCPP
 	
 	bool CSignalInstanceBase::signalHasBeenProcessed ()
 	{
-		return getBoolResult ("__processed");
+		return getBoolResult (SIGNALRESULT_PROCESSEDINDEX);
 	}		
 			
 	void CSignalInstanceBase::writeData (uint8_t * pSource, uint32_t nOffset, uint32_t nSize)
@@ -604,8 +860,7 @@ namespace BuRCPP
 		if ((nOffset + nSize) > m_nMemorySize)
 			throw CException (eErrorCode::SIGNALDATAWRITEOUTOFRANGE, "signal data write exceeds buffer: " +  m_pDefinition->getName ());
 		
-		for (uint32_t nIndex = 0; nIndex < nSize; nIndex++)
-			m_pMemory[nOffset + nIndex] = pSource[nIndex];
+		memcpy (&m_pMemory[nOffset], pSource, nSize);
 	}
 	
 	void CSignalInstanceBase::readData (uint8_t * pTarget, uint32_t nOffset, uint32_t nSize)
@@ -623,8 +878,84 @@ namespace BuRCPP
 		if ((nOffset + nSize) > m_nMemorySize)
 			throw CException (eErrorCode::SIGNALDATAREADOUTOFRANGE, "signal data read exceeds buffer: " +  m_pDefinition->getName ());
 		
-		for (uint32_t nIndex = 0; nIndex < nSize; nIndex++)
-			pTarget[nIndex] = m_pMemory[nOffset + nIndex];
+		memcpy (pTarget, &m_pMemory[nOffset], nSize);
+	}
+	
+	int64_t CSignalInstanceBase::readIntegerFromLayout (const SignalParameterLayout & layout)
+	{
+		switch (layout.m_Type) {
+			case eSignalParameterType::BoolParameterType: {
+				uint8_t nValue = 0;
+				readData (&nValue, layout.m_nMemoryAddress, sizeof (nValue));
+				return (nValue != 0) ? 1 : 0;
+			}
+			
+			case eSignalParameterType::Int32ParameterType: {
+				int32_t nValue = 0;
+				readData ((uint8_t*)&nValue, layout.m_nMemoryAddress, sizeof (nValue));
+				return nValue;
+			}
+			
+			case eSignalParameterType::Uint32ParameterType: {
+				uint32_t nValue = 0;
+				readData ((uint8_t*)&nValue, layout.m_nMemoryAddress, sizeof (nValue));
+				return nValue;
+			}
+			
+			default:
+				return layout.m_pParameter->readIntegerFromInstance (this);
+		}
+	}
+	
+	double CSignalInstanceBase::readDoubleFromLayout (const SignalParameterLayout & layout)
+	{
+		if (layout.m_Type == eSignalParameterType::DoubleParameterType) {
+			double dValue = 0.0;
+			readData ((uint8_t*)&dValue, layout.m_nMemoryAddress, sizeof (dValue));
+			return dValue;
+		}
+		
+		return layout.m_pParameter->readDoubleFromInstance (this);
+	}
+	
+	void CSignalInstanceBase::writeIntegerToLayout (const SignalParameterLayout & layout, int64_t nValue)
+	{
+		switch (layout.m_Type) {
+			case eSignalParameterType::BoolParameterType: {
+				uint8_t nValueToWrite = (nValue != 0) ? 1 : 0;
+				writeData (&nValueToWrite, layout.m_nMemoryAddress, sizeof (nValueToWrite));
+				break;
+			}
+			
+			case eSignalParameterType::Int32ParameterType: {
+				if ((nValue < std::numeric_limits<std::int32_t>::min ()) || (nValue > std::numeric_limits<std::int32_t>::max ()))
+					throw CException (eErrorCode::VALUEISOUTSIDEOFINTEGER32RANGE, "value is outside of integer 32 range: " + layout.m_pParameter->getName ());
+				int32_t nValueToWrite = (int32_t) nValue;
+				writeData ((uint8_t*)&nValueToWrite, layout.m_nMemoryAddress, sizeof (nValueToWrite));
+				break;
+			}
+			
+			case eSignalParameterType::Uint32ParameterType: {
+				if ((nValue < std::numeric_limits<std::uint32_t>::min ()) || (nValue > std::numeric_limits<std::uint32_t>::max ()))
+					throw CException (eErrorCode::VALUEISOUTSIDEOFUNSIGNEDINTEGER32RANGE, "value is outside of unsigned integer 32 range: " + layout.m_pParameter->getName ());
+				uint32_t nValueToWrite = (uint32_t) nValue;
+				writeData ((uint8_t*)&nValueToWrite, layout.m_nMemoryAddress, sizeof (nValueToWrite));
+				break;
+			}
+			
+			default:
+				layout.m_pParameter->writeIntegerToInstance (this, nValue);
+		}
+	}
+	
+	void CSignalInstanceBase::writeDoubleToLayout (const SignalParameterLayout & layout, double dValue)
+	{
+		if (layout.m_Type == eSignalParameterType::DoubleParameterType) {
+			writeData ((uint8_t*)&dValue, layout.m_nMemoryAddress, sizeof (dValue));
+			return;
+		}
+		
+		layout.m_pParameter->writeDoubleToInstance (this, dValue);
 	}
 		
 	
@@ -765,6 +1096,106 @@ float CSignalInstanceBase::getFloatResult (const std::string & sName)
 }
 
 	
+bool CSignalInstanceBase::getBoolParameter (uint32_t nIndex)
+{
+	return (readIntegerFromLayout (m_pDefinition->getParameterLayout (nIndex)) != 0);
+}
+	
+int32_t CSignalInstanceBase::getInt32Parameter (uint32_t nIndex)
+{
+	auto & layout = m_pDefinition->getParameterLayout (nIndex);
+	int64_t nValue = readIntegerFromLayout (layout);
+		
+	if ((nValue < std::numeric_limits<std::int32_t>::min ()) || (nValue > std::numeric_limits<std::int32_t>::max ()))
+		throw CException (eErrorCode::VALUEISOUTSIDEOFINTEGER32RANGE, "value is outside of integer 32 range: " + layout.m_pParameter->getName ());
+		
+	return (int32_t) nValue;
+}
+	
+uint32_t CSignalInstanceBase::getUint32Parameter (uint32_t nIndex)
+{
+	auto & layout = m_pDefinition->getParameterLayout (nIndex);
+	int64_t nValue = readIntegerFromLayout (layout);
+		
+	if ((nValue < std::numeric_limits<std::uint32_t>::min ()) || (nValue > std::numeric_limits<std::uint32_t>::max ()))
+		throw CException (eErrorCode::VALUEISOUTSIDEOFUNSIGNEDINTEGER32RANGE, "value is outside of unsigned integer 32 range: " + layout.m_pParameter->getName ());
+		
+	return (uint32_t) nValue;
+}
+	
+double CSignalInstanceBase::getDoubleParameter (uint32_t nIndex)
+{
+	return readDoubleFromLayout (m_pDefinition->getParameterLayout (nIndex));
+}
+
+float CSignalInstanceBase::getFloatParameter (uint32_t nIndex)
+{
+	return (float) readDoubleFromLayout (m_pDefinition->getParameterLayout (nIndex));
+}
+	
+bool CSignalInstanceBase::getBoolResult (uint32_t nIndex)
+{
+	return (readIntegerFromLayout (m_pDefinition->getResultLayout (nIndex)) != 0);
+}
+	
+int32_t CSignalInstanceBase::getInt32Result (uint32_t nIndex)
+{
+	auto & layout = m_pDefinition->getResultLayout (nIndex);
+	int64_t nValue = readIntegerFromLayout (layout);
+		
+	if ((nValue < std::numeric_limits<std::int32_t>::min ()) || (nValue > std::numeric_limits<std::int32_t>::max ()))
+		throw CException (eErrorCode::VALUEISOUTSIDEOFINTEGER32RANGE, "value is outside of integer 32 range: " + layout.m_pParameter->getName ());
+		
+	return (int32_t) nValue;
+}
+		
+uint32_t CSignalInstanceBase::getUint32Result (uint32_t nIndex)
+{
+	auto & layout = m_pDefinition->getResultLayout (nIndex);
+	int64_t nValue = readIntegerFromLayout (layout);
+		
+	if ((nValue < std::numeric_limits<std::uint32_t>::min ()) || (nValue > std::numeric_limits<std::uint32_t>::max ()))
+		throw CException (eErrorCode::VALUEISOUTSIDEOFUNSIGNEDINTEGER32RANGE, "value is outside of unsigned integer 32 range: " + layout.m_pParameter->getName ());
+		
+	return (uint32_t) nValue;
+}
+	
+double CSignalInstanceBase::getDoubleResult (uint32_t nIndex)
+{
+	return readDoubleFromLayout (m_pDefinition->getResultLayout (nIndex));
+}
+	
+float CSignalInstanceBase::getFloatResult (uint32_t nIndex)
+{
+	return (float) readDoubleFromLayout (m_pDefinition->getResultLayout (nIndex));
+}
+
+void CSignalProcessingInstance::setBoolResult (uint32_t nIndex, bool bValue)
+{
+	writeIntegerToLayout (m_pDefinition->getResultLayout (nIndex), bValue ? 1 : 0);
+}
+	
+void CSignalProcessingInstance::setInt32Result (uint32_t nIndex, int32_t nValue)
+{
+	writeIntegerToLayout (m_pDefinition->getResultLayout (nIndex), (int64_t) nValue);
+}
+	
+void CSignalProcessingInstance::setUint32Result (uint32_t nIndex, uint32_t nValue)
+{
+	writeIntegerToLayout (m_pDefinition->getResultLayout (nIndex), (int64_t) nValue);
+}
+	
+void CSignalProcessingInstance::setDoubleResult (uint32_t nIndex, double dValue)
+{
+	writeDoubleToLayout (m_pDefinition->getResultLayout (nIndex), dValue);
+}
+		
+void CSignalProcessingInstance::setFloatResult (uint32_t nIndex, float fValue)
+{
+	writeDoubleToLayout (m_pDefinition->getResultLayout (nIndex), (double) fValue);
+}
+
+	
 	void CSignalProcessingInstance::finishProcessing ()
 	{
 		m_pDefinition->finishProcessing (this);
@@ -827,9 +1258,35 @@ void CSignalSendInstance::setFloatParameter (const std::string & sName, float fV
 	
 
 	
+void CSignalSendInstance::setBoolParameter (uint32_t nIndex, bool bValue)
+{
+	writeIntegerToLayout (m_pDefinition->getParameterLayout (nIndex), bValue ? 1 : 0);
+}
+	
+void CSignalSendInstance::setInt32Parameter (uint32_t nIndex, int32_t nValue)
+{
+	writeIntegerToLayout (m_pDefinition->getParameterLayout (nIndex), (int64_t) nValue);
+}
+	
+void CSignalSendInstance::setUint32Parameter (uint32_t nIndex, uint32_t nValue)
+{
+	writeIntegerToLayout (m_pDefinition->getParameterLayout (nIndex), (int64_t) nValue);
+}
+	
+void CSignalSendInstance::setDoubleParameter (uint32_t nIndex, double dValue)
+{
+	writeDoubleToLayout (m_pDefinition->getParameterLayout (nIndex), dValue);
+}
+	
+void CSignalSendInstance::setFloatParameter (uint32_t nIndex, float fValue)
+{
+	writeDoubleToLayout (m_pDefinition->getParameterLayout (nIndex), (double)fValue);
+}
+	
+
 	bool CSignalInstanceBase::signalIsTriggered ()
 	{
-		return getBoolParameter ("__active");
+		return getBoolParameter (SIGNALPARAMETER_ACTIVEINDEX);
 	}	
 	
 	bool CSignalSendInstance::triggerSignal ()
@@ -842,6 +1299,21 @@ void CSignalSendInstance::setFloatParameter (const std::string & sName, float fV
 		
 	}
 	
+	uint32_t CSignalSendInstance::getHandle ()
+	{
+		return m_pDefinition->getInstanceHandle (this);
+	}
+	
+	bool CSignalSendInstance::signalHasBeenProcessed (uint32_t nHandle)
+	{
+		return m_pDefinition->signalHasBeenProcessed (nHandle);
+	}
+	
+	bool CSignalSendInstance::cancelSignal (uint32_t nHandle)
+	{
+		return m_pDefinition->cancelSignal (nHandle);
+	}
+	
 	uint64_t CSignalSendInstance::getTriggerTimeInMicroseconds ()
 	{
 		return m_nTriggerTimeInMicroseconds;
@@ -858,14 +1330,14 @@ void CSignalSendInstance::setFloatParameter (const std::string & sName, float fV
 	{
 	}
 			
-	std::shared_ptr<CSignalSendInstance> CSignalInstance::getSendInstance ()
+	CSignalSendInstance * CSignalInstance::getSendInstance ()
 	{
-		return m_SendInstance;
+		return m_SendInstance.get ();
 	}
 	
-	std::shared_ptr<CSignalProcessingInstance> CSignalInstance::getProcessingInstance ()
+	CSignalProcessingInstance * CSignalInstance::getProcessingInstance ()
 	{
-		return m_ProcessingInstance;
+		return m_ProcessingInstance.get ();
 	}
 	
 	void CSignalInstance::resetTimer ()
@@ -894,7 +1366,7 @@ void CSignalSendInstance::setFloatParameter (const std::string & sName, float fV
 
 
 CSignalHandler::CSignalHandler (std::shared_ptr<CSystemInfo> pSystemInfo)
-	: m_bIsInitializing (true), m_pSystemInfo (pSystemInfo)
+	: m_nPendingSignalMask (0), m_nHighPrioritySignalMask (0), m_bIsInitializing (true), m_pSystemInfo (pSystemInfo)
 {
 	if (pSystemInfo.get () == nullptr)
 		throw CException (eErrorCode::INVALIDPARAM, "invalid system info parameter");
@@ -913,8 +1385,13 @@ std::shared_ptr<CSignalDefinition> CSignalHandler::registerSignal (const std::st
 		if (iIter != m_SignalDefinitions.end ())
 			throw CException (eErrorCode::DUPLICATESIGNALDEFINITION, "duplicate signal definition: " + sName);
 			
-		auto pSignalDefinition = std::make_shared<CSignalDefinition> (sName, nQueueSize, nLifetimeInMilliseconds, m_pSystemInfo);
+		if (m_SignalDefinitionsByID.size () >= SIGNALHANDLER_MAXSIGNALCOUNT)
+			throw CException (eErrorCode::TOOMANYSIGNALDEFINITIONS, "too many signal definitions: " + sName);
+		
+		uint32_t nSignalID = (uint32_t) m_SignalDefinitionsByID.size ();
+		auto pSignalDefinition = std::make_shared<CSignalDefinition> (sName, nSignalID, &m_nPendingSignalMask, nQueueSize, nLifetimeInMilliseconds, m_pSystemInfo);
 		m_SignalDefinitions.insert (std::make_pair (sName, pSignalDefinition));		
+		m_SignalDefinitionsByID.push_back (pSignalDefinition.get ());
 		
 		return pSignalDefinition;
 		
@@ -930,13 +1407,13 @@ CSignalProcessingInstance * CSignalHandler::checkSignal (const std::string & sNa
 		if (m_bIsInitializing) 
 			throw CException (eErrorCode::COULDNOTCHECKSIGNAL, "can not check signal, if in initialization mode.");
 		
+		// Idle state machines poll several signals per cycle, skip the name lookup if nothing is pending.
+		if (m_nPendingSignalMask == 0)
+			return nullptr;
 	
 		auto iIter = m_SignalDefinitions.find (sName);		
-		if (iIter != m_SignalDefinitions.end ()) {
-			auto pSignalDefinition = iIter->second;
-			
-			return pSignalDefinition->checkSignal ();
-		}
+		if (iIter != m_SignalDefinitions.end ()) 
+			return checkSignal (iIter->second->getSignalID ());
 		
 		throw CException (eErrorCode::SIGNALDEFINITIONNOTFOUND, "signal definition not found: " + sName);
 		
@@ -961,12 +1438,65 @@ CSignalSendInstance * CSignalHandler::prepareSignal (const std::string & sName)
 		
 }
 
+CSignalProcessingInstance * CSignalHandler::checkSignal (uint32_t nSignalID)
+{
+	if (m_bIsInitializing) 
+		throw CException (eErrorCode::COULDNOTCHECKSIGNAL, "can not check signal, if in initialization mode.");
+	
+	if (nSignalID >= m_SignalDefinitionsByID.size ())
+		throw CException (eErrorCode::SIGNALDEFINITIONNOTFOUND, "signal definition not found: " + std::to_string (nSignalID));
+	
+	uint32_t nSignalBit = 1u << nSignalID;
+	if ((m_nPendingSignalMask & nSignalBit) == 0)
+		return nullptr;
+	
+	// Normal signals wait while any high priority signal is pending, also if the state checks them first.
+	// A high priority signal that the current state does not handle delays them until it expires.
+	if ((m_nHighPrioritySignalMask & nSignalBit) == 0) {
+		if ((m_nPendingSignalMask & m_nHighPrioritySignalMask) != 0)
+			return nullptr;
+	}
+	
+	return m_SignalDefinitionsByID[nSignalID]->checkSignal ();
+}
+
+CSignalSendInstance * CSignalHandler::prepareSignal (uint32_t nSignalID)
+{
+	if (m_bIsInitializing) 
+		throw CException (eErrorCode::COULDNOTPREPARESIGNAL, "can not prepare signal, if in initialization mode.");
+	
+	if (nSignalID >= m_SignalDefinitionsByID.size ())
+		throw CException (eErrorCode::SIGNALDEFINITIONNOTFOUND, "signal definition not found: " + std::to_string (nSignalID));
+	
+	return m_SignalDefinitionsByID[nSignalID]->prepareSignal ();
+}
+
+uint32_t CSignalHandler::getSignalID (const std::string & sName)
+{
+	auto iIter = m_SignalDefinitions.find (sName);		
+	if (iIter == m_SignalDefinitions.end ()) 
+		throw CException (eErrorCode::SIGNALDEFINITIONNOTFOUND, "signal definition not found: " + sName);
+	
+	return iIter->second->getSignalID ();
+}
+
+bool CSignalHandler::hasPendingSignals ()
+{
+	return (m_nPendingSignalMask != 0);
+}
+
 void CSignalHandler::buildInstances ()
 {
 	if (m_bIsInitializing) {
 			
 		for (auto iIter : m_SignalDefinitions)
 			iIter.second->buildInstances ();
+		
+		m_nHighPrioritySignalMask = 0;
+		for (auto pSignalDefinition : m_SignalDefinitionsByID) {
+			if (pSignalDefinition->getPriority () == eSignalPriority::High)
+				m_nHighPrioritySignalMask |= (1u << pSignalDefinition->getSignalID ());
+		}
 			
 		m_bIsInitializing = false;
 		
@@ -977,8 +1507,8 @@ void CSignalHandler::buildInstances ()
 	
 void CSignalHandler::releaseExpiredSignals ()
 {
-	for (auto iIter : m_SignalDefinitions)
-		iIter.second->releaseExpiredSignals ();
+	for (auto pSignalDefinition : m_SignalDefinitionsByID)
+		pSignalDefinition->releaseExpiredSignals ();
 }
 	
 	
@@ -37,6 +37,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "SystemInfo.hpp"
 #include <queue>
 
+// Parameter and result indices are assigned in registration order. Index 0 is reserved for the signal state.
+#define SIGNALPARAMETER_ACTIVEINDEX 0
+#define SIGNALRESULT_PROCESSEDINDEX 0
+#define SIGNAL_FIRSTCUSTOMINDEX 1
+
+// Signal handles combine the instance slot with the generation of its current use. Handle 0 is never valid.
+#define SIGNALHANDLE_SLOTBITS 8
+#define SIGNALHANDLE_SLOTMASK 0x000000ff
+#define SIGNALHANDLE_INVALID 0
+#define SIGNALSLOT_NONE 0xffffffff
+
+// Signal IDs are assigned in registration order per signal handler and index the pending signal mask
+#define SIGNALHANDLER_MAXSIGNALCOUNT 32
+
 namespace BuRCPP {
 	
 	enum class eSignalParameterType : int32_t {		
@@ -46,11 +60,42 @@ namespace BuRCPP {
 		Uint32ParameterType = 3,
 		DoubleParameterType = 4		
 	};
+	
+	enum class eSignalPriority : int32_t {
+		Normal = 0,
+		High = 1
+	};
+	
+	enum class eSignalInstanceState : int32_t {
+		Unused = 0,
+		InPreparation = 1,
+		Active = 2,
+		InProcess = 3,
+		Finished = 4
+	};
+	
+	typedef struct _SignalInstanceSlot {
+		eSignalInstanceState m_State;
+		uint32_t m_nGeneration;
+		uint32_t m_nNextSlot;
+	} SignalInstanceSlot;
+	
+	typedef struct _SignalInstanceQueue {
+		uint32_t m_nFirstSlot;
+		uint32_t m_nLastSlot;
+	} SignalInstanceQueue;
 
 	class CSignalSendInstance;	
 	class CSignalProcessingInstance;	
 	class CSignalDefinition;	
 	class CSignalInstanceBase;
+	class CSignalParameterDefinition;
+	
+	typedef struct _SignalParameterLayout {
+		CSignalParameterDefinition * m_pParameter;
+		eSignalParameterType m_Type;
+		uint32_t m_nMemoryAddress;
+	} SignalParameterLayout;
 
 	class CSignalParameterDefinition {
 
@@ -170,6 +215,11 @@ namespace BuRCPP {
 		uint8_t * m_pMemory;
 		uint32_t m_nMemorySize;
 		
+		int64_t readIntegerFromLayout (const SignalParameterLayout & layout);
+		double readDoubleFromLayout (const SignalParameterLayout & layout);
+		void writeIntegerToLayout (const SignalParameterLayout & layout, int64_t nValue);
+		void writeDoubleToLayout (const SignalParameterLayout & layout, double dValue);
+		
 		public:
 		
 		CSignalInstanceBase	(CSignalDefinition* pDefinition, uint32_t nInstanceID, uint8_t * pMemory, uint32_t nMemorySize);
@@ -193,6 +243,18 @@ namespace BuRCPP {
 		uint32_t getUint32Result (const std::string & sName);
 		double getDoubleResult (const std::string & sName);
 		float getFloatResult (const std::string & sName);
+		
+		bool getBoolParameter (uint32_t nIndex);
+		int32_t getInt32Parameter (uint32_t nIndex);
+		uint32_t getUint32Parameter (uint32_t nIndex);
+		double getDoubleParameter (uint32_t nIndex);
+		float getFloatParameter (uint32_t nIndex);
+		
+		bool getBoolResult (uint32_t nIndex);
+		int32_t getInt32Result (uint32_t nIndex);
+		uint32_t getUint32Result (uint32_t nIndex);
+		double getDoubleResult (uint32_t nIndex);
+		float getFloatResult (uint32_t nIndex);
 
 		bool signalIsTriggered ();
 		
@@ -214,6 +276,12 @@ namespace BuRCPP {
 		void setUint32Result (const std::string & sName, uint32_t nValue);
 		void setDoubleResult (const std::string & sName, double dValue);
 		void setFloatResult (const std::string & sName, float fValue);
+		
+		void setBoolResult (uint32_t nIndex, bool bValue);
+		void setInt32Result (uint32_t nIndex, int32_t nValue);
+		void setUint32Result (uint32_t nIndex, uint32_t nValue);
+		void setDoubleResult (uint32_t nIndex, double dValue);
+		void setFloatResult (uint32_t nIndex, float fValue);
 
 				
 		void finishProcessing ();
@@ -235,10 +303,21 @@ namespace BuRCPP {
 		void setUint32Parameter (const std::string & sName, uint32_t nValue);
 		void setDoubleParameter (const std::string & sName, double dValue);
 		void setFloatParameter (const std::string & sName, float fValue);
+		
+		void setBoolParameter (uint32_t nIndex, bool bValue);
+		void setInt32Parameter (uint32_t nIndex, int32_t nValue);
+		void setUint32Parameter (uint32_t nIndex, uint32_t nValue);
+		void setDoubleParameter (uint32_t nIndex, double dValue);
+		void setFloatParameter (uint32_t nIndex, float fValue);
 
 				
 		bool triggerSignal ();
 		
+		uint32_t getHandle ();
+		bool signalHasBeenProcessed (uint32_t nHandle);
+		using CSignalInstanceBase::signalHasBeenProcessed;
+		bool cancelSignal (uint32_t nHandle);
+		
 		void resetTriggerTime ();
 		uint64_t getTriggerTimeInMicroseconds ();
 
@@ -255,8 +334,8 @@ namespace BuRCPP {
 		CSignalInstance (CSignalDefinition* pDefinition, uint32_t nInstanceID, uint8_t * pMemory, uint32_t nMemorySize);
 		virtual ~CSignalInstance ();
 			
-		std::shared_ptr<CSignalSendInstance> getSendInstance ();
-		std::shared_ptr<CSignalProcessingInstance> getProcessingInstance ();
+		CSignalSendInstance * getSendInstance ();
+		CSignalProcessingInstance * getProcessingInstance ();
 		
 		bool signalLifeTimeIsExpired ();
 		void resetTimer ();
@@ -270,47 +349,80 @@ namespace BuRCPP {
 		std::shared_ptr<CSystemInfo> m_pSystemInfo;
 
 		std::string m_sName;
+		uint32_t m_nSignalID;
+		uint32_t * m_pPendingSignalMask;
+		eSignalPriority m_Priority;
 		uint32_t m_nQueueSize;
 		std::map<std::string, std::shared_ptr<CSignalParameterDefinition>> m_Parameters;
 		std::map<std::string, std::shared_ptr<CSignalParameterDefinition>> m_Results;
+		std::map<std::string, uint32_t> m_ParameterIndices;
+		std::map<std::string, uint32_t> m_ResultIndices;
+		std::vector<SignalParameterLayout> m_ParameterLayout;
+		std::vector<SignalParameterLayout> m_ResultLayout;
 		
 		std::vector<uint8_t> m_MemoryBuffer;
+		std::vector<uint8_t> m_DefaultMemory;
 		uint32_t m_nCurrentMemorySizePerInstance;
 		
-		std::map<uint32_t, std::shared_ptr<CSignalInstance>> m_Instances;
-		std::queue<std::shared_ptr<CSignalInstance>> m_UnusedInstanceQueue;
-		std::map<uint32_t, std::shared_ptr<CSignalInstance>> m_InPreparationInstanceQueue;
-		std::queue<std::shared_ptr<CSignalInstance>> m_ActiveInstanceQueue;
-		std::map<uint32_t, std::shared_ptr<CSignalInstance>> m_InProcessInstanceQueue;
-		std::queue<std::shared_ptr<CSignalInstance>> m_FinishedInstanceQueue;
+		// Instances are allocated once in buildInstances, the slot index equals instance ID - 1.
+		std::vector<std::shared_ptr<CSignalInstance>> m_Instances;
+		std::vector<SignalInstanceSlot> m_Slots;
+		SignalInstanceQueue m_UnusedInstanceQueue;
+		SignalInstanceQueue m_ActiveInstanceQueue;
+		SignalInstanceQueue m_FinishedInstanceQueue;
 		
 		bool isInitializing ();
+		
+		void pushSlot (SignalInstanceQueue & queue, uint32_t nSlot, eSignalInstanceState newState);
+		uint32_t popSlot (SignalInstanceQueue & queue);
+		uint32_t getSlotOfInstance (CSignalInstanceBase * pSignalInstance, eSignalInstanceState expectedState);
 
-		void registerParameter (std::shared_ptr<CSignalParameterDefinition> pParameter);
-		void registerResult (std::shared_ptr<CSignalParameterDefinition> pResult);
+		uint32_t registerParameter (std::shared_ptr<CSignalParameterDefinition> pParameter);
+		uint32_t registerResult (std::shared_ptr<CSignalParameterDefinition> pResult);
+		uint32_t verifyIndex (uint32_t nIndex, uint32_t nExpectedIndex, const std::string & sName);
 		
 		public:
 
-		CSignalDefinition (const std::string & sName, const uint32_t nQueueSize, const uint32_t nLifeTimeInMilliseconds, std::shared_ptr<CSystemInfo> pSystemInfo);
+		CSignalDefinition (const std::string & sName, const uint32_t nSignalID, uint32_t * pPendingSignalMask, const uint32_t nQueueSize, const uint32_t nLifeTimeInMilliseconds, std::shared_ptr<CSystemInfo> pSystemInfo);
 		virtual ~CSignalDefinition ();
 		
 		std::string getName ();
+		uint32_t getSignalID ();
+		
+		void setPriority (eSignalPriority priority);
+		eSignalPriority getPriority ();
+		
+		uint32_t addBoolParameter (const std::string & sName, bool bDefault);
+		uint32_t addInt32Parameter (const std::string & sName, int32_t nDefault);
+		uint32_t addUint32Parameter (const std::string & sName, uint32_t nDefault);
+		uint32_t addDoubleParameter (const std::string & sName, double dDefault);
+
+		uint32_t addBoolResult (const std::string & sName, bool bDefault);
+		uint32_t addInt32Result (const std::string & sName, int32_t nDefault);
+		uint32_t addUint32Result (const std::string & sName, uint32_t nDefault);
+		uint32_t addDoubleResult (const std::string & sName, double dDefault);
 		
-		void addBoolParameter (const std::string & sName, bool bDefault);
-		void addInt32Parameter (const std::string & sName, int32_t nDefault);
-		void addUint32Parameter (const std::string & sName, uint32_t nDefault);
-		void addDoubleParameter (const std::string & sName, double dDefault);
+		// Check the returned index against the index table of the signal, a reordered registration fails the initialization
+		uint32_t addBoolParameter (const std::string & sName, bool bDefault, uint32_t nExpectedIndex);
+		uint32_t addInt32Parameter (const std::string & sName, int32_t nDefault, uint32_t nExpectedIndex);
+		uint32_t addUint32Parameter (const std::string & sName, uint32_t nDefault, uint32_t nExpectedIndex);
+		uint32_t addDoubleParameter (const std::string & sName, double dDefault, uint32_t nExpectedIndex);
 
-		void addBoolResult (const std::string & sName, bool bDefault);
-		void addInt32Result (const std::string & sName, int32_t nDefault);
-		void addUint32Result (const std::string & sName, uint32_t nDefault);
-		void addDoubleResult (const std::string & sName, double dDefault);
+		uint32_t addBoolResult (const std::string & sName, bool bDefault, uint32_t nExpectedIndex);
+		uint32_t addInt32Result (const std::string & sName, int32_t nDefault, uint32_t nExpectedIndex);
+		uint32_t addUint32Result (const std::string & sName, uint32_t nDefault, uint32_t nExpectedIndex);
+		uint32_t addDoubleResult (const std::string & sName, double dDefault, uint32_t nExpectedIndex);
 
 		void buildInstances ();
 		
 		CSignalParameterDefinition * findParameter (const std::string & sName, bool bMustExist);
 		CSignalParameterDefinition * findResult (const std::string & sName, bool bMustExist);
 		
+		uint32_t getParameterIndex (const std::string & sName);
+		uint32_t getResultIndex (const std::string & sName);
+		const SignalParameterLayout & getParameterLayout (uint32_t nIndex);
+		const SignalParameterLayout & getResultLayout (uint32_t nIndex);
+		
 		CSignalSendInstance * prepareSignal ();
 		CSignalProcessingInstance * checkSignal ();
 		
@@ -321,6 +433,10 @@ namespace BuRCPP {
 		uint64_t getSystemTimeInMicroseconds ();
 		
 		bool signalLifeTimeIsExpired (CSignalSendInstance * pSignalInstance);
+		
+		uint32_t getInstanceHandle (CSignalInstanceBase * pSignalInstance);
+		bool signalHasBeenProcessed (uint32_t nHandle);
+		bool cancelSignal (uint32_t nHandle);
 		void releaseExpiredSignals ();
 
 	};
@@ -335,6 +451,11 @@ namespace BuRCPP {
 		std::shared_ptr<CSystemInfo> m_pSystemInfo;
 
 		std::map<std::string, std::shared_ptr<CSignalDefinition>> m_SignalDefinitions;
+		std::vector<CSignalDefinition *> m_SignalDefinitionsByID;
+		
+		// Bit n is set while signal ID n has triggered signals waiting to be checked
+		uint32_t m_nPendingSignalMask;
+		uint32_t m_nHighPrioritySignalMask;
 		
 		bool m_bIsInitializing;
 		
@@ -350,6 +471,12 @@ namespace BuRCPP {
 		CSignalProcessingInstance * checkSignal (const std::string & sName);
 		CSignalSendInstance * prepareSignal (const std::string & sName);
 		
+		CSignalProcessingInstance * checkSignal (uint32_t nSignalID);
+		CSignalSendInstance * prepareSignal (uint32_t nSignalID);
+		
+		uint32_t getSignalID (const std::string & sName);
+		bool hasPendingSignals ();
+		
 		void buildInstances ();
 		
 		void releaseExpiredSignals ();
@@ -32,17 +32,55 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "SystemInfo.hpp"
 
+#ifdef BURCPP_HOSTBUILD
+#include <chrono>
+#endif
+
+#define SYSTEMINFO_MICROSECONDSPERTICK 10000
+#define SYSTEMINFO_MICROSECONDSPERSECOND 1000000
+
 // Raw Registers
 
 namespace BuRCPP {
 
+	static uint32_t readSystemTimeRegister ()
+	{
+		// The host build advances the system time of the simulated PLC module, see CHostSimulation
+		return IOMapping_PLC.SystemTime;
+	}
+	
+	// Microseconds within the current second
+	static uint32_t readTimeInSecond ()
+	{
+#ifdef BURCPP_HOSTBUILD
+		return (uint32_t) (std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count () % SYSTEMINFO_MICROSECONDSPERSECOND);
+#else
+		// The tick is read again, in case it has elapsed between the two calls
+		uint16_t nTicks = TIM_ticks ();
+		uint16_t nMicroseconds = TIM_musec ();
+		uint16_t nTicksAfter = TIM_ticks ();
+		if (nTicksAfter != nTicks) {
+			nTicks = nTicksAfter;
+			nMicroseconds = TIM_musec ();
+		}
+		
+		if (nMicroseconds >= SYSTEMINFO_MICROSECONDSPERTICK)
+			nMicroseconds = SYSTEMINFO_MICROSECONDSPERTICK - 1;
+		
+		return (uint32_t) nTicks * SYSTEMINFO_MICROSECONDSPERTICK + nMicroseconds;
+#endif
+	}
+
 
 	CSystemInfo::CSystemInfo ()
 		: m_nSystemTimeCycle (0),
 		m_nCurrentSystemTimeRegister (0),
-		m_nStartSystemTime (0)
+		m_nStartSystemTime (0),
+		m_nFreeRunningTime (0),
+		m_nFreeRunningTimeInSecond (0)
 	{
-		m_nStartSystemTime = IOMapping_PLC.SystemTime;
+		m_nStartSystemTime = readSystemTimeRegister ();
+		m_nFreeRunningTimeInSecond = readTimeInSecond ();
 	}
 		
 	CSystemInfo::~CSystemInfo ()
@@ -61,12 +99,35 @@ namespace BuRCPP {
 	}
 	
 		
+	uint32_t CSystemInfo::getStartSystemTime ()
+	{
+		return (uint32_t) m_nStartSystemTime;
+	}
+	
+	uint64_t CSystemInfo::getFreeRunningTimeInMicroseconds ()
+	{
+		// The time within the second wraps around, so it must be read at least twice per second. This is
+		// ensured by handleCyclic. An elapsed time above half a second can only stem from the approximate
+		// microseconds of a tick going backwards, it is ignored.
+		uint32_t nTimeInSecond = readTimeInSecond ();
+		uint32_t nElapsed = (nTimeInSecond + SYSTEMINFO_MICROSECONDSPERSECOND - m_nFreeRunningTimeInSecond) % SYSTEMINFO_MICROSECONDSPERSECOND;
+		if (nElapsed < SYSTEMINFO_MICROSECONDSPERSECOND / 2) {
+			m_nFreeRunningTime += nElapsed;
+			m_nFreeRunningTimeInSecond = nTimeInSecond;
+		}
+		
+		return m_nFreeRunningTime;
+	}
+	
+		
 	void CSystemInfo::handleCyclic ()
 	{
-		uint32_t nNewRegister = IOMapping_PLC.SystemTime;
+		uint32_t nNewRegister = readSystemTimeRegister ();
 		if (nNewRegister < m_nCurrentSystemTimeRegister)
 			m_nSystemTimeCycle ++;
 		m_nCurrentSystemTimeRegister = nNewRegister;
+		
+		getFreeRunningTimeInMicroseconds ();
 	}
 	
 }
\ No newline at end of file
@@ -43,6 +43,8 @@ namespace BuRCPP {
 			uint64_t m_nStartSystemTime;
 			uint64_t m_nSystemTimeCycle;
 			uint32_t m_nCurrentSystemTimeRegister;
+			uint64_t m_nFreeRunningTime;
+			uint32_t m_nFreeRunningTimeInSecond;
 
 		public:
 		
@@ -52,6 +54,12 @@ namespace BuRCPP {
 		uint64_t getSystemTimeInMicroseconds ();	
 
 		uint64_t getSystemTimeInMilliseconds ();	
+		
+		uint32_t getStartSystemTime ();
+		
+		// IOMapping_PLC.SystemTime is only updated once per task cycle. Durations within a cycle are
+		// measured with this timer, which keeps running while the cycle is executed.
+		uint64_t getFreeRunningTimeInMicroseconds ();
 				
 		void handleCyclic ();
 		
@@ -32,17 +32,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "TcpListHandler.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <stdexcept>
 
 
 
 namespace BuRCPP {
 	
 
-	CPayloadEnvironment::CPayloadEnvironment (TcpListEntryContext * pContext, TcpIncomingPayload * pPayload, CSignalHandlerRegistry * pSignalHandlerRegistry)
-		: m_pContext (pContext), m_pPayload (pPayload), m_pSignalHandlerRegistry (pSignalHandlerRegistry)
+	CPayloadEnvironment::CPayloadEnvironment (TcpListEntryContext * pContext, TcpIncomingPayload * pPayload, CSignalHandlerRegistry * pSignalHandlerRegistry, CTcpListHandler * pListHandler, uint32_t nLane)
+		: m_pContext (pContext), m_pPayload (pPayload), m_pSignalHandlerRegistry (pSignalHandlerRegistry), m_pListHandler (pListHandler), m_nLane (nLane)
 	{
-		if ((pContext == nullptr) || (pPayload == nullptr) || (pSignalHandlerRegistry == nullptr))
+		if ((pContext == nullptr) || (pPayload == nullptr) || (pSignalHandlerRegistry == nullptr) || (pListHandler == nullptr))
 			throw CException (eErrorCode::INVALIDPARAM, "invalid payload environment parameters");
 		
 	}
@@ -148,92 +150,140 @@ namespace BuRCPP {
 		
 	uint32_t CPayloadEnvironment::getContextSize ()
 	{
-		return sizeof (m_pContext->m_ContextData);
+		return LISTCONTEXT_DATASIZE;
 	}
 		
 	void CPayloadEnvironment::readContextData (uint8_t * pTarget, uint32_t nAddress, uint32_t nByteCount)
 	{
+		if (nByteCount == 0)
+			return;
+		
+		if (pTarget == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid read context target parameter");
+		
+		if (nAddress >= LISTCONTEXT_DATASIZE)
+			throw CException (eErrorCode::INVALIDCONTEXTADDRESS, "invalid context address");
+		
+		if (nByteCount > (LISTCONTEXT_DATASIZE - nAddress))
+			throw CException (eErrorCode::INVALIDCONTEXTREADOPERATION, "context read buffer overflow");
+
+		memcpy (pTarget, &m_pContext->m_ContextData[nAddress], nByteCount);
 	}
 	
 	uint8_t CPayloadEnvironment::readContextUint8 (uint32_t nAddress)
 	{
-		
+		uint8_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
 	
 	uint16_t CPayloadEnvironment::readContextUint16 (uint32_t nAddress)
 	{
-	
+		uint16_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
 	
-	
 	uint32_t CPayloadEnvironment::readContextUint32 (uint32_t nAddress)
 	{
-		
+		uint32_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
 	
 	int8_t CPayloadEnvironment::readContextInt8 (uint32_t nAddress)
 	{
-		
+		int8_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
-		
+	
 	int16_t CPayloadEnvironment::readContextInt16 (uint32_t nAddress)
 	{
-	
+		int16_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
 	
 	int32_t CPayloadEnvironment::readContextInt32 (uint32_t nAddress)
 	{
-		
+		int32_t nResult = 0;
+		readContextData ((uint8_t*)&nResult, nAddress, sizeof (nResult));
+		return nResult;
 	}
 	
 	double CPayloadEnvironment::readContextDouble (uint32_t nAddress)
 	{
-		
+		double dResult = 0.0;
+		readContextData ((uint8_t*)&dResult, nAddress, sizeof (dResult));
+		return dResult;
 	}
 	
 	float CPayloadEnvironment::readContextFloat (uint32_t nAddress)
 	{
-	
+		float fResult = 0.0;
+		readContextData ((uint8_t*)&fResult, nAddress, sizeof (fResult));
+		return fResult;
 	}
-
+	
 	void CPayloadEnvironment::writeContextData (uint8_t * pSource, uint32_t nAddress, uint32_t nByteCount)
 	{
+		if (nByteCount == 0)
+			return;
+		
+		if (pSource == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid write context source parameter");
+		
+		if (nAddress >= LISTCONTEXT_DATASIZE)
+			throw CException (eErrorCode::INVALIDCONTEXTADDRESS, "invalid context address");
 		
+		if (nByteCount > (LISTCONTEXT_DATASIZE - nAddress))
+			throw CException (eErrorCode::INVALIDCONTEXTWRITEOPERATION, "context write buffer overflow");
+
+		memcpy (&m_pContext->m_ContextData[nAddress], pSource, nByteCount);
 	}
 	
 	void CPayloadEnvironment::writeContextUint8 (uint32_t nAddress, uint8_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
 	
 	void CPayloadEnvironment::writeContextUint16 (uint32_t nAddress, uint16_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
 	
 	void CPayloadEnvironment::writeContextUint32 (uint32_t nAddress, uint32_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
 	
 	void CPayloadEnvironment::writeContextInt8 (uint32_t nAddress, int8_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
 	
 	void CPayloadEnvironment::writeContextInt16 (uint32_t nAddress, int16_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
-		
+	
 	void CPayloadEnvironment::writeContextInt32 (uint32_t nAddress, int32_t nValue)
 	{
+		writeContextData ((uint8_t*)&nValue, nAddress, sizeof (nValue));
 	}
 	
 	void CPayloadEnvironment::writeContextDouble (uint32_t nAddress, double dValue)
 	{
+		writeContextData ((uint8_t*)&dValue, nAddress, sizeof (dValue));
 	}
 	
 	void CPayloadEnvironment::writeContextFloat (uint32_t nAddress, float dValue)
 	{
+		writeContextData ((uint8_t*)&dValue, nAddress, sizeof (dValue));
 	}
 	
-	
+
 	void CPayloadEnvironment::setLifetimeInMillseconds (uint32_t nLifeTimeInMilliseconds)
 	{
 		m_pContext->m_nLifeTimeInMilliseconds = nLifeTimeInMilliseconds;
@@ -249,9 +299,15 @@ namespace BuRCPP {
 		
 		auto pSignalHandler = m_pSignalHandlerRegistry->findSignalHandler (sStateHandlerName, true);
 		
+		// Lists in different lanes must not drive the same state handler at the same time.
+		if (m_pListHandler->signalHandlerIsBusyInOtherLane (pSignalHandler, m_nLane))
+			throw CException (eErrorCode::LISTLANECONFLICT, "state handler is busy in another list lane: " + sStateHandlerName);
+		
 		CSignalSendInstance * pSignalInstance = pSignalHandler->prepareSignal (sSignalName);		
 		
 		m_pContext->m_pSignalSlots[nSignalSlotIndex] = pSignalInstance;
+		m_pContext->m_pSignalSlotHandlers[nSignalSlotIndex] = pSignalHandler;
+		m_pContext->m_nSignalSlotHandles[nSignalSlotIndex] = pSignalInstance->getHandle ();
 		
 		return pSignalInstance;
 	}
@@ -270,8 +326,9 @@ namespace BuRCPP {
 	
 	bool CPayloadEnvironment::signalHasBeenProcessed (uint32_t nSignalSlot)
 	{
+		// The handle detects instances that have been recycled since the signal was prepared.
 		CSignalSendInstance * pSignalInstance = getSignal (nSignalSlot, true);
-		return pSignalInstance->signalHasBeenProcessed ();
+		return pSignalInstance->signalHasBeenProcessed (m_pContext->m_nSignalSlotHandles[nSignalSlot]);
 	}
 	
 	class CTcpPacketHandler_BeginList : public CTcpPacketHandler_Direct {
@@ -360,12 +417,118 @@ namespace BuRCPP {
 		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
 		{
 			uint32_t nListID = readUint32FromPayload (pPayload, 0);
-			TcpList * pList = m_pListHandler->executeList (nListID);
+			uint32_t nLane = readUint32FromPayload (pPayload, 4);
+			TcpList * pList = m_pListHandler->executeList (nListID, nLane);
 		
 			pResponse->addUint32(pList->m_nEntryCount);
 		}
 	};
 
+	class CTcpPacketHandler_BatchList : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+		CTcpPacketRegistry* m_pPacketRegistry;
+			
+		public: 
+			
+		CTcpPacketHandler_BatchList (CTcpListHandler * pListHandler, CTcpPacketRegistry * pPacketRegistry)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler), m_pPacketRegistry (pPacketRegistry)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_BatchList ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_BATCHLIST;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			handleExtendedPacket (pPayload->m_Data, sizeof (TcpIncomingPayload), pResponse);
+		}
+		
+		void handleExtendedPacket (uint8_t * pPayload, uint32_t nPayloadSize, CTcpPacketResponse * pResponse) override
+		{
+			TcpList * pList = m_pListHandler->uploadList (m_pPacketRegistry, pPayload, nPayloadSize);
+			
+			pResponse->addUint32(pList->m_nListId);
+			pResponse->addUint32(pList->m_nEntryCount);
+		}
+	};
+
+	class CTcpPacketHandler_DefineListTemplate : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+			
+		public: 
+			
+		CTcpPacketHandler_DefineListTemplate (CTcpListHandler * pListHandler)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_DefineListTemplate ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_DEFINELISTTEMPLATE;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			handleExtendedPacket (pPayload->m_Data, sizeof (TcpIncomingPayload), pResponse);
+		}
+		
+		void handleExtendedPacket (uint8_t * pPayload, uint32_t nPayloadSize, CTcpPacketResponse * pResponse) override
+		{
+			m_pListHandler->defineListTemplate (pPayload, nPayloadSize);
+			
+			pResponse->addUint32(readUint32FromData (pPayload, nPayloadSize, 0));
+		}
+	};
+
+	class CTcpPacketHandler_InstantiateListTemplate : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+			
+		public: 
+			
+		CTcpPacketHandler_InstantiateListTemplate (CTcpListHandler * pListHandler)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_InstantiateListTemplate ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_INSTANTIATELISTTEMPLATE;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			handleExtendedPacket (pPayload->m_Data, sizeof (TcpIncomingPayload), pResponse);
+		}
+		
+		void handleExtendedPacket (uint8_t * pPayload, uint32_t nPayloadSize, CTcpPacketResponse * pResponse) override
+		{
+			TcpList * pList = m_pListHandler->instantiateListTemplate (pPayload, nPayloadSize);
+			
+			pResponse->addUint32(pList->m_nListId);
+			pResponse->addUint32(pList->m_nEntryCount);
+		}
+	};
+
 		class CTcpPacketHandler_ListStatus : public CTcpPacketHandler_Direct {
 			private:
 			CTcpListHandler* m_pListHandler;
@@ -401,12 +564,18 @@ namespace BuRCPP {
 						} else {
 							pResponse->addUint32(0);
 						}
+						pResponse->addUint32(pList->m_nLane);
+						pResponse->addUint32(pList->m_nErrorEntryIndex);
+						pResponse->addUint32((uint32_t)pList->m_ErrorCode);
 
 					} else {
 						pResponse->addUint32(0);
 						pResponse->addUint32(0);
 						pResponse->addUint32(0);
 						pResponse->addUint32(0);
+						pResponse->addUint32(0);
+						pResponse->addUint32(0);
+						pResponse->addUint32(0);
 					}
 				
 					
@@ -414,6 +583,108 @@ namespace BuRCPP {
 			
 	};	
 
+	class CTcpPacketHandler_AbortList : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+			
+		public: 
+			
+		CTcpPacketHandler_AbortList (CTcpListHandler * pListHandler)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_AbortList ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_ABORTLIST;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			uint32_t nListID = readUint32FromPayload (pPayload, 0);
+			TcpList * pList = m_pListHandler->abortList (nListID);
+		
+			pResponse->addUint32((uint32_t)pList->m_ListState);
+			pResponse->addUint32(pList->m_nErrorEntryIndex);
+		}
+	};
+
+	class CTcpPacketHandler_DeleteList : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+			
+		public: 
+			
+		CTcpPacketHandler_DeleteList (CTcpListHandler * pListHandler)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_DeleteList ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_DELETELIST;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			uint32_t nListID = readUint32FromPayload (pPayload, 0);
+			m_pListHandler->deleteList (nListID);
+		
+			pResponse->addUint32(nListID);
+		}
+	};
+
+	class CTcpPacketHandler_ResumeList : public CTcpPacketHandler_Direct {
+		private:
+		CTcpListHandler* m_pListHandler;
+			
+		public: 
+			
+		CTcpPacketHandler_ResumeList (CTcpListHandler * pListHandler)
+			: CTcpPacketHandler_Direct (), m_pListHandler (pListHandler)
+		{
+		}
+			
+		virtual ~CTcpPacketHandler_ResumeList ()
+		{
+		}
+				
+			
+		virtual uint32_t getCommandID () override
+		{
+			return COMMAND_DEFAULT_RESUMELIST;
+		}
+					
+		void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) override
+		{
+			uint32_t nListID = readUint32FromPayload (pPayload, 0);
+			uint32_t nResumeMode = readUint32FromPayload (pPayload, 4);
+			uint32_t nLane = readUint32FromPayload (pPayload, 8);
+			
+			if ((nResumeMode != (uint32_t)eListResumeMode::RetryEntry) && (nResumeMode != (uint32_t)eListResumeMode::SkipEntry))
+				throw CException (eErrorCode::INVALIDLISTRESUMEMODE, "invalid list resume mode: " + std::to_string (nResumeMode));
+			
+			TcpList * pList = m_pListHandler->resumeList (nListID, nLane, (eListResumeMode)nResumeMode);
+		
+			pResponse->addUint32((uint32_t)pList->m_ListState);
+			if (pList->m_pCurrentEntry != nullptr) {
+				pResponse->addUint32(pList->m_pCurrentEntry->m_nIndexInList);
+			} else {
+				pResponse->addUint32(0);
+			}
+		}
+	};
+
 	
 CTcpPacketHandler_Buffered::CTcpPacketHandler_Buffered (CTcpListHandler * pListHandler)
 	: CTcpPacketHandler (), m_pListHandler (pListHandler)
@@ -450,8 +721,9 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 	
 	
 	CTcpListHandler::CTcpListHandler (uint32_t nListBufferSize, uint32_t nListEntryBufferSize, CSignalHandlerRegistry * pSignalHandlerRegistry)
-	: m_pUnusedLists (nullptr), m_pUnusedListEntries (nullptr), m_pCurrentWriteList (nullptr), m_pCurrentExecutionList (nullptr), m_pSignalHandlerRegistry (pSignalHandlerRegistry)
+	: m_pUnusedLists (nullptr), m_pUnusedListEntries (nullptr), m_pCurrentWriteList (nullptr), m_nEntryBudgetPerCycle (LISTHANDLER_DEFAULTENTRYBUDGET), m_pSignalHandlerRegistry (pSignalHandlerRegistry)
 	{
+		m_ExecutionLists.fill (nullptr);
 	
 		if (pSignalHandlerRegistry == nullptr)
 			throw std::runtime_error ("invalid signal handler registry param");
@@ -466,10 +738,13 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 			auto pList = &m_ListBuffer[nListIndex];
 			pList->m_nListId = nListIndex + 1;
 			pList->m_nEntryCount = 0;
+			pList->m_nLane = 0;
 			pList->m_pLastEntry = nullptr;
 			pList->m_pFirstEntry = nullptr;
 			pList->m_pCurrentEntry = nullptr;
 			pList->m_ListState = eListState::ListInQueue;
+			pList->m_nErrorEntryIndex = 0;
+			pList->m_ErrorCode = eErrorCode::UNKNOWN;
 			
 			pList->m_pNextUnusedList = m_pUnusedLists;
 			m_pUnusedLists = pList;
@@ -503,10 +778,16 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_FinishList> (this));
 		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_ExecuteList> (this));
 		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_ListStatus> (this));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_ResumeList> (this));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_AbortList> (this));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_DeleteList> (this));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_BatchList> (this, pPacketRegistry));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_DefineListTemplate> (this));
+		pPacketRegistry->registerHandler (std::make_shared<CTcpPacketHandler_InstantiateListTemplate> (this));
 	
 	}
 		
-	uint32_t CTcpListHandler::beginList ()
+	TcpList * CTcpListHandler::allocateList ()
 	{
 		if (m_pUnusedLists == nullptr)
 			throw CException (eErrorCode::TOOMANYOPENLISTS, "too many open lists!");
@@ -514,34 +795,272 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 		if (m_pUnusedLists->m_ListState != eListState::ListInQueue)
 			throw CException (eErrorCode::LISTISNOTINQUEUE, "list is not in queue!");
 	
-		m_pCurrentWriteList = m_pUnusedLists;
+		auto pList = m_pUnusedLists;
 		m_pUnusedLists = m_pUnusedLists->m_pNextUnusedList;
 
-		m_pCurrentWriteList->m_nEntryCount = 0;
-		m_pCurrentWriteList->m_pCurrentEntry = nullptr;
-		m_pCurrentWriteList->m_pFirstEntry = nullptr;
-		m_pCurrentWriteList->m_pLastEntry = nullptr;
-		m_pCurrentWriteList->m_pNextUnusedList = nullptr;
-		m_pCurrentWriteList->m_ListState = eListState::ListInCreation;
+		pList->m_nEntryCount = 0;
+		pList->m_pCurrentEntry = nullptr;
+		pList->m_pFirstEntry = nullptr;
+		pList->m_pLastEntry = nullptr;
+		pList->m_pNextUnusedList = nullptr;
+		pList->m_nErrorEntryIndex = 0;
+		pList->m_ErrorCode = eErrorCode::UNKNOWN;
+		pList->m_ListState = eListState::ListInCreation;
+	
+		return pList;
+	}
+	
+	void CTcpListHandler::releaseList (TcpList * pList)
+	{
+		auto pEntry = pList->m_pFirstEntry;
+		while (pEntry != nullptr) {
+			auto pNextEntry = pEntry->m_pNext;
+			
+			pEntry->m_PacketHandler = nullptr;
+			pEntry->m_nIndexInList = 0;
+			pEntry->m_pNext = m_pUnusedListEntries;
+			m_pUnusedListEntries = pEntry;
+			
+			pEntry = pNextEntry;
+		}
+		
+		pList->m_nEntryCount = 0;
+		pList->m_nLane = 0;
+		pList->m_pFirstEntry = nullptr;
+		pList->m_pLastEntry = nullptr;
+		pList->m_pCurrentEntry = nullptr;
+		pList->m_nErrorEntryIndex = 0;
+		pList->m_ErrorCode = eErrorCode::UNKNOWN;
+		pList->m_ListState = eListState::ListInQueue;
+		
+		pList->m_pNextUnusedList = m_pUnusedLists;
+		m_pUnusedLists = pList;
+	}
+	
+	void CTcpListHandler::releaseTemplateInstances (TcpListTemplate * pTemplate)
+	{
+		// Earlier instances are not needed anymore once they have run through.
+		// Failed instances are kept until they are resumed or deleted, the others until a later call.
+		auto iInstance = pTemplate->m_InstanceListIds.begin ();
+		while (iInstance != pTemplate->m_InstanceListIds.end ()) {
+			auto pInstance = getListByID (*iInstance, false);
+			if (pInstance == nullptr) {
+				iInstance = pTemplate->m_InstanceListIds.erase (iInstance);
+			} else if (pInstance->m_ListState == eListState::ExecutionFinished) {
+				releaseList (pInstance);
+				iInstance = pTemplate->m_InstanceListIds.erase (iInstance);
+			} else {
+				iInstance++;
+			}
+		}
+	}
+	
+	uint32_t CTcpListHandler::beginList ()
+	{
+		m_pCurrentWriteList = allocateList ();
 	
 		return m_pCurrentWriteList->m_nListId;
 	}
 
+	void CTcpListHandler::finishList (TcpList * pList)
+	{
+		if (pList->m_ListState != eListState::ListInCreation)
+			throw CException (eErrorCode::NOTINLISTCREATION, "list not in creation!");	
+		if (pList->m_pFirstEntry == nullptr)
+			throw CException (eErrorCode::LISTISEMPTY, "list is empty!");
+	
+		pList->m_ListState = eListState::ListFinished;
+	}
 
 	TcpList* CTcpListHandler::finishList ()
 	{
 	
 		if (m_pCurrentWriteList == nullptr)
 			throw CException (eErrorCode::NOTWRITINGTOANYLIST, "not writing to any list!");
-		if (m_pCurrentWriteList->m_ListState != eListState::ListInCreation)
-			throw CException (eErrorCode::NOTINLISTCREATION, "list not in creation!");	
-		if (m_pCurrentWriteList->m_pFirstEntry == nullptr)
-			throw CException (eErrorCode::LISTISEMPTY, "list is empty!");
 	
 		auto pList = m_pCurrentWriteList;
+		finishList (pList);
 		m_pCurrentWriteList = nullptr;
 	
-		pList->m_ListState = eListState::ListFinished;
+		return pList;
+	}
+	
+	bool CTcpListHandler::canAllocateList (uint32_t nEntryCount)
+	{
+		if (m_pUnusedLists == nullptr)
+			return false;
+		
+		TcpListEntry * pEntry = m_pUnusedListEntries;
+		for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+			if (pEntry == nullptr)
+				return false;
+			pEntry = pEntry->m_pNext;
+		}
+		
+		return true;
+	}
+	
+	TcpList * CTcpListHandler::uploadList (CTcpPacketRegistry * pPacketRegistry, uint8_t * pData, uint32_t nDataSize)
+	{
+		if (pPacketRegistry == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet registry parameter");
+		
+		uint32_t nFlags = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 0);
+		uint32_t nEntryCount = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 4);
+		if (nEntryCount == 0)
+			throw CException (eErrorCode::LISTISEMPTY, "list is empty!");
+		if ((nDataSize - LISTBATCH_HEADERSIZE) / LISTBATCH_ENTRYSIZE < nEntryCount)
+			throw CException (eErrorCode::INVALIDPAYLOAD, "batch list payload too short");
+		
+		uint32_t nLane = (nFlags & LISTBATCH_FLAG_LANEMASK) >> LISTBATCH_FLAG_LANESHIFT;
+		if (nLane >= LISTHANDLER_LANECOUNT)
+			throw CException (eErrorCode::INVALIDLISTLANE, "invalid list lane: " + std::to_string (nLane));
+		if (((nFlags & LISTBATCH_FLAG_EXECUTE) != 0) && (m_ExecutionLists[nLane] != nullptr))
+			throw CException (eErrorCode::LISTLANECONFLICT, "list lane is busy: " + std::to_string (nLane));
+		
+		// Validate all entries first, so that a failing batch does not leave a partial list behind.
+		for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+			uint32_t nCommandID = CTcpPacketHandler::readUint32FromData (pData, nDataSize, LISTBATCH_HEADERSIZE + nIndex * LISTBATCH_ENTRYSIZE);
+			auto pHandler = pPacketRegistry->findHandler (nCommandID, true);
+			if (dynamic_cast<CTcpPacketHandler_Buffered*> (pHandler) == nullptr)
+				throw CException (eErrorCode::COMMANDISNOTBUFFERED, "command is not buffered: " + std::to_string (nCommandID));
+		}
+		
+		if (!canAllocateList (nEntryCount)) {
+			if (m_pUnusedLists == nullptr)
+				throw CException (eErrorCode::TOOMANYOPENLISTS, "too many open lists!");
+			throw CException (eErrorCode::NOLISTENTRIESLEFT, "no list entries left");
+		}
+		
+		auto pList = allocateList ();
+		for (uint32_t nIndex = 0; nIndex < nEntryCount; nIndex++) {
+			uint8_t * pEntryData = &pData[LISTBATCH_HEADERSIZE + nIndex * LISTBATCH_ENTRYSIZE];
+			
+			uint32_t nCommandID;
+			TcpIncomingPayload payload;
+			memcpy (&nCommandID, pEntryData, sizeof (nCommandID));
+			memcpy (&payload, pEntryData + sizeof (nCommandID), sizeof (payload));
+			
+			auto pHandler = dynamic_cast<CTcpPacketHandler_Buffered*> (pPacketRegistry->findHandler (nCommandID, true));
+			addEntryToList (pList, pHandler, &payload);
+		}
+		
+		finishList (pList);
+		
+		if ((nFlags & LISTBATCH_FLAG_EXECUTE) != 0)
+			executeList (pList->m_nListId, nLane);
+		
+		return pList;
+	}
+
+
+	void CTcpListHandler::defineListTemplate (uint8_t * pData, uint32_t nDataSize)
+	{
+		uint32_t nTemplateID = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 0);
+		uint32_t nListID = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 4);
+		uint32_t nPatchCount = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 8);
+		
+		if (nTemplateID == 0)
+			throw CException (eErrorCode::INVALIDLISTTEMPLATEID, "invalid list template ID");
+		if ((nDataSize - LISTTEMPLATE_HEADERSIZE) / LISTTEMPLATE_PATCHSIZE < nPatchCount)
+			throw CException (eErrorCode::INVALIDPAYLOAD, "list template payload too short");
+		
+		auto iIterator = m_ListTemplates.find (nTemplateID);
+		if ((iIterator == m_ListTemplates.end ()) && (m_ListTemplates.size () >= LISTTEMPLATE_MAXCOUNT))
+			throw CException (eErrorCode::TOOMANYLISTTEMPLATES, "too many list templates");
+		
+		auto pList = getListByID (nListID, true);
+		if (pList->m_ListState == eListState::ListInCreation)
+			throw CException (eErrorCode::LISTISNOTFINISHED, "list is not in finished!");
+		
+		auto pTemplate = std::make_shared<TcpListTemplate> ();
+		pTemplate->m_nTemplateId = nTemplateID;
+		pTemplate->m_nParameterCount = 0;
+		
+		// Instances of a redefined template are still owned by the template ID.
+		if (iIterator != m_ListTemplates.end ())
+			pTemplate->m_InstanceListIds = iIterator->second->m_InstanceListIds;
+		
+		pTemplate->m_Entries.reserve (pList->m_nEntryCount);
+		for (auto pEntry = pList->m_pFirstEntry; pEntry != nullptr; pEntry = pEntry->m_pNext) {
+			TcpListTemplateEntry templateEntry;
+			templateEntry.m_PacketHandler = pEntry->m_PacketHandler;
+			templateEntry.m_Payload = pEntry->m_Payload;
+			pTemplate->m_Entries.push_back (templateEntry);
+		}
+		
+		pTemplate->m_Patches.reserve (nPatchCount);
+		for (uint32_t nIndex = 0; nIndex < nPatchCount; nIndex++) {
+			uint32_t nPatchOffset = LISTTEMPLATE_HEADERSIZE + nIndex * LISTTEMPLATE_PATCHSIZE;
+			
+			TcpListTemplatePatch patch;
+			patch.m_nEntryIndex = CTcpPacketHandler::readUint32FromData (pData, nDataSize, nPatchOffset);
+			patch.m_nPayloadOffset = CTcpPacketHandler::readUint32FromData (pData, nDataSize, nPatchOffset + 4);
+			patch.m_nParameterIndex = CTcpPacketHandler::readUint32FromData (pData, nDataSize, nPatchOffset + 8);
+			
+			if ((patch.m_nEntryIndex >= pTemplate->m_Entries.size ()) || 
+				(patch.m_nPayloadOffset > sizeof (TcpIncomingPayload) - sizeof (int32_t)) ||
+				(patch.m_nParameterIndex >= LISTTEMPLATE_MAXPARAMETERS))
+				throw CException (eErrorCode::INVALIDLISTTEMPLATEPATCH, "invalid list template patch: " + std::to_string (nIndex));
+			
+			if (patch.m_nParameterIndex >= pTemplate->m_nParameterCount)
+				pTemplate->m_nParameterCount = patch.m_nParameterIndex + 1;
+			
+			pTemplate->m_Patches.push_back (patch);
+		}
+		
+		m_ListTemplates[nTemplateID] = pTemplate;
+	}
+	
+	TcpList * CTcpListHandler::instantiateListTemplate (uint8_t * pData, uint32_t nDataSize)
+	{
+		uint32_t nTemplateID = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 0);
+		uint32_t nFlags = CTcpPacketHandler::readUint32FromData (pData, nDataSize, 4);
+		
+		auto iIterator = m_ListTemplates.find (nTemplateID);
+		if (iIterator == m_ListTemplates.end ())
+			throw CException (eErrorCode::LISTTEMPLATENOTFOUND, "list template not found: " + std::to_string (nTemplateID));
+		auto pTemplate = iIterator->second;
+		
+		uint32_t nParameterCount = (nDataSize - LISTTEMPLATE_INSTANCEHEADERSIZE) / sizeof (int32_t);
+		if (nParameterCount < pTemplate->m_nParameterCount)
+			throw CException (eErrorCode::INVALIDPAYLOAD, "too few list template parameters");
+		
+		uint32_t nLane = (nFlags & LISTBATCH_FLAG_LANEMASK) >> LISTBATCH_FLAG_LANESHIFT;
+		if (nLane >= LISTHANDLER_LANECOUNT)
+			throw CException (eErrorCode::INVALIDLISTLANE, "invalid list lane: " + std::to_string (nLane));
+		if (((nFlags & LISTBATCH_FLAG_EXECUTE) != 0) && (m_ExecutionLists[nLane] != nullptr))
+			throw CException (eErrorCode::LISTLANECONFLICT, "list lane is busy: " + std::to_string (nLane));
+		
+		releaseTemplateInstances (pTemplate.get ());
+		
+		if (!canAllocateList (pTemplate->m_Entries.size ())) {
+			if (m_pUnusedLists == nullptr)
+				throw CException (eErrorCode::TOOMANYOPENLISTS, "too many open lists!");
+			throw CException (eErrorCode::NOLISTENTRIESLEFT, "no list entries left");
+		}
+		
+		auto pList = allocateList ();
+		for (auto & templateEntry : pTemplate->m_Entries) 
+			addEntryToList (pList, templateEntry.m_PacketHandler, &templateEntry.m_Payload);
+		
+		// Entries are linked in template order, the patches are applied per entry index.
+		for (auto & patch : pTemplate->m_Patches) {
+			auto pEntry = pList->m_pFirstEntry;
+			for (uint32_t nIndex = 0; nIndex < patch.m_nEntryIndex; nIndex++)
+				pEntry = pEntry->m_pNext;
+			
+			int32_t nValue;
+			memcpy (&nValue, &pData[LISTTEMPLATE_INSTANCEHEADERSIZE + patch.m_nParameterIndex * sizeof (int32_t)], sizeof (nValue));
+			memcpy (&pEntry->m_Payload.m_Data[patch.m_nPayloadOffset], &nValue, sizeof (nValue));
+		}
+		
+		finishList (pList);
+		pTemplate->m_InstanceListIds.push_back (pList->m_nListId);
+		
+		if ((nFlags & LISTBATCH_FLAG_EXECUTE) != 0)
+			executeList (pList->m_nListId, nLane);
+		
 		return pList;
 	}
 
@@ -549,7 +1068,7 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 	TcpList* CTcpListHandler::getListByID (uint32_t nListID, bool bListMustExist)
 	{
 		TcpList * pList = nullptr;
-		if ((nListID > 0) || (nListID <= m_ListBuffer.size ())) {
+		if ((nListID > 0) && (nListID <= m_ListBuffer.size ())) {
 			pList = &m_ListBuffer.at (nListID - 1);
 			if (pList->m_ListState == eListState::ListInQueue)
 				pList = nullptr;
@@ -561,9 +1080,10 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 		return pList;
 	}
 
-	TcpList* CTcpListHandler::executeList (uint32_t nListID)
+	TcpList* CTcpListHandler::executeList (uint32_t nListID, uint32_t nLane)
 	{
-		m_pCurrentExecutionList = nullptr;
+		if (nLane >= LISTHANDLER_LANECOUNT)
+			throw CException (eErrorCode::INVALIDLISTLANE, "invalid list lane: " + std::to_string (nLane));
 	
 		if ((nListID == 0) || (nListID > m_ListBuffer.size ()))
 			throw CException (eErrorCode::INVALIDLISTID, "invalid list ID");
@@ -573,12 +1093,102 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 			throw CException (eErrorCode::LISTISNOTFINISHED, "list is not in finished!");
 		if (pList->m_pFirstEntry == nullptr)
 			throw CException (eErrorCode::LISTISEMPTY, "list is empty!");
+		// A running list keeps its lane until it finishes, fails or is aborted.
+		if (m_ExecutionLists[nLane] != nullptr)
+			throw CException (eErrorCode::LISTLANECONFLICT, "list lane is busy: " + std::to_string (nLane));
+	
+		// The lane is only touched once the list is known to be executable.
+		pList->m_nLane = nLane;
+		pList->m_pCurrentEntry = pList->m_pFirstEntry;
+		pList->m_nErrorEntryIndex = 0;
+		pList->m_ErrorCode = eErrorCode::UNKNOWN;
+		pList->m_ListState = eListState::ExecutingList;
+		m_ExecutionLists[nLane] = pList;
 	
-		m_pCurrentExecutionList = pList;	
-		m_pCurrentExecutionList->m_pCurrentEntry = m_pCurrentExecutionList->m_pFirstEntry;
-		m_pCurrentExecutionList->m_ListState = eListState::ExecutingList;
+		return pList;
+	}
 	
-		return m_pCurrentExecutionList;
+	TcpList* CTcpListHandler::resumeList (uint32_t nListID, uint32_t nLane, eListResumeMode resumeMode)
+	{
+		if (nLane >= LISTHANDLER_LANECOUNT)
+			throw CException (eErrorCode::INVALIDLISTLANE, "invalid list lane: " + std::to_string (nLane));
+		if (m_ExecutionLists[nLane] != nullptr)
+			throw CException (eErrorCode::LISTLANECONFLICT, "list lane is busy: " + std::to_string (nLane));
+		
+		auto pList = getListByID (nListID, true);
+		if ((pList->m_ListState != eListState::ExecutionError) || (pList->m_pCurrentEntry == nullptr))
+			throw CException (eErrorCode::LISTISNOTINERRORSTATE, "list is not in error state!");
+		
+		auto pFailedEntry = pList->m_pCurrentEntry;
+		switch (resumeMode) {
+			case eListResumeMode::RetryEntry:
+				// Withdrawable signals are gone already, a signal that is still in process would be delivered twice.
+				for (uint32_t nSlotIndex = 0; nSlotIndex < LISTCONTEXT_SIGNALSLOTCOUNT; nSlotIndex++) {
+					auto pSignalInstance = pFailedEntry->m_ExecutionContext.m_pSignalSlots[nSlotIndex];
+					if (pSignalInstance != nullptr) {
+						if (!pSignalInstance->signalHasBeenProcessed (pFailedEntry->m_ExecutionContext.m_nSignalSlotHandles[nSlotIndex]))
+							throw CException (eErrorCode::SIGNALSTILLINPROCESS, "signal of failed entry is still in process: " + std::to_string (nSlotIndex));
+					}
+				}
+				
+				// Run the failed entry again from the start, the entries before it are not replayed.
+				memset ((void*)&pFailedEntry->m_ExecutionContext, 0, sizeof (pFailedEntry->m_ExecutionContext));
+				pFailedEntry->m_ExecutionContext.m_nEntryState = eListEntryState::InQueue;
+				break;
+				
+			case eListResumeMode::SkipEntry:
+				pList->m_pCurrentEntry = pFailedEntry->m_pNext;
+				break;
+				
+			default:
+				throw CException (eErrorCode::INVALIDLISTRESUMEMODE, "invalid list resume mode");
+		}
+		
+		pList->m_nLane = nLane;
+		pList->m_ListState = eListState::ExecutingList;
+		m_ExecutionLists[nLane] = pList;
+		
+		return pList;
+	}
+
+	TcpList* CTcpListHandler::abortList (uint32_t nListID)
+	{
+		auto pList = getListByID (nListID, true);
+		if ((pList->m_ListState != eListState::ExecutingList) || (m_ExecutionLists[pList->m_nLane] != pList))
+			throw CException (eErrorCode::LISTISNOTEXECUTING, "list is not executing!");
+		
+		// The lane is released right away, also if the current entry still waits for a signal.
+		// The list ends up in the error state, so that it can be resumed like a failed list.
+		m_ExecutionLists[pList->m_nLane] = nullptr;
+		
+		auto pEntry = pList->m_pCurrentEntry;
+		if (pEntry != nullptr) {
+			withdrawEntrySignals (pEntry);
+			setEntryError (pList, pEntry, eErrorCode::LISTEXECUTIONABORTED);
+			pList->m_nErrorEntryIndex = pEntry->m_nIndexInList;
+			pList->m_ListState = eListState::ExecutionError;
+		} else {
+			pList->m_ListState = eListState::ExecutionFinished;
+		}
+		
+		return pList;
+	}
+
+	void CTcpListHandler::deleteList (uint32_t nListID)
+	{
+		auto pList = getListByID (nListID, true);
+		if (pList->m_ListState == eListState::ExecutingList)
+			throw CException (eErrorCode::LISTISEXECUTING, "list is executing!");
+		if (pList == m_pCurrentWriteList)
+			m_pCurrentWriteList = nullptr;
+		
+		// The list ID is reused by the next allocation, so a template must not release it later on.
+		for (auto & iTemplate : m_ListTemplates) {
+			auto & instanceListIds = iTemplate.second->m_InstanceListIds;
+			instanceListIds.erase (std::remove (instanceListIds.begin (), instanceListIds.end (), nListID), instanceListIds.end ());
+		}
+		
+		releaseList (pList);
 	}
 
 	bool CTcpListHandler::hasCurrentList ()
@@ -588,12 +1198,20 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 
 		
 	TcpListEntry* CTcpListHandler::addCommandToCurrentList (CTcpPacketHandler_Buffered * pHandler, TcpIncomingPayload * pPayload)
+	{
+		if (m_pCurrentWriteList == nullptr)
+			throw CException (eErrorCode::NOLISTTOWRITETO, "no list to write to.");	
+		
+		return addEntryToList (m_pCurrentWriteList, pHandler, pPayload);
+	}
+	
+	TcpListEntry* CTcpListHandler::addEntryToList (TcpList * pList, CTcpPacketHandler_Buffered * pHandler, TcpIncomingPayload * pPayload)
 	{
 		if (pHandler == nullptr)
 			throw CException (eErrorCode::INVALIDPARAM, "invalid packet handler parameter");
 		if (pPayload == nullptr)
 			throw CException (eErrorCode::INVALIDPAYLOAD, "invalid payload.");	
-		if (m_pCurrentWriteList == nullptr)
+		if (pList == nullptr)
 			throw CException (eErrorCode::NOLISTTOWRITETO, "no list to write to.");	
 		if (m_pUnusedListEntries == nullptr)
 			throw CException (eErrorCode::NOLISTENTRIESLEFT, "no list entries left");
@@ -604,17 +1222,17 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 		pNewListEntry->m_PacketHandler = pHandler;
 		pNewListEntry->m_Payload = *pPayload;
 		pNewListEntry->m_pNext = nullptr;
-		pNewListEntry->m_nIndexInList = m_pCurrentWriteList->m_nEntryCount;
+		pNewListEntry->m_nIndexInList = pList->m_nEntryCount;
 	
 		memset ((void*)&pNewListEntry->m_ExecutionContext, 0, sizeof (pNewListEntry->m_ExecutionContext));
 		pNewListEntry->m_ExecutionContext.m_nEntryState = eListEntryState::InQueue;
 	
-		m_pCurrentWriteList->m_nEntryCount++;
-		if (m_pCurrentWriteList->m_pFirstEntry == nullptr) 
-			m_pCurrentWriteList->m_pFirstEntry = pNewListEntry;		
-		if (m_pCurrentWriteList->m_pLastEntry != nullptr)
-			m_pCurrentWriteList->m_pLastEntry->m_pNext = pNewListEntry;
-		m_pCurrentWriteList->m_pLastEntry = pNewListEntry;
+		pList->m_nEntryCount++;
+		if (pList->m_pFirstEntry == nullptr) 
+			pList->m_pFirstEntry = pNewListEntry;		
+		if (pList->m_pLastEntry != nullptr)
+			pList->m_pLastEntry->m_pNext = pNewListEntry;
+		pList->m_pLastEntry = pNewListEntry;
 	
 		bufferedListEntries++;
 		
@@ -622,78 +1240,163 @@ bool CTcpPacketHandler_Buffered::cyclicExecution (CPayloadEnvironment * pEnviron
 	}
 
 
+	bool CTcpListHandler::signalHandlerIsBusyInOtherLane (CSignalHandler * pSignalHandler, uint32_t nLane)
+	{
+		for (uint32_t nOtherLane = 0; nOtherLane < LISTHANDLER_LANECOUNT; nOtherLane++) {
+			if (nOtherLane == nLane)
+				continue;
+			
+			auto pList = m_ExecutionLists[nOtherLane];
+			if ((pList == nullptr) || (pList->m_pCurrentEntry == nullptr))
+				continue;
+			
+			auto & context = pList->m_pCurrentEntry->m_ExecutionContext;
+			for (uint32_t nSlotIndex = 0; nSlotIndex < LISTCONTEXT_SIGNALSLOTCOUNT; nSlotIndex++) {
+				if ((context.m_pSignalSlotHandlers[nSlotIndex] == pSignalHandler) && (context.m_pSignalSlots[nSlotIndex] != nullptr)) {
+					if (!context.m_pSignalSlots[nSlotIndex]->signalHasBeenProcessed (context.m_nSignalSlotHandles[nSlotIndex]))
+						return true;
+				}
+			}
+		}
+		
+		return false;
+	}
+
+
 	void CTcpListHandler::handleCyclic ()
 	{
-		if (m_pCurrentExecutionList != nullptr) {
+		for (uint32_t nLane = 0; nLane < LISTHANDLER_LANECOUNT; nLane++) {
+			if (m_ExecutionLists[nLane] != nullptr)
+				handleLaneCyclic (nLane);
+		}
+	}
+	
+	void CTcpListHandler::setEntryBudgetPerCycle (uint32_t nEntryBudgetPerCycle)
+	{
+		if (nEntryBudgetPerCycle == 0)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid list entry budget");
 		
-			auto pEntryToExecute = m_pCurrentExecutionList->m_pCurrentEntry;
-			if (pEntryToExecute != nullptr) {
-				switch (pEntryToExecute->m_ExecutionContext.m_nEntryState) {
-					case eListEntryState::InQueue:
-					{
-						pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::InitialExecution;
-						break;
-					}
+		m_nEntryBudgetPerCycle = nEntryBudgetPerCycle;
+	}
+	
+	uint32_t CTcpListHandler::getEntryBudgetPerCycle ()
+	{
+		return m_nEntryBudgetPerCycle;
+	}
+	
+	void CTcpListHandler::setEntryError (TcpList * pList, TcpListEntry * pEntry, eErrorCode errorCode)
+	{
+		pEntry->m_ExecutionContext.m_nEntryState = eListEntryState::ExecutionError;
+		pList->m_ErrorCode = errorCode;
+	}
+	
+	void CTcpListHandler::withdrawEntrySignals (TcpListEntry * pEntry)
+	{
+		// Signals that have not been checked yet are withdrawn, so that a retry does not deliver the command twice.
+		// A signal that is already in process stays in its slot, it blocks a retry until it has been processed.
+		auto & context = pEntry->m_ExecutionContext;
+		for (uint32_t nSlotIndex = 0; nSlotIndex < LISTCONTEXT_SIGNALSLOTCOUNT; nSlotIndex++) {
+			if (context.m_pSignalSlots[nSlotIndex] != nullptr) {
+				if (context.m_pSignalSlots[nSlotIndex]->cancelSignal (context.m_nSignalSlotHandles[nSlotIndex])) {
+					context.m_pSignalSlots[nSlotIndex] = nullptr;
+					context.m_pSignalSlotHandlers[nSlotIndex] = nullptr;
+					context.m_nSignalSlotHandles[nSlotIndex] = SIGNALHANDLE_INVALID;
+				}
+			}
+		}
+	}
+	
+	void CTcpListHandler::handleLaneCyclic (uint32_t nLane)
+	{
+		auto pExecutionList = m_ExecutionLists[nLane];
+		uint32_t nEntriesStarted = 0;
+		
+		// Entries that finish right away are followed by the next entry in the same cycle, up to the entry budget.
+		while (true) {
+		
+			auto pEntryToExecute = pExecutionList->m_pCurrentEntry;
+			if (pEntryToExecute == nullptr) {
+				pExecutionList->m_ListState = eListState::ExecutionFinished;
+				m_ExecutionLists[nLane] = nullptr;
+				return;
+			}
+			
+			switch (pEntryToExecute->m_ExecutionContext.m_nEntryState) {
+				case eListEntryState::InQueue:
+				{
+					if (nEntriesStarted >= m_nEntryBudgetPerCycle)
+						return;
 					
-					case eListEntryState::InitialExecution: 
-					{
-						try {
-						
-							if (pEntryToExecute->m_PacketHandler == nullptr)
-								throw CException (eErrorCode::INTERNALLISTERROR, "internal list error");						
-						
-							CPayloadEnvironment environment (&pEntryToExecute->m_ExecutionContext, &pEntryToExecute->m_Payload, m_pSignalHandlerRegistry);
-							
-							pEntryToExecute->m_PacketHandler->enterExecution (&environment);							
-							pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::CyclicExecution;
-							
-						} catch (...) {
-							pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::ExecutionError;
-						}
-
-						break;
-					}
+					nEntriesStarted++;
+					pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::InitialExecution;
+					break;
+				}
+				
+				case eListEntryState::InitialExecution: 
+				{
+					try {
 					
+						if (pEntryToExecute->m_PacketHandler == nullptr)
+							throw CException (eErrorCode::INTERNALLISTERROR, "internal list error");						
 					
-					case eListEntryState::CyclicExecution: 
-					{
-						try {
+						CPayloadEnvironment environment (&pEntryToExecute->m_ExecutionContext, &pEntryToExecute->m_Payload, m_pSignalHandlerRegistry, this, nLane);
 						
-							if (pEntryToExecute->m_PacketHandler == nullptr)
-								throw CException (eErrorCode::INTERNALLISTERROR, "internal list error");						
+						pEntryToExecute->m_PacketHandler->enterExecution (&environment);							
+						pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::CyclicExecution;
 						
-							CPayloadEnvironment environment (&pEntryToExecute->m_ExecutionContext, &pEntryToExecute->m_Payload, m_pSignalHandlerRegistry);
-							
-							bool bIsFinished = pEntryToExecute->m_PacketHandler->cyclicExecution (&environment);
-							if (bIsFinished) {
-								pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::Finished;
-							} else {
-								pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::CyclicExecution;
-							}
-							
-						} catch (...) {
-							pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::ExecutionError;
-						}
-
-						break;
+					} catch (CException & E) {
+						setEntryError (pExecutionList, pEntryToExecute, E.getCode ());
+					} catch (...) {
+						setEntryError (pExecutionList, pEntryToExecute, eErrorCode::UNHANDLEDEXCEPTION);
 					}
+
+					break;
+				}
+				
+				
+				case eListEntryState::CyclicExecution: 
+				{
+					try {
 					
-					case eListEntryState::Finished:
-					{
-						m_pCurrentExecutionList->m_pCurrentEntry = pEntryToExecute->m_pNext;						
-						break;
-					}
+						if (pEntryToExecute->m_PacketHandler == nullptr)
+							throw CException (eErrorCode::INTERNALLISTERROR, "internal list error");						
 					
-					case eListEntryState::ExecutionError:
-					{
-						m_pCurrentExecutionList = nullptr;
-						break;
+						CPayloadEnvironment environment (&pEntryToExecute->m_ExecutionContext, &pEntryToExecute->m_Payload, m_pSignalHandlerRegistry, this, nLane);
+						
+						bool bIsFinished = pEntryToExecute->m_PacketHandler->cyclicExecution (&environment);
+						if (bIsFinished) {
+							pEntryToExecute->m_ExecutionContext.m_nEntryState = eListEntryState::Finished;
+						} else {
+							// Still waiting, continue in the next cycle
+							return;
+						}
+						
+					} catch (CException & E) {
+						setEntryError (pExecutionList, pEntryToExecute, E.getCode ());
+					} catch (...) {
+						setEntryError (pExecutionList, pEntryToExecute, eErrorCode::UNHANDLEDEXCEPTION);
 					}
-					
+
+					break;
 				}
-			
+				
+				case eListEntryState::Finished:
+				{
+					pExecutionList->m_pCurrentEntry = pEntryToExecute->m_pNext;						
+					break;
+				}
+				
+				case eListEntryState::ExecutionError:
+				{
+					// The list keeps its current entry, so that it can be resumed with a retry or a skip.
+					withdrawEntrySignals (pEntryToExecute);
+					pExecutionList->m_nErrorEntryIndex = pEntryToExecute->m_nIndexInList;
+					pExecutionList->m_ListState = eListState::ExecutionError;
+					m_ExecutionLists[nLane] = nullptr;
+					return;
+				}
+				
 			}
-		
 		}
 	}
 
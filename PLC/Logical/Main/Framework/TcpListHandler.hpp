@@ -39,8 +39,33 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "SignalHandler.hpp"
 
 #include <memory>
+#include <array>
+#include <map>
 
 #define LISTCONTEXT_SIGNALSLOTCOUNT 16
+#define LISTCONTEXT_DATASIZE 32
+
+// Number of lists that may execute concurrently, one per lane (e.g. axes, thermal, atmosphere)
+#define LISTHANDLER_LANECOUNT 4
+
+// Default number of list entries a lane may start within one cycle
+#define LISTHANDLER_DEFAULTENTRYBUDGET 8
+
+// Batch list upload: uint32 flags, uint32 entry count, then per entry uint32 command ID and the fixed size payload
+#define LISTBATCH_FLAG_EXECUTE 0x00000001
+#define LISTBATCH_FLAG_LANESHIFT 8
+#define LISTBATCH_FLAG_LANEMASK 0x0000ff00
+#define LISTBATCH_HEADERSIZE 8
+#define LISTBATCH_ENTRYSIZE (4 + sizeof (TcpIncomingPayload))
+
+// List template definition: uint32 template ID, uint32 source list ID, uint32 patch count, then per patch uint32 entry index, uint32 payload offset and uint32 parameter index
+#define LISTTEMPLATE_MAXCOUNT 64
+#define LISTTEMPLATE_MAXPARAMETERS 64
+#define LISTTEMPLATE_HEADERSIZE 12
+#define LISTTEMPLATE_PATCHSIZE 12
+
+// List template instantiation: uint32 template ID, uint32 flags (see LISTBATCH_FLAG_*), then the int32 parameters
+#define LISTTEMPLATE_INSTANCEHEADERSIZE 8
 
 namespace BuRCPP {
 	
@@ -61,11 +86,18 @@ namespace BuRCPP {
 		ExecutionError = 5
 	};	
 	
+	enum class eListResumeMode : int32_t {
+		RetryEntry = 0,
+		SkipEntry = 1
+	};
+	
 	typedef struct _TcpListEntryContext {
 		eListEntryState m_nEntryState;
 		uint32_t m_nLifeTimeInMilliseconds;
 		CSignalSendInstance * m_pSignalSlots[LISTCONTEXT_SIGNALSLOTCOUNT];
-		uint8_t m_ContextData[32];		
+		CSignalHandler * m_pSignalSlotHandlers[LISTCONTEXT_SIGNALSLOTCOUNT];
+		uint32_t m_nSignalSlotHandles[LISTCONTEXT_SIGNALSLOTCOUNT];
+		uint8_t m_ContextData[LISTCONTEXT_DATASIZE];		
 	} TcpListEntryContext;
 	
 	class CTcpListHandler;
@@ -86,11 +118,13 @@ namespace BuRCPP {
 		TcpListEntryContext * m_pContext;
 		TcpIncomingPayload * m_pPayload;
 		CSignalHandlerRegistry * m_pSignalHandlerRegistry;
+		CTcpListHandler * m_pListHandler;
+		uint32_t m_nLane;
 				
 			
 		public:
 		
-		CPayloadEnvironment (TcpListEntryContext * pContext, TcpIncomingPayload * pPayload, CSignalHandlerRegistry * pSignalHandlerRegistry);
+		CPayloadEnvironment (TcpListEntryContext * pContext, TcpIncomingPayload * pPayload, CSignalHandlerRegistry * pSignalHandlerRegistry, CTcpListHandler * pListHandler, uint32_t nLane);
 		
 		virtual ~CPayloadEnvironment ();
 		
@@ -184,13 +218,35 @@ namespace BuRCPP {
 	struct _TcpList {
 		uint32_t m_nListId;
 		uint32_t m_nEntryCount;	
+		uint32_t m_nLane;
 		eListState m_ListState;
 		TcpListEntry * m_pFirstEntry;
 		TcpListEntry * m_pLastEntry;
 		TcpListEntry * m_pCurrentEntry;		
 		TcpList * m_pNextUnusedList;
+		uint32_t m_nErrorEntryIndex;
+		eErrorCode m_ErrorCode;
 	};
 	
+	typedef struct _TcpListTemplatePatch {
+		uint32_t m_nEntryIndex;
+		uint32_t m_nPayloadOffset;
+		uint32_t m_nParameterIndex;
+	} TcpListTemplatePatch;
+	
+	typedef struct _TcpListTemplateEntry {
+		CTcpPacketHandler_Buffered * m_PacketHandler;
+		TcpIncomingPayload m_Payload;
+	} TcpListTemplateEntry;
+	
+	typedef struct _TcpListTemplate {
+		uint32_t m_nTemplateId;
+		uint32_t m_nParameterCount;
+		std::vector<uint32_t> m_InstanceListIds;
+		std::vector<TcpListTemplateEntry> m_Entries;
+		std::vector<TcpListTemplatePatch> m_Patches;
+	} TcpListTemplate;
+	
 	class CTcpListHandler {
 	
 		private:
@@ -201,11 +257,22 @@ namespace BuRCPP {
 		
 		TcpList * m_pCurrentWriteList;
 		
-		TcpList * m_pCurrentExecutionList;
+		std::array<TcpList *, LISTHANDLER_LANECOUNT> m_ExecutionLists;
+		uint32_t m_nEntryBudgetPerCycle;
 		
 		CSignalHandlerRegistry * m_pSignalHandlerRegistry;
+		
+		std::map<uint32_t, std::shared_ptr<TcpListTemplate>> m_ListTemplates;
 			
-		void addEntryToList (TcpList *, CTcpPacketHandler_Buffered * pHandler, TcpIncomingPayload * pPayload);
+		TcpList * allocateList ();
+		void releaseList (TcpList * pList);
+		void releaseTemplateInstances (TcpListTemplate * pTemplate);
+		TcpListEntry * addEntryToList (TcpList * pList, CTcpPacketHandler_Buffered * pHandler, TcpIncomingPayload * pPayload);
+		void finishList (TcpList * pList);
+		
+		void handleLaneCyclic (uint32_t nLane);
+		void setEntryError (TcpList * pList, TcpListEntry * pEntry, eErrorCode errorCode);
+		void withdrawEntrySignals (TcpListEntry * pEntry);
 		
 		public:
 		
@@ -219,14 +286,28 @@ namespace BuRCPP {
 			
 		uint32_t beginList ();
 		TcpList * finishList ();
-		TcpList* executeList (uint32_t nListID);
+		TcpList* executeList (uint32_t nListID, uint32_t nLane);
+		TcpList* resumeList (uint32_t nListID, uint32_t nLane, eListResumeMode resumeMode);
+		TcpList* abortList (uint32_t nListID);
+		void deleteList (uint32_t nListID);
 		TcpList* getListByID (uint32_t nListID, bool bListMustExist);
 			
 		bool hasCurrentList ();
 		
+		bool canAllocateList (uint32_t nEntryCount);
+		TcpList * uploadList (CTcpPacketRegistry * pPacketRegistry, uint8_t * pData, uint32_t nDataSize);
+		
+		void defineListTemplate (uint8_t * pData, uint32_t nDataSize);
+		TcpList * instantiateListTemplate (uint8_t * pData, uint32_t nDataSize);
+		
 		
 		
 		TcpListEntry * addCommandToCurrentList (CTcpPacketHandler_Buffered * pHandler, TcpIncomingPayload * pPayload);
+		
+		bool signalHandlerIsBusyInOtherLane (CSignalHandler * pSignalHandler, uint32_t nLane);
+		
+		void setEntryBudgetPerCycle (uint32_t nEntryBudgetPerCycle);
+		uint32_t getEntryBudgetPerCycle ();
 			
 		void handleCyclic ();
 			 
@@ -51,9 +51,13 @@ namespace BuRCPP
 	
 	
 	
-	CTcpPacketResponse::CTcpPacketResponse ()
-	:  m_nSignature (0), m_nClientID (0), m_nSequenceID (0), m_nCurrentSize (0), m_nErrorCode (0)
+	CTcpPacketResponse::CTcpPacketResponse (uint8_t * pPayload, uint32_t nCapacity)
+	:  m_pPayload (pPayload), m_nCapacity (nCapacity), m_nSignature (0), m_nClientID (0), m_nSequenceID (0), m_nCurrentSize (0), m_nErrorCode (0)
 	{
+		if (pPayload == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet response payload.");
+		if (nCapacity > TCP_MAX_PACKET_RESPONSESIZE)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet response capacity.");
 	}
 		
 	CTcpPacketResponse::~CTcpPacketResponse ()
@@ -63,23 +67,13 @@ namespace BuRCPP
 	void CTcpPacketResponse::addPayload (uint8_t * pData, uint32_t nDataSize)	
 	{
 		if ((pData != nullptr) && (nDataSize > 0)) {
-			if (nDataSize > TCP_MAX_PACKET_RESPONSESIZE)
+			if (nDataSize > m_nCapacity)
 				throw CException (eErrorCode::INVALIDPARAM, "invalid packet response payload size.");
 				
-			uint32_t nNewDataSize = m_nCurrentSize + nDataSize;
-			if (nNewDataSize > TCP_MAX_PACKET_RESPONSESIZE)
+			if (nDataSize > m_nCapacity - m_nCurrentSize)
 				throw CException (eErrorCode::INVALIDPARAM, "packet response payload overflow.");
 			
-			uint8_t * pSource = pData;
-			uint8_t * pTarget = &m_Payload.at (m_nCurrentSize);
-			
-			for (uint32_t nIndex = 0; nIndex < nDataSize; nIndex++)
-			{
-				*pTarget = *pSource;
-				pTarget++;
-				pSource++;
-			}
-			
+			memcpy (&m_pPayload[m_nCurrentSize], pData, nDataSize);
 			m_nCurrentSize += nDataSize;
 			
 			
@@ -101,6 +95,11 @@ namespace BuRCPP
 		addPayload ((uint8_t*)&nValue, sizeof (nValue));
 	}
 		
+	void CTcpPacketResponse::addUint64 (uint64_t nValue)
+	{
+		addPayload ((uint8_t*)&nValue, sizeof (nValue));
+	}
+		
 	void CTcpPacketResponse::addInt8 (int8_t nValue)
 	{
 		addPayload ((uint8_t*)&nValue, sizeof (nValue));
@@ -129,6 +128,14 @@ namespace BuRCPP
 	}
 
 	
+	void CTcpPacketResponse::writeUint32 (uint32_t nOffset, uint32_t nValue)
+	{
+		if ((nOffset > m_nCurrentSize) || (m_nCurrentSize - nOffset < sizeof (nValue)))
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet response write offset.");
+		
+		memcpy (&m_pPayload[nOffset], &nValue, sizeof (nValue));
+	}
+	
 	void CTcpPacketResponse::setErrorCode (eErrorCode nErrorCode)
 	{
 		m_nErrorCode = (uint32_t) nErrorCode;
@@ -159,9 +166,14 @@ namespace BuRCPP
 		return m_nCurrentSize;
 	}
 		
-	std::array<uint8_t, TCP_MAX_PACKET_RESPONSESIZE> & CTcpPacketResponse::getPayload ()
+	uint32_t CTcpPacketResponse::getRemainingSize ()
 	{
-		return m_Payload;
+		return m_nCapacity - m_nCurrentSize;
+	}
+		
+	uint8_t * CTcpPacketResponse::getPayload ()
+	{
+		return m_pPayload;
 	}
 	
 	void CTcpPacketResponse::buildHeader (TcpOutgoingMessageHeader & header)
@@ -174,7 +186,7 @@ namespace BuRCPP
 		header.m_nStatusCode = m_nErrorCode;
 		
 		if (m_nCurrentSize > 0) {
-			header.m_nPayloadChecksum = CUtils::computeCRC32 (m_Payload.data (), (uint32_t) m_nCurrentSize);
+			header.m_nPayloadChecksum = CUtils::computeCRC32 (m_pPayload, (uint32_t) m_nCurrentSize);
 		} else {
 			header.m_nPayloadChecksum = 0;
 		}
@@ -228,6 +240,68 @@ namespace BuRCPP
 	}
 
 	
+	void CTcpPacketHandler::handleExtendedPacket (uint8_t * pPayload, uint32_t nPayloadSize, CTcpPacketResponse * pResponse)
+	{
+		if ((pPayload == nullptr) && (nPayloadSize > 0))
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet payload param.");
+		if (nPayloadSize > sizeof (TcpIncomingPayload))
+			throw CException (eErrorCode::INVALIDPAYLOAD, "payload exceeds the fixed packet payload size.");
+		
+		TcpIncomingPayload payload;
+		memset (&payload, 0, sizeof (payload));
+		if (nPayloadSize > 0)
+			memcpy (&payload, pPayload, nPayloadSize);
+		
+		handlePacket (&payload, pResponse);
+	}
+	
+	uint8_t CTcpPacketHandler::readUint8FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset)
+	{
+		if (pData == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet payload param.");
+		if ((nOffset > nDataSize) || (nDataSize - nOffset < sizeof (uint8_t)))
+			throw CException (eErrorCode::INVALIDPAYLOADOFFSET, "invalid packet payload offset.");
+		
+		return pData[nOffset];
+	}
+	
+	uint16_t CTcpPacketHandler::readUint16FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset)
+	{
+		if (pData == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet payload param.");
+		if ((nOffset > nDataSize) || (nDataSize - nOffset < sizeof (uint16_t)))
+			throw CException (eErrorCode::INVALIDPAYLOADOFFSET, "invalid packet payload offset.");
+		
+		uint16_t nValue;
+		memcpy (&nValue, &pData[nOffset], sizeof (nValue));
+		return nValue;
+	}
+	
+	uint32_t CTcpPacketHandler::readUint32FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset)
+	{
+		if (pData == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet payload param.");
+		if ((nOffset > nDataSize) || (nDataSize - nOffset < sizeof (uint32_t)))
+			throw CException (eErrorCode::INVALIDPAYLOADOFFSET, "invalid packet payload offset.");
+		
+		uint32_t nValue;
+		memcpy (&nValue, &pData[nOffset], sizeof (nValue));
+		return nValue;
+	}
+	
+	double CTcpPacketHandler::readDoubleFromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset)
+	{
+		if (pData == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet payload param.");
+		if ((nOffset > nDataSize) || (nDataSize - nOffset < sizeof (double)))
+			throw CException (eErrorCode::INVALIDPAYLOADOFFSET, "invalid packet payload offset.");
+		
+		double dValue;
+		memcpy (&dValue, &pData[nOffset], sizeof (dValue));
+		return dValue;
+	}
+
+	
 	CTcpPacketHandler_Direct::CTcpPacketHandler_Direct ()
 	: CTcpPacketHandler ()
 	{
@@ -275,6 +349,19 @@ namespace BuRCPP
 		return (iIter != m_Handlers.end ());
 	}
 
+	CTcpPacketHandler * CTcpPacketRegistry::findHandler (uint32_t nCommandID, bool bMustExist)
+	{
+		auto iIter = m_Handlers.find (nCommandID);
+		if (iIter == m_Handlers.end ()) {
+			if (bMustExist)
+				throw CException (eErrorCode::PACKETHANDLERNOTFOUND, "packet handler not found: " + std::to_string (nCommandID));
+			
+			return nullptr;
+		}
+		
+		return iIter->second.get ();
+	}
+
 	bool CTcpPacketRegistry::handlePacket (uint8_t * pData, uint32_t nDataSize, CTcpPacketResponse * pResponse)
 	{
 		
@@ -315,9 +402,77 @@ namespace BuRCPP
 			pResponse->clearPayload ();
 		}
 		
+		return true;
+		
 
 		
 	}
+	
+	uint32_t CTcpPacketRegistry::getPacketSignature ()
+	{
+		return m_nPacketSignature;
+	}
+	
+	uint32_t CTcpPacketRegistry::getExtendedPacketSignature ()
+	{
+		return m_nPacketSignature | (TCP_EXTENDEDFRAME_VERSION << 16);
+	}
+	
+	bool CTcpPacketRegistry::isValidExtendedHeader (TcpExtendedMessageHeader & header)
+	{
+		if (header.m_nSignature != getExtendedPacketSignature ())
+			return false;
+		if (header.m_nPayloadLength > TCP_EXTENDEDFRAME_MAXPAYLOADSIZE)
+			return false;
+		
+		// The header checksum is always checked, as the frame length depends on it.
+		uint32_t nChecksum = CUtils::computeCRC32 ((uint8_t*) &header, (uint32_t)sizeof (TcpExtendedMessageHeader) - 4);
+		return (header.m_nHeaderChecksum == nChecksum);
+	}
+	
+	bool CTcpPacketRegistry::handleExtendedPacket (uint8_t * pData, uint32_t nDataSize, CTcpPacketResponse * pResponse)
+	{
+		if (pData == nullptr) 
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet data param.");
+		if (nDataSize < sizeof (TcpExtendedMessageHeader) + 4) 
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet data size param.");
+		if (pResponse == nullptr) 
+			throw CException (eErrorCode::INVALIDPARAM, "invalid packet response pointer.");
+		
+		TcpExtendedMessageHeader header;
+		memcpy (&header, pData, sizeof (header));
+		if (!isValidExtendedHeader (header))
+			return false;
+		if (nDataSize != sizeof (TcpExtendedMessageHeader) + header.m_nPayloadLength + 4)
+			return false;
+		
+		uint8_t * pPayload = pData + sizeof (TcpExtendedMessageHeader);
+		uint32_t nPayloadChecksum;
+		memcpy (&nPayloadChecksum, pPayload + header.m_nPayloadLength, sizeof (nPayloadChecksum));
+		
+		// The header is valid, so a corrupted payload is answered with an error and the stream stays in sync
+		if (nPayloadChecksum != CUtils::computeCRC32 (pPayload, header.m_nPayloadLength)) {
+			pResponse->beginResponse (header.m_nClientId, header.m_nSequenceId, m_nPacketSignature);
+			pResponse->setErrorCode (eErrorCode::INVALIDEXTENDEDFRAME);
+			return true;
+		}
+		
+		auto iIter = m_Handlers.find (header.m_nCommandId);
+		if (iIter == m_Handlers.end ())
+			return false;
+		
+		CTcpPacketHandler * pHandler = iIter->second.get();
+		pResponse->beginResponse (header.m_nClientId, header.m_nSequenceId, m_nPacketSignature);
+		try {
+			pHandler->handleExtendedPacket (pPayload, header.m_nPayloadLength, pResponse);
+		}
+		catch (CException & E) {
+			pResponse->setErrorCode (E.getCode ());
+			pResponse->clearPayload ();
+		}
+		
+		return true;
+	}
 
 }
 
@@ -41,6 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <array>
 #define	TCP_MAX_PACKET_RESPONSESIZE (256 * 1024)
 
+// Extended frames use the packet signature with the framing version in the upper 16 bits.
+#define TCP_EXTENDEDFRAME_VERSION 1
+#define TCP_EXTENDEDFRAME_MAXPAYLOADSIZE (16 * 1024)
+#define TCP_EXTENDEDFRAME_MAXSIZE (sizeof (TcpExtendedMessageHeader) + TCP_EXTENDEDFRAME_MAXPAYLOADSIZE + 4)
+
 
 
 
@@ -48,9 +53,11 @@ namespace BuRCPP {
 
 	
 
+	// Serializes a response payload directly into memory owned by the caller, usually the send queue of a connection.
 	class CTcpPacketResponse {		
 		private:
-			std::array<uint8_t, TCP_MAX_PACKET_RESPONSESIZE> m_Payload;
+			uint8_t * m_pPayload;
+			uint32_t m_nCapacity;
 					
 			uint32_t m_nSignature;
 			uint32_t m_nClientID;
@@ -60,18 +67,21 @@ namespace BuRCPP {
 
 		public:
 				
-			CTcpPacketResponse ();
+			CTcpPacketResponse (uint8_t * pPayload, uint32_t nCapacity);
 			virtual ~CTcpPacketResponse ();
 				
 			void addUint8 (uint8_t nValue);
 			void addUint16 (uint16_t nValue);
 			void addUint32 (uint32_t nValue);
+			void addUint64 (uint64_t nValue);
 			void addInt8 (int8_t nValue);
 			void addInt16 (int16_t nValue);
 			void addInt32 (int32_t nValue);
 			void addDouble (double nValue);
 			void addString (const std::string & sValue);
 			void addPayload (uint8_t * pData, uint32_t nDataSize);
+			
+			void writeUint32 (uint32_t nOffset, uint32_t nValue);
 
 			void setErrorCode (eErrorCode nErrorCode);
 				
@@ -81,8 +91,9 @@ namespace BuRCPP {
 			uint32_t getClientID ();
 			uint32_t getSequenceID ();
 			uint32_t getCurrentSize ();	
+			uint32_t getRemainingSize ();
 				
-			std::array<uint8_t, TCP_MAX_PACKET_RESPONSESIZE> & getPayload ();
+			uint8_t * getPayload ();
 				
 			void buildHeader (TcpOutgoingMessageHeader & header);
 		
@@ -105,10 +116,18 @@ namespace BuRCPP {
 		
 		virtual void handlePacket (TcpIncomingPayload * pPayload, CTcpPacketResponse * pResponse) = 0;
 		
+		// Handles the payload of an extended frame. By default, payloads that fit the fixed payload are passed on to handlePacket.
+		virtual void handleExtendedPacket (uint8_t * pPayload, uint32_t nPayloadSize, CTcpPacketResponse * pResponse);
+		
 		static uint8_t readUint8FromPayload (TcpIncomingPayload * pPayload, uint32_t nOffset);
 		static uint16_t readUint16FromPayload (TcpIncomingPayload * pPayload, uint32_t nOffset);
 		static uint32_t readUint32FromPayload (TcpIncomingPayload * pPayload, uint32_t nOffset);
 		
+		static uint8_t readUint8FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset);
+		static uint16_t readUint16FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset);
+		static uint32_t readUint32FromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset);
+		static double readDoubleFromData (uint8_t * pData, uint32_t nDataSize, uint32_t nOffset);
+		
 	};
 
 
@@ -141,8 +160,15 @@ namespace BuRCPP {
 		void registerHandler (std::shared_ptr<CTcpPacketHandler> pPacketHandler);
 		
 		bool canHandlePacket (uint32_t nCommandID);		
+		CTcpPacketHandler * findHandler (uint32_t nCommandID, bool bMustExist);
 
 		bool handlePacket (uint8_t * pData, uint32_t nDataSize, CTcpPacketResponse * pResponse);
+		bool handleExtendedPacket (uint8_t * pData, uint32_t nDataSize, CTcpPacketResponse * pResponse);
+		
+		uint32_t getPacketSignature ();
+		uint32_t getExtendedPacketSignature ();
+		
+		bool isValidExtendedHeader (TcpExtendedMessageHeader & header);
 		
 	};
 
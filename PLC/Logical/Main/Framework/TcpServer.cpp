@@ -41,11 +41,22 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string.h>
 
+#ifdef BURCPP_HOSTBUILD
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 
 
 namespace BuRCPP
 {
 
+#ifndef BURCPP_HOSTBUILD
 
 	class CTcpServerImpl
 	{
@@ -297,17 +308,378 @@ namespace BuRCPP
 
 		
 	};
+
+#else // BURCPP_HOSTBUILD
+
+	// The host build mirrors the AsTCP function blocks with non-blocking POSIX sockets. Idents are socket descriptors and
+	// the status codes follow AsTCP, so CTcpServer and CTcpConnection run unchanged.
+	class CTcpServerImpl
+	{
+		private:
+		
+		int m_nListenSocket;
+		uint32_t m_nPort;
+		uint32_t m_nClientIdent;
+		int m_nCloseSocket;
+		
+		bool m_bOpenIsEnabled;
+		bool m_bListenIsEnabled;
+		bool m_bCloseIsEnabled;
+		
+		uint32_t m_nOpenStatus;
+		uint32_t m_nListenStatus;
+		uint32_t m_nCloseStatus;
+		
+		void openSocket ()
+		{
+			m_nListenSocket = socket (AF_INET, SOCK_STREAM, 0);
+			if (m_nListenSocket < 0) {
+				m_nOpenStatus = tcpERR_SOCKET_CREATE;
+				return;
+			}
+			
+			int nReuseAddress = 1;
+			setsockopt (m_nListenSocket, SOL_SOCKET, SO_REUSEADDR, &nReuseAddress, sizeof (nReuseAddress));
+			
+			sockaddr_in address;
+			memset ((void*) &address, 0, sizeof (address));
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl (INADDR_ANY);
+			address.sin_port = htons ((uint16_t) m_nPort);
+			
+			if ((bind (m_nListenSocket, (sockaddr*) &address, sizeof (address)) != 0) || (fcntl (m_nListenSocket, F_SETFL, O_NONBLOCK) != 0)) {
+				close (m_nListenSocket);
+				m_nListenSocket = -1;
+				m_nOpenStatus = tcpERR_SOCKET_BIND;
+				return;
+			}
+			
+			m_nOpenStatus = ERR_OK;
+		}
+		
+		void acceptClient ()
+		{
+			int nClientSocket = accept (m_nListenSocket, nullptr, nullptr);
+			if (nClientSocket < 0) {
+				if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))
+					m_nListenStatus = ERR_FUB_BUSY;
+				else
+					m_nListenStatus = tcpERR_SOCKET_ACCEPT;
+				return;
+			}
+			
+			int nNoDelay = 1;
+			setsockopt (nClientSocket, IPPROTO_TCP, TCP_NODELAY, &nNoDelay, sizeof (nNoDelay));
+			fcntl (nClientSocket, F_SETFL, O_NONBLOCK);
+			
+			m_nClientIdent = (uint32_t) nClientSocket;
+			m_nListenStatus = ERR_OK;
+		}
+		
+		public:
+		
+		CTcpServerImpl ()
+			: m_nListenSocket (-1), m_nPort (0), m_nClientIdent (0), m_nCloseSocket (-1),
+			m_bOpenIsEnabled (false), m_bListenIsEnabled (false), m_bCloseIsEnabled (false),
+			m_nOpenStatus (ERR_FUB_BUSY), m_nListenStatus (ERR_FUB_BUSY), m_nCloseStatus (ERR_FUB_BUSY)
+		{
+		}
+		
+		~CTcpServerImpl ()
+		{
+			if (m_nListenSocket >= 0)
+				close (m_nListenSocket);
+		}
+		
+		void handleCyclic ()
+		{
+			if (m_bOpenIsEnabled && (m_nOpenStatus == ERR_FUB_BUSY))
+				openSocket ();
+			
+			// Like TcpServer, an accepted client is reported for one cycle, then the server listens again
+			if (m_bListenIsEnabled && ((m_nListenStatus == ERR_FUB_BUSY) || (m_nListenStatus == ERR_OK)))
+				acceptClient ();
+			
+			if (m_bCloseIsEnabled && (m_nCloseStatus == ERR_FUB_BUSY)) {
+				m_nCloseStatus = (close (m_nCloseSocket) == 0) ? ERR_OK : tcpERR_SYSTEM;
+			}
+		}
+		
+		void * getFunctionBlockOpen ()
+		{
+			return nullptr;
+		}
+
+		void * getFunctionBlockClose ()
+		{
+			return nullptr;
+		}
+
+		void * getFunctionBlockServer ()
+		{
+			return nullptr;
+		}
+		
+		void initialiseTCP (uint32_t nPort)
+		{
+			m_nPort = nPort;
+			m_bOpenIsEnabled = true;
+			m_nOpenStatus = ERR_FUB_BUSY;
+		}
+		
+		bool tcpOpenIsBusy ()
+		{
+			return (tcpOpenErrorCode () == ERR_FUB_BUSY);
+		}
+		
+		bool tcpOpenIsFinished ()
+		{
+			return (tcpOpenErrorCode () == ERR_OK);
+		}
+		
+		uint32_t tcpOpenErrorCode ()
+		{
+			return m_nOpenStatus;
+		}
+		
+		uint32_t tcpOpenIdent ()
+		{
+			return (uint32_t) m_nListenSocket;
+		}
+		
+		uint32_t tcpListenClientIdent ()
+		{
+			return m_nClientIdent;
+		}
+		
+		bool tcpListenClientConnected ()
+		{
+			return (tcpListenErrorCode () == ERR_OK);
+		}
+
+		bool tcpListenIsBusy ()
+		{
+			return (tcpListenErrorCode () == ERR_FUB_BUSY);
+		}
+		
+		uint32_t tcpListenErrorCode ()
+		{
+			return m_nListenStatus;
+		}
+				
+		bool tcpCloseFinished ()
+		{
+			return (tcpCloseErrorCode () == ERR_OK);
+		}
+
+		bool tcpCloseIsBusy ()
+		{
+			return (tcpCloseErrorCode () == ERR_FUB_BUSY);
+		}
+		
+		uint32_t tcpCloseErrorCode ()
+		{
+			return m_nCloseStatus;
+		}
+						
+		
+		void listenOnSocket (uint32_t nSocketIdent, uint32_t nMaxConnections)
+		{
+			m_bListenIsEnabled = true;
+			m_nListenStatus = (listen ((int) nSocketIdent, (int) nMaxConnections) == 0) ? ERR_FUB_BUSY : tcpERR_SOCKET_LISTEN;
+		}
+		
+		void closeClientConnection (uint32_t nClientIdent)
+		{
+			m_bCloseIsEnabled = true;
+			m_nCloseSocket = (int) nClientIdent;
+			m_nCloseStatus = ERR_FUB_BUSY;
+		}
+		
+		void resetClose ()
+		{
+			m_bCloseIsEnabled = false;
+		}
+	
+	};
+	
+	
+	class CTcpConnectionImpl
+	{
+		private:
+		
+			int m_nReceiveSocket;
+			uint8_t * m_pReceiveBuffer;
+			uint32_t m_nReceiveBufferSize;
+			uint32_t m_nReceiveStatus;
+			uint32_t m_nBytesReceived;
+			bool m_bReceiveIsEnabled;
+			
+			int m_nSendSocket;
+			uint8_t * m_pSendBuffer;
+			uint32_t m_nSendBufferSize;
+			uint32_t m_nSendStatus;
+			uint32_t m_nBytesSent;
+			bool m_bSendIsEnabled;
+		
+		public:
+		
+			CTcpConnectionImpl () {
+				resetFunctionBlocks ();
+							
+			}
+		
+			virtual ~CTcpConnectionImpl ()
+			{
+			}
+		
+			void resetFunctionBlocks ()
+			{
+			resetReceive ();
+			resetSend ();
+		}
+		
+		
+		void handleCyclic ()
+		{
+			if (m_bReceiveIsEnabled && (m_nReceiveStatus == tcpERR_NO_DATA)) {
+				ssize_t nResult = recv (m_nReceiveSocket, m_pReceiveBuffer, m_nReceiveBufferSize, 0);
+				if (nResult > 0) {
+					m_nBytesReceived = (uint32_t) nResult;
+					m_nReceiveStatus = ERR_OK;
+				} else if (nResult == 0) {
+					m_nReceiveStatus = tcpERR_NOT_CONNECTED;
+				} else if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+					m_nReceiveStatus = tcpERR_SYSTEM;
+				}
+			}
+			
+			if (m_bSendIsEnabled && (m_nSendStatus == ERR_FUB_BUSY)) {
+				ssize_t nResult = send (m_nSendSocket, m_pSendBuffer + m_nBytesSent, m_nSendBufferSize - m_nBytesSent, MSG_NOSIGNAL);
+				if (nResult >= 0) {
+					m_nBytesSent += (uint32_t) nResult;
+					if (m_nBytesSent >= m_nSendBufferSize)
+						m_nSendStatus = ERR_OK;
+				} else if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+					m_nSendStatus = tcpERR_SYSTEM;
+				}
+			}
+		}
+		
+		
+		void * getFunctionBlockClose ()
+		{
+			return nullptr;
+		}
+
+		void * getFunctionBlockSend ()
+		{
+			return nullptr;
+		}
+
+		void * getFunctionBlockRecv ()
+		{
+			return nullptr;
+		}
+		
+		void initReceive (uint32_t nClientIdent, void * pBuffer, uint32_t nBufferSize)
+		{
+			m_bReceiveIsEnabled = true;
+			m_nReceiveSocket = (int) nClientIdent;
+			m_pReceiveBuffer = (uint8_t*) pBuffer;
+			m_nReceiveBufferSize = nBufferSize;
+			m_nReceiveStatus = tcpERR_NO_DATA;
+			m_nBytesReceived = 0;
+		}
+		
+		void resetReceive ()
+		{
+			m_bReceiveIsEnabled = false;
+			m_nReceiveSocket = -1;
+			m_pReceiveBuffer = nullptr;
+			m_nReceiveBufferSize = 0;
+			m_nReceiveStatus = ERR_OK;
+			m_nBytesReceived = 0;
+		}
+		
+		
+		bool tcpRecvIsFinished ()
+		{
+			return (tcpRecvErrorCode () == ERR_OK);
+		}
+		
+		bool tcpRecvIsBusy ()
+		{
+			return (tcpRecvErrorCode () == ERR_FUB_BUSY) || (tcpRecvErrorCode () == tcpERR_NO_DATA);
+		}
+		
+		uint32_t tcpRecvErrorCode ()
+		{
+			return m_nReceiveStatus;
+		}
+		
+		uint32_t tcpBytesReceived ()
+		{
+			return m_nBytesReceived;
+		}
+
+		void initSend (uint32_t nClientIdent, void * pBuffer, uint32_t nBufferSize)
+		{
+			m_bSendIsEnabled = true;
+			m_nSendSocket = (int) nClientIdent;
+			m_pSendBuffer = (uint8_t*) pBuffer;
+			m_nSendBufferSize = nBufferSize;
+			m_nSendStatus = ERR_FUB_BUSY;
+			m_nBytesSent = 0;
+		}
+		
+		void resetSend ()
+		{
+			m_bSendIsEnabled = false;
+			m_nSendSocket = -1;
+			m_pSendBuffer = nullptr;
+			m_nSendBufferSize = 0;
+			m_nSendStatus = ERR_OK;
+			m_nBytesSent = 0;
+		}
+		
+		bool tcpSendIsFinished ()
+		{
+			return (tcpSendErrorCode () == ERR_OK);
+		}
+		
+		bool tcpSendIsBusy ()
+		{
+			return (tcpSendErrorCode () == ERR_FUB_BUSY);
+		}
+		
+		uint32_t tcpSendErrorCode ()
+		{
+			return m_nSendStatus;
+		}
+		
+		uint32_t tcpBytesSent ()
+		{
+			return m_nBytesSent;
+		}
+
+		
+	};
+
+#endif // BURCPP_HOSTBUILD
 	
 	
 	
 	CTcpConnection::CTcpConnection (uint32_t nReceiveBufferSize, uint32_t nSendBufferSize, CTcpPacketRegistry* pPacketRegistry)
-		: m_SendState (eTcpConnectionSend_State::INACTIVE),
+		: m_ClientIdent (0),
 		m_RecvState (eTcpConnectionRecv_State::INACTIVE),
-		m_ClientIdent (0), m_LastError (0), 
+		m_SendState (eTcpConnectionSend_State::INACTIVE),
+		m_ReceiveStream (nReceiveBufferSize * TCPRECEIVESTREAMCHUNKS + TCP_EXTENDEDFRAME_MAXSIZE),
 		m_SendBufferInProcessSize (0), 
 		m_SendBufferNextInQueueSize (0),
 		m_SendBufferMemorySize (nSendBufferSize),
-		m_pPacketRegistry (pPacketRegistry)
+		m_pPacketRegistry (pPacketRegistry),
+		m_LastError (0)
 		
 	{
 		if (pPacketRegistry == nullptr)
@@ -319,6 +691,7 @@ namespace BuRCPP
 		
 		m_pImpl.reset ( new CTcpConnectionImpl () );
 		m_ReceiveBuffer.resize (nReceiveBufferSize);
+		m_FrameBuffer.resize (TCP_EXTENDEDFRAME_MAXSIZE);
 		m_SendBuffer1.resize (nSendBufferSize);
 		m_SendBuffer2.resize (nSendBufferSize);
 		m_pSendBufferInProcess = m_SendBuffer1.data();
@@ -341,6 +714,7 @@ namespace BuRCPP
 		m_LastError = 0;
 		m_SendBufferInProcessSize = 0;
 		m_SendBufferNextInQueueSize = 0;
+		m_ReceiveStream.clear ();
 	}
 		
 	
@@ -355,6 +729,24 @@ namespace BuRCPP
 		return true;
 	}
 		
+	uint8_t * CTcpConnection::reserveSendData (uint32_t nByteCount)
+	{
+		if (!canSendData (nByteCount))
+			throw CException (eErrorCode::TCPSENDBUFFERISFULL, "tcp send buffer is full.");
+		
+		return &m_pSendBufferNextInQueue[m_SendBufferNextInQueueSize];
+	}
+	
+	void CTcpConnection::commitSendData (uint32_t nByteCount)
+	{
+		if (!canSendData (nByteCount))
+			throw CException (eErrorCode::TCPSENDBUFFERISFULL, "tcp send buffer is full.");
+		
+		m_SendBufferNextInQueueSize += nByteCount;
+		queueDataCounter++;
+		queueDataBytes += nByteCount;
+	}
+		
 	void CTcpConnection::sendData (uint8_t * pBytes, uint32_t nByteCount)
 	{
 		if ((pBytes == nullptr) || (nByteCount == 0))
@@ -375,6 +767,71 @@ namespace BuRCPP
 				
 	}
 	
+	bool CTcpConnection::handleReceivedFrames ()
+	{
+		uint32_t nFramesHandled = 0;
+		
+		while ((nFramesHandled < TCPMAXFRAMESPERCYCLE) && (m_ReceiveStream.getAvailableSize () >= sizeof (uint32_t))) {
+			
+			// Keep the frame queued until the send buffer can take a response of maximum size.
+			uint32_t nMaxResponseSize = sizeof (TcpOutgoingMessageHeader) + TCP_MAX_PACKET_RESPONSESIZE;
+			if (!canSendData (nMaxResponseSize))
+				break;
+			
+			uint32_t nSignature;
+			m_ReceiveStream.peek ((uint8_t*) &nSignature, sizeof (nSignature));
+			
+			bool bIsExtendedFrame = (nSignature == m_pPacketRegistry->getExtendedPacketSignature ());
+			uint32_t nFrameSize = sizeof (TcpIncomingMessage);
+			
+			if (bIsExtendedFrame) {
+				if (m_ReceiveStream.getAvailableSize () < sizeof (TcpExtendedMessageHeader))
+					break;
+				
+				TcpExtendedMessageHeader header;
+				m_ReceiveStream.peek ((uint8_t*) &header, sizeof (header));
+				// Without a valid header the frame boundaries are lost, so the connection can not continue
+				if (!m_pPacketRegistry->isValidExtendedHeader (header)) {
+					m_LastError = (uint32_t) eErrorCode::INVALIDEXTENDEDFRAME;
+					return false;
+				}
+				
+				nFrameSize = sizeof (TcpExtendedMessageHeader) + header.m_nPayloadLength + 4;
+			}
+			
+			if (m_ReceiveStream.getAvailableSize () < nFrameSize)
+				break;
+			
+			m_ReceiveStream.peek (m_FrameBuffer.data (), nFrameSize);
+			
+			// The handler serializes directly behind the space reserved for the header in the send queue.
+			uint8_t * pTarget = reserveSendData (nMaxResponseSize);
+			CTcpPacketResponse response (pTarget + sizeof (TcpOutgoingMessageHeader), TCP_MAX_PACKET_RESPONSESIZE);
+			
+			bool bHandled;
+			if (bIsExtendedFrame) {
+				bHandled = m_pPacketRegistry->handleExtendedPacket (m_FrameBuffer.data (), nFrameSize, &response);
+			} else {
+				bHandled = m_pPacketRegistry->handlePacket (m_FrameBuffer.data (), nFrameSize, &response);
+			}
+			
+			if (!bHandled)
+				return false;
+			
+			m_ReceiveStream.discard (nFrameSize);
+			
+			TcpOutgoingMessageHeader responseHeader;
+			response.buildHeader (responseHeader);
+			memcpy (pTarget, &responseHeader, sizeof (responseHeader));
+			
+			commitSendData (sizeof (responseHeader) + response.getCurrentSize ());
+			
+			nFramesHandled++;
+		}
+		
+		return true;
+	}
+	
 	void CTcpConnection::handleCyclic ()
 	{
 		
@@ -393,56 +850,13 @@ namespace BuRCPP
 					uint32_t bytesReceived = m_pImpl->tcpBytesReceived ();
 					m_pImpl->resetReceive();
 					
-					if (bytesReceived > 0) {
-						
-						bool bHadError = false;
-						uint8_t * pData = m_ReceiveBuffer.data();
-						uint32_t bytesToHandle = bytesReceived;
-						while ((!bHadError) && (bytesToHandle >= sizeof (TcpIncomingMessage))) {
-							
-							if (m_pPacketRegistry->handlePacket (pData, sizeof (TcpIncomingMessage), &m_TempResponse)) {
-								
-								TcpOutgoingMessageHeader responseHeader;
-								m_TempResponse.buildHeader (responseHeader);
-																
-								auto & payLoad = m_TempResponse.getPayload();
-								uint32_t nPayLoadSize = m_TempResponse.getCurrentSize();													
-
-								sendData ((uint8_t*) &responseHeader, sizeof (responseHeader));
-								if (nPayLoadSize > 0)
-									sendData (&payLoad[0], nPayLoadSize);
-								
-								
-								pData += sizeof (TcpIncomingMessage);
-								bytesToHandle -= sizeof (TcpIncomingMessage);
-								
-							} else {
-								bHadError = true;
-							}
-
-														
-						}
-						
-						if (bHadError ||(bytesToHandle > 0)) {
-							
-							m_RecvState = eTcpConnectionRecv_State::ERROR;
-							
-						} else {							
-							m_RecvState = eTcpConnectionRecv_State::RESETCONNECTION;
-						}
-						
-						
-					} else {
-						
-						m_RecvState = eTcpConnectionRecv_State::RESETCONNECTION;
-						
-					}
+					// Frames may be split across receive calls, so the bytes are accumulated until a frame is complete.
+					if (bytesReceived > 0)
+						m_ReceiveStream.write (m_ReceiveBuffer.data(), bytesReceived);
 					
 					totalBytesReceived += bytesReceived;
-																		
-					
-					
 					
+					m_RecvState = eTcpConnectionRecv_State::WAITINGFORBUFFER;
 					
 				} else if (m_pImpl->tcpRecvIsBusy ()) {
 					m_RecvState = eTcpConnectionRecv_State::WAITINGFORDATA;					
@@ -454,6 +868,12 @@ namespace BuRCPP
 										
 				break;
 			
+			case eTcpConnectionRecv_State::WAITINGFORBUFFER:
+				// Only receive again when a full receive chunk fits into the stream buffer.
+				if (m_ReceiveStream.getFreeSize () >= m_ReceiveBuffer.size ())
+					m_RecvState = eTcpConnectionRecv_State::RESETCONNECTION;
+				
+				break;
 			
 			case eTcpConnectionRecv_State::RESETCONNECTION:
 				m_pImpl->initReceive (m_ClientIdent, m_ReceiveBuffer.data (), m_ReceiveBuffer.size ());
@@ -471,6 +891,11 @@ namespace BuRCPP
 				throw CException (eErrorCode::UNKNOWNTCPRECVSTATE, "tcp connection is in unknown recv state.");
 		}
 		
+		if ((m_RecvState != eTcpConnectionRecv_State::INACTIVE) && (m_RecvState != eTcpConnectionRecv_State::ERROR)) {
+			if (!handleReceivedFrames ())
+				m_RecvState = eTcpConnectionRecv_State::ERROR;
+		}
+		
 		switch (m_SendState)
 		{
 			case eTcpConnectionSend_State::WAITINGFORDATA: 			
@@ -523,7 +948,7 @@ namespace BuRCPP
 	
 	
 	CTcpServer::CTcpServer (uint32_t port, uint32_t maxConnections, uint32_t nPacketSignature)
-		: m_State (eTcpServer_State::INACTIVE), m_Port (port), m_LastError (0), m_MaxConnections (maxConnections)
+		: m_State (eTcpServer_State::INACTIVE), m_Port (port), m_MaxConnections (maxConnections), m_LastError (0)
 	{
 		m_pImpl.reset ( new CTcpServerImpl () );			
 		m_PacketRegistry.reset (new CTcpPacketRegistry (nPacketSignature));
@@ -674,7 +1099,7 @@ void CTcpServer::handleServer ()
 		};
 		
 	
-	for (auto pConnection : m_ActiveConnections)
+	for (auto & pConnection : m_ActiveConnections)
 		pConnection->handleCyclic ();
 	
 	m_pImpl->handleCyclic ();
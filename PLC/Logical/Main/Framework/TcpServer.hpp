@@ -36,11 +36,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Framework.hpp"
 #include "TcpPacketHandler.hpp"
+#include "TcpStreamBuffer.hpp"
 #include <list>
 #include <vector>
 
-#define TCPMINBUFFERSIZE 1024
-#define TCPMAXBUFFERSIZE (16*1024*1024)
+// Maximum number of complete frames that are handled per connection and cycle
+#define TCPMAXFRAMESPERCYCLE 16
+
+// Capacity of the receive stream buffer in multiples of the receive buffer size
+#define TCPRECEIVESTREAMCHUNKS 4
 
 namespace BuRCPP {
 	
@@ -69,6 +73,7 @@ namespace BuRCPP {
 		WAITINGFORDATA = 2,
 		RESETCONNECTION = 3,
 		CLOSINGCONNECTION = 4,
+		WAITINGFORBUFFER = 5,
 		ERROR =	6
 	};	
 
@@ -90,6 +95,8 @@ namespace BuRCPP {
 			eTcpConnectionSend_State m_SendState;
 								
 			std::vector<uint8_t> m_ReceiveBuffer;
+			CTcpStreamBuffer m_ReceiveStream;
+			std::vector<uint8_t> m_FrameBuffer;
 			std::vector<uint8_t> m_SendBuffer1;
 			std::vector<uint8_t> m_SendBuffer2;
 					
@@ -101,9 +108,12 @@ namespace BuRCPP {
 			
 			CTcpPacketRegistry* m_pPacketRegistry;
 			
-			CTcpPacketResponse m_TempResponse;
-						
 			uint32_t m_LastError;
+			
+			bool handleReceivedFrames ();
+			
+			uint8_t * reserveSendData (uint32_t nByteCount);
+			void commitSendData (uint32_t nByteCount);
 
 		public:
 		
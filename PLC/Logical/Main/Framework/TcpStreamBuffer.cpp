@@ -0,0 +1,117 @@
+/*++
+
+Copyright (C) 2024 Institute for Machine Tools and Industrial Management
+TUM School of Engineering and Design
+Technical University of Munich
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Technical University of Munich nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL TECHNICAL UNIVERSITY OF MUNICH BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "TcpStreamBuffer.hpp"
+#include <algorithm>
+
+namespace BuRCPP {
+	
+	CTcpStreamBuffer::CTcpStreamBuffer (uint32_t nCapacity)
+		: m_nReadPosition (0), m_nAvailableSize (0)
+	{
+		if ((nCapacity < TCPMINBUFFERSIZE) || (nCapacity > TCPMAXBUFFERSIZE))
+			throw CException (eErrorCode::INVALIDTCPBUFFERSIZE, "invalid tcp buffer size.");
+		
+		m_Buffer.resize (nCapacity);
+	}
+	
+	CTcpStreamBuffer::~CTcpStreamBuffer ()
+	{
+	}
+	
+	void CTcpStreamBuffer::clear ()
+	{
+		m_nReadPosition = 0;
+		m_nAvailableSize = 0;
+	}
+	
+	uint32_t CTcpStreamBuffer::getCapacity ()
+	{
+		return (uint32_t) m_Buffer.size ();
+	}
+	
+	uint32_t CTcpStreamBuffer::getAvailableSize ()
+	{
+		return m_nAvailableSize;
+	}
+	
+	uint32_t CTcpStreamBuffer::getFreeSize ()
+	{
+		return (uint32_t) m_Buffer.size () - m_nAvailableSize;
+	}
+	
+	void CTcpStreamBuffer::write (const uint8_t * pData, uint32_t nSize)
+	{
+		if (pData == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid stream data param.");
+		if (nSize > getFreeSize ())
+			throw CException (eErrorCode::TCPRECEIVEBUFFERISFULL, "tcp receive buffer is full.");
+		
+		uint32_t nCapacity = (uint32_t) m_Buffer.size ();
+		uint32_t nWritePosition = (m_nReadPosition + m_nAvailableSize) % nCapacity;
+		
+		uint32_t nFirstChunk = std::min (nSize, nCapacity - nWritePosition);
+		memcpy (&m_Buffer[nWritePosition], pData, nFirstChunk);
+		if (nFirstChunk < nSize)
+			memcpy (&m_Buffer[0], pData + nFirstChunk, nSize - nFirstChunk);
+		
+		m_nAvailableSize += nSize;
+	}
+	
+	void CTcpStreamBuffer::peek (uint8_t * pTarget, uint32_t nSize)
+	{
+		if (pTarget == nullptr)
+			throw CException (eErrorCode::INVALIDPARAM, "invalid stream target param.");
+		if (nSize > m_nAvailableSize)
+			throw CException (eErrorCode::TCPRECEIVEBUFFERUNDERRUN, "tcp receive buffer underrun.");
+		
+		uint32_t nCapacity = (uint32_t) m_Buffer.size ();
+		uint32_t nFirstChunk = std::min (nSize, nCapacity - m_nReadPosition);
+		memcpy (pTarget, &m_Buffer[m_nReadPosition], nFirstChunk);
+		if (nFirstChunk < nSize)
+			memcpy (pTarget + nFirstChunk, &m_Buffer[0], nSize - nFirstChunk);
+	}
+	
+	void CTcpStreamBuffer::discard (uint32_t nSize)
+	{
+		if (nSize > m_nAvailableSize)
+			throw CException (eErrorCode::TCPRECEIVEBUFFERUNDERRUN, "tcp receive buffer underrun.");
+		
+		m_nReadPosition = (m_nReadPosition + nSize) % (uint32_t) m_Buffer.size ();
+		m_nAvailableSize -= nSize;
+		
+		// Restart at the beginning when drained, so that the next frames are likely contiguous.
+		if (m_nAvailableSize == 0)
+			m_nReadPosition = 0;
+	}
+	
+}
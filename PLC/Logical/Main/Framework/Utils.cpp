@@ -93,9 +93,25 @@ namespace BuRCPP {
 		};
 
 #define DO1(buf) crc = crc_table[((int)crc ^ (*buf++)) & 0xff] ^ (crc >> 8);
-#define DO2(buf)  DO1(buf); DO1(buf);
-#define DO4(buf)  DO2(buf); DO2(buf);
-#define DO8(buf)  DO4(buf); DO4(buf);
+
+	// Slice-by-8 tables, derived from crc_table on first use. Slice 0 equals crc_table.
+	static uint32_t crc_slice_table[8][256];
+	static bool crc_slice_table_ready = false;
+	
+	static void buildCRC32SliceTables ()
+	{
+		for (uint32_t nIndex = 0; nIndex < 256; nIndex++)
+			crc_slice_table[0][nIndex] = crc_table[nIndex];
+		
+		for (uint32_t nSlice = 1; nSlice < 8; nSlice++) {
+			for (uint32_t nIndex = 0; nIndex < 256; nIndex++) {
+				uint32_t nPrevious = crc_slice_table[nSlice - 1][nIndex];
+				crc_slice_table[nSlice][nIndex] = (nPrevious >> 8) ^ crc_table[nPrevious & 0xff];
+			}
+		}
+		
+		crc_slice_table_ready = true;
+	}
 
 	/* ========================================================================= */
 
@@ -104,17 +120,38 @@ namespace BuRCPP {
 		if ((buf == nullptr) || (len == 0))
 			return 0;
 		
+		if (!crc_slice_table_ready)
+			buildCRC32SliceTables ();
+		
 		uint32_t crc = 0;
 		
 		crc = crc ^ 0xffffffffL;
-		//	while (len >= 8)
-		//	{
-		//		DO8(buf);
-		//		len -= 8;
-		//	}
-		if (len) do {
-				DO1(buf);
-			} while (--len);
+		
+		// Process 8 bytes per step. The word loads assume a little endian target.
+		while (len >= 8) {
+			uint32_t nLow, nHigh;
+			memcpy (&nLow, buf, 4);
+			memcpy (&nHigh, buf + 4, 4);
+			nLow ^= crc;
+			
+			crc = crc_slice_table[7][nLow & 0xff] ^
+				crc_slice_table[6][(nLow >> 8) & 0xff] ^
+				crc_slice_table[5][(nLow >> 16) & 0xff] ^
+				crc_slice_table[4][nLow >> 24] ^
+				crc_slice_table[3][nHigh & 0xff] ^
+				crc_slice_table[2][(nHigh >> 8) & 0xff] ^
+				crc_slice_table[1][(nHigh >> 16) & 0xff] ^
+				crc_slice_table[0][nHigh >> 24];
+			
+			buf += 8;
+			len -= 8;
+		}
+		
+		while (len) {
+			DO1(buf);
+			len--;
+		}
+		
 		return crc ^ 0xffffffffL;
 		
 	}
@@ -80,90 +80,90 @@ namespace BuRCPP {
 		
 	void CIOModule_X20AI4622::onRegisterJournal () 
 	{
-		registerBoolValue ("ModuleOk", JOURNALVARIABLE_X20AI4622_MODULEOK);
-		registerBoolValue ("StaleData", JOURNALVARIABLE_X20AI4622_STALEDATA);
-		registerUInt32Value ("SerialNumber", JOURNALVARIABLE_X20AI4622_SERIALNUMBER);
-		registerUInt16Value ("ModuleID", JOURNALVARIABLE_X20AI4622_MODULEID);
-		registerUInt16Value ("HardwareVariant", JOURNALVARIABLE_X20AI4622_HARDWAREVARIANT);
-		registerUInt16Value ("FirmwareVersion", JOURNALVARIABLE_X20AI4622_FIRMWAREVERSION);
-		registerInt16Value ("AnalogInput01", JOURNALVARIABLE_X20AI4622_ANALOGINPUT01);
-		registerInt16Value ("AnalogInput02", JOURNALVARIABLE_X20AI4622_ANALOGINPUT02);
-		registerInt16Value ("AnalogInput03", JOURNALVARIABLE_X20AI4622_ANALOGINPUT03);
-		registerInt16Value ("AnalogInput04", JOURNALVARIABLE_X20AI4622_ANALOGINPUT04);
-		registerUInt8Value ("StatusInput01", JOURNALVARIABLE_X20AI4622_STATUSINPUT01);
+		m_JournalModuleOk = registerBoolValue ("ModuleOk", JOURNALVARIABLE_X20AI4622_MODULEOK);
+		m_JournalStaleData = registerBoolValue ("StaleData", JOURNALVARIABLE_X20AI4622_STALEDATA);
+		m_JournalSerialNumber = registerUInt32Value ("SerialNumber", JOURNALVARIABLE_X20AI4622_SERIALNUMBER);
+		m_JournalModuleID = registerUInt16Value ("ModuleID", JOURNALVARIABLE_X20AI4622_MODULEID);
+		m_JournalHardwareVariant = registerUInt16Value ("HardwareVariant", JOURNALVARIABLE_X20AI4622_HARDWAREVARIANT);
+		m_JournalFirmwareVersion = registerUInt16Value ("FirmwareVersion", JOURNALVARIABLE_X20AI4622_FIRMWAREVERSION);
+		m_JournalAnalogInputs[0] = registerInt16Value ("AnalogInput01", JOURNALVARIABLE_X20AI4622_ANALOGINPUT01);
+		m_JournalAnalogInputs[1] = registerInt16Value ("AnalogInput02", JOURNALVARIABLE_X20AI4622_ANALOGINPUT02);
+		m_JournalAnalogInputs[2] = registerInt16Value ("AnalogInput03", JOURNALVARIABLE_X20AI4622_ANALOGINPUT03);
+		m_JournalAnalogInputs[3] = registerInt16Value ("AnalogInput04", JOURNALVARIABLE_X20AI4622_ANALOGINPUT04);
+		m_JournalStatusInput01 = registerUInt8Value ("StatusInput01", JOURNALVARIABLE_X20AI4622_STATUSINPUT01);
 		
 		
 		
 		switch (getChannelType (1)) {
 			case eIOChannelType_X20AI4622::mtVoltage10V:
-				registerDoubleValue ("InputVoltage01", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE01, -10.0, 10.0, 65536);
+				m_JournalInputValues[0] = registerDoubleValue ("InputVoltage01", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE01, -10.0, 10.0, 65536);
 				break;
 			
 			case eIOChannelType_X20AI4622::mtCurrent0to20mA:
-				registerDoubleValue ("InputCurrentInAmpere01", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE01, 0.000, 0.020, 65536);
+				m_JournalInputValues[0] = registerDoubleValue ("InputCurrentInAmpere01", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE01, 0.000, 0.020, 65536);
 				break;
 
 			case eIOChannelType_X20AI4622::mtCurrent4to20mA:
-				registerDoubleValue ("InputCurrentInAmpere01", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE01, 0.004, 0.020, 65536);
+				m_JournalInputValues[0] = registerDoubleValue ("InputCurrentInAmpere01", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE01, 0.004, 0.020, 65536);
 				break;
 		}
 		
 		switch (getChannelType (2)) {
 			case eIOChannelType_X20AI4622::mtVoltage10V:
-				registerDoubleValue ("InputVoltage02", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE02, -10.0, 10.0, 65536);
+				m_JournalInputValues[1] = registerDoubleValue ("InputVoltage02", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE02, -10.0, 10.0, 65536);
 				break;
 			
 			case eIOChannelType_X20AI4622::mtCurrent0to20mA:
-				registerDoubleValue ("InputCurrentInAmpere02", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE02, 0.000, 0.020, 65536);
+				m_JournalInputValues[1] = registerDoubleValue ("InputCurrentInAmpere02", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE02, 0.000, 0.020, 65536);
 				break;
 
 			case eIOChannelType_X20AI4622::mtCurrent4to20mA:
-				registerDoubleValue ("InputCurrentInAmpere02", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE02, 0.004, 0.020, 65536);
+				m_JournalInputValues[1] = registerDoubleValue ("InputCurrentInAmpere02", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE02, 0.004, 0.020, 65536);
 				break;
 		}
 		
 		switch (getChannelType (3)) {
 			case eIOChannelType_X20AI4622::mtVoltage10V:
-				registerDoubleValue ("InputVoltage03", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE03, -10.0, 10.0, 65536);
+				m_JournalInputValues[2] = registerDoubleValue ("InputVoltage03", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE03, -10.0, 10.0, 65536);
 				break;
 			
 			case eIOChannelType_X20AI4622::mtCurrent0to20mA:
-				registerDoubleValue ("InputCurrentInAmpere03", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE03, 0.000, 0.020, 65536);
+				m_JournalInputValues[2] = registerDoubleValue ("InputCurrentInAmpere03", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE03, 0.000, 0.020, 65536);
 				break;
 
 			case eIOChannelType_X20AI4622::mtCurrent4to20mA:
-				registerDoubleValue ("InputCurrentInAmpere03", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE03, 0.004, 0.020, 65536);
+				m_JournalInputValues[2] = registerDoubleValue ("InputCurrentInAmpere03", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE03, 0.004, 0.020, 65536);
 				break;
 		}
 		
 		switch (getChannelType (4)) {
 			case eIOChannelType_X20AI4622::mtVoltage10V:
-				registerDoubleValue ("InputVoltage04", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE04, -10.0, 10.0, 65536);
+				m_JournalInputValues[3] = registerDoubleValue ("InputVoltage04", JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE04, -10.0, 10.0, 65536);
 				break;
 			
 			case eIOChannelType_X20AI4622::mtCurrent0to20mA:
-				registerDoubleValue ("InputCurrentInAmpere04", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE04, 0.000, 0.020, 65536);
+				m_JournalInputValues[3] = registerDoubleValue ("InputCurrentInAmpere04", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE04, 0.000, 0.020, 65536);
 				break;
 
 			case eIOChannelType_X20AI4622::mtCurrent4to20mA:
-				registerDoubleValue ("InputCurrentInAmpere04", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE04, 0.004, 0.020, 65536);
+				m_JournalInputValues[3] = registerDoubleValue ("InputCurrentInAmpere04", JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE04, 0.004, 0.020, 65536);
 				break;
 		}
 	}
 
 	void CIOModule_X20AI4622::onUpdateJournal () 
 	{
-		setBoolValue (JOURNALVARIABLE_X20AI4622_MODULEOK, m_pMapping->ModuleOk);
-		setBoolValue (JOURNALVARIABLE_X20AI4622_STALEDATA, m_pMapping->StaleData);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_SERIALNUMBER, m_pMapping->SerialNumber);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_MODULEID, m_pMapping->ModuleID);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_HARDWAREVARIANT, m_pMapping->HardwareVariant);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_FIRMWAREVERSION, m_pMapping->FirmwareVersion);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_ANALOGINPUT01, m_pMapping->AnalogInput01);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_ANALOGINPUT02, m_pMapping->AnalogInput02);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_ANALOGINPUT03, m_pMapping->AnalogInput03);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_ANALOGINPUT04, m_pMapping->AnalogInput04);
-		setIntegerValue (JOURNALVARIABLE_X20AI4622_STATUSINPUT01, m_pMapping->StatusInput01);
+		setBoolValue (m_JournalModuleOk, m_pMapping->ModuleOk);
+		setBoolValue (m_JournalStaleData, m_pMapping->StaleData);
+		setIntegerValue (m_JournalSerialNumber, m_pMapping->SerialNumber);
+		setIntegerValue (m_JournalModuleID, m_pMapping->ModuleID);
+		setIntegerValue (m_JournalHardwareVariant, m_pMapping->HardwareVariant);
+		setIntegerValue (m_JournalFirmwareVersion, m_pMapping->FirmwareVersion);
+		setIntegerValue (m_JournalAnalogInputs[0], m_pMapping->AnalogInput01);
+		setIntegerValue (m_JournalAnalogInputs[1], m_pMapping->AnalogInput02);
+		setIntegerValue (m_JournalAnalogInputs[2], m_pMapping->AnalogInput03);
+		setIntegerValue (m_JournalAnalogInputs[3], m_pMapping->AnalogInput04);
+		setIntegerValue (m_JournalStatusInput01, m_pMapping->StatusInput01);
 		
 		
 		for (int index = 0; index < 4; index++)
@@ -172,19 +172,12 @@ namespace BuRCPP {
 			switch (getChannelType (nChannelNo)) {
 				
 				case eIOChannelType_X20AI4622::mtVoltage10V:
-				
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE01 + index, getInputVoltageInVolt (nChannelNo));	
-					/*setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE02, getInputVoltageInVolt (2));
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE03, getInputVoltageInVolt (3));
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTVOLTAGE04, getInputVoltageInVolt (4));*/
+					setDoubleValue (m_JournalInputValues[index], getInputVoltageInVolt (nChannelNo));	
 					break;	
 			
 				case eIOChannelType_X20AI4622::mtCurrent0to20mA:
 				case eIOChannelType_X20AI4622::mtCurrent4to20mA:
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE01 + index, getInputCurrentInAmpere (nChannelNo));
-					/*setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE02, getInputCurrentInAmpere (2));
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE03, getInputCurrentInAmpere (3));
-					setDoubleValue (JOURNALVARIABLE_X20AI4622_INPUTCURRENTINAMPERE04, getInputCurrentInAmpere (4));*/
+					setDoubleValue (m_JournalInputValues[index], getInputCurrentInAmpere (nChannelNo));
 					break;
 			}
 		}
@@ -36,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../Framework/Framework.hpp"
 
+#include <array>
+
 namespace BuRCPP {
 	
 	enum class eIOChannelType_X20AI4622 : uint32_t {
@@ -53,6 +55,16 @@ namespace BuRCPP {
 		std::array<int16_t,4> m_nLowerLimit;
 		std::array<int16_t,4> m_nUpperLimit;
 		
+		sJournalHandle m_JournalModuleOk;
+		sJournalHandle m_JournalStaleData;
+		sJournalHandle m_JournalSerialNumber;
+		sJournalHandle m_JournalModuleID;
+		sJournalHandle m_JournalHardwareVariant;
+		sJournalHandle m_JournalFirmwareVersion;
+		std::array<sJournalHandle, 4> m_JournalAnalogInputs;
+		sJournalHandle m_JournalStatusInput01;
+		std::array<sJournalHandle, 4> m_JournalInputValues;
+		
 		public:
 		CIOModule_X20AI4622 (const std::string & sName, IOMappingX20AI4622_TYP * pMapping);
 		virtual ~CIOModule_X20AI4622 ();
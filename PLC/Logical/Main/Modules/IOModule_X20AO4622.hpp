@@ -35,6 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../Framework/Framework.hpp"
 
+#include <array>
+
 namespace BuRCPP {
 	
 	enum class eIOChannelType_X20AO4622 : uint32_t {
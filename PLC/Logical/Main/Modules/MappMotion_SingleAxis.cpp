@@ -124,6 +124,11 @@ namespace BuRCPP {
 			return m_FunctionBlock.InPosition;
 		}
 		
+		bool isStopped () const
+		{
+			return m_FunctionBlock.Stopped;
+		}
+		
 		float getCurrentPosition () const
 		{
 			return m_FunctionBlock.Position;
@@ -149,6 +154,11 @@ namespace BuRCPP {
 			m_FunctionBlock.Home = bHomeFlag;
 		}
 		
+		void setStopFlag (bool bStopFlag) 
+		{
+			m_FunctionBlock.Stop = bStopFlag;
+		}
+		
 		void setVelocityParameter (float fVelocity)
 		{
 			m_Parameters.Velocity = fVelocity;
@@ -399,6 +409,23 @@ namespace BuRCPP {
 		m_pImpl->setRelativeMovementFlag(false);
 	}
 	
+	void CMappMotion_SingleAxis::stopAxis ()
+	{
+		moveAxisReset ();
+		m_pImpl->setHomeFlag (false);
+		
+		// An error state is left with resetError only
+		if ((m_State == eMappMotion_SingleAxisState::STATE_ERROR) || (m_State == eMappMotion_SingleAxisState::STATE_STOPPING))
+			return;
+		
+		if (isPowered () && isMoving ()) {
+			m_pImpl->setStopFlag (true);
+			m_State = eMappMotion_SingleAxisState::STATE_STOPPING;
+		} else {
+			m_State = eMappMotion_SingleAxisState::STATE_IDLE;
+		}
+	}
+	
 	
 	void CMappMotion_SingleAxis::onRegisterJournal ()
 	{
@@ -743,6 +770,18 @@ void CMappMotion_SingleAxis::handleCyclic ()
 				m_State = eMappMotion_SingleAxisState::STATE_ERROR;
 			}
 							
+			break;
+			
+		case eMappMotion_SingleAxisState::STATE_STOPPING:
+			if (m_pImpl->isStopped () || !m_pImpl->isPowered ()) {
+				m_pImpl->setStopFlag (false);
+				m_State = eMappMotion_SingleAxisState::STATE_IDLE;
+			}
+			if (m_pImpl->isError ()) {
+				m_pImpl->setStopFlag (false);
+				m_State = eMappMotion_SingleAxisState::STATE_ERROR;
+			}
+			
 			break;
 	}
 	
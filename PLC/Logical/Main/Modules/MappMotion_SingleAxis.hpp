@@ -61,6 +61,7 @@ namespace BuRCPP {
 		STATE_INITVELOCITYMOVEMENT = 7,
 		STATE_WAITINGFORMOVEMENT = 8,
 		STATE_SETTINGPOWERON_TO_REFERENCE = 9,
+		STATE_STOPPING = 10,
 		STATE_ERROR = 255,
 	};
 	
@@ -113,6 +114,9 @@ namespace BuRCPP {
 		
 		void resetError ();
 		void moveAxisReset ();
+		
+		// Aborts a movement or homing and brings the axis to standstill, the power stays on
+		void stopAxis ();
 		bool isError ();
 		bool isInPosition ();
 		